@@ -0,0 +1,36 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_CORE_ARCHITECTURE_HPP_INCLUDED
+#define CMP_CORE_ARCHITECTURE_HPP_INCLUDED
+
+#if defined(__x86_64__) \
+    || defined(__amd64__) \
+    || defined(_M_X64) \
+    || defined(_M_AMD64)
+
+#   define CMP_ARCHITECTURE_X86_64
+#   define CMP_ARCHITECTURE_NAME "x86-64"
+
+#elif defined(__i386__) \
+    || defined(_M_IX86)
+
+#   define CMP_ARCHITECTURE_X86_32
+#   define CMP_ARCHITECTURE_NAME "x86-32"
+
+#elif defined(__aarch64__) \
+    || defined(_M_ARM64)
+
+#   define CMP_ARCHITECTURE_ARM64
+#   define CMP_ARCHITECTURE_NAME "ARM64"
+
+#endif
+
+#if defined(CMP_ARCHITECTURE_X86_64) \
+    || defined(CMP_ARCHITECTURE_X86_32)
+
+#   define CMP_ARCHITECTURE_X86
+
+#endif
+
+#endif // CMP_CORE_ARCHITECTURE_HPP_INCLUDED
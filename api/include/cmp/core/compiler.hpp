@@ -17,6 +17,8 @@
 
 #   define CMP_WARNING_ID_MACRO_REDEFINED "-Wmacro-redefined"
 
+#   define CMP_TARGET_ATTRIBUTE(features) __attribute__((target(features)))
+
 #elif defined(__GNUC__)
 
 #   define CMP_COMPILER_GCC
@@ -28,6 +30,8 @@
 
 #   define CMP_WARNING_ID_MACRO_REDEFINED "-Wbuiltin-macro-redefined"
 
+#   define CMP_TARGET_ATTRIBUTE(features) __attribute__((target(features)))
+
 #elif defined(_MSC_VER)
 
 #   define CMP_COMPILER_MSVC
@@ -39,11 +43,15 @@
 
 #   define CMP_WARNING_ID_MACRO_REDEFINED 4005
 
+#   define CMP_TARGET_ATTRIBUTE(features)
+
 #else
 
 #   define CMP_COMPILER_UNSUPPORTED
 #   define CMP_COMPILER_NAME "<Unsupported>"
 
+#   define CMP_TARGET_ATTRIBUTE(features)
+
 #endif
 
 #endif // CMP_CORE_COMPILER_HPP_INCLUDED
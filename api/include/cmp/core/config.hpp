@@ -42,6 +42,10 @@
 #   define CMP_CONFIG_DEFAULT_STDIN_BUFFER_CAPACITY CMP_CONFIG_DEFAULT_BUFFER_CAPACITY
 #endif // CMP_CONFIG_DEFAULT_STDIN_BUFFER_CAPACITY
 
+#ifndef CMP_CONFIG_MAX_ADAPTIVE_BUFFER_CAPACITY
+#   define CMP_CONFIG_MAX_ADAPTIVE_BUFFER_CAPACITY 262144
+#endif // CMP_CONFIG_MAX_ADAPTIVE_BUFFER_CAPACITY
+
 #ifndef CMP_CONFIG_DESKTOP_GUI_PACKAGE_EXCLUDED
 #   define CMP_CONFIG_DESKTOP_GUI_PACKAGE_EXCLUDED false
 #endif // CMP_CONFIG_DESKTOP_GUI_PACKAGE_EXCLUDED
@@ -4,6 +4,7 @@
 #ifndef CMP_CORE_PLATFORM_HPP_INCLUDED
 #define CMP_CORE_PLATFORM_HPP_INCLUDED
 
+#include <cmp/core/architecture.hpp>
 #include <cmp/core/config.hpp>
 #include <cmp/core/compiler.hpp>
 #include <cmp/core/operating_system.hpp>
@@ -0,0 +1,462 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_ASYNC_FILE_HPP_INCLUDED
+#define CMP_IO_ASYNC_FILE_HPP_INCLUDED
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/core/platform.hpp>
+#include <cmp/io/exceptions.hpp>
+#include <cmp/io/general.hpp>
+#include <cmp/io/io_ring.hpp>
+
+#if defined(CMP_OS_LINUX_BASED)
+
+namespace cmp {
+
+/**
+    Description:
+        An async file is a file whose reads and writes are submitted
+        through an <#type>io_ring</#type> and complete asynchronously.
+        Each read or write either takes a completion handler, which is
+        called with the outcome once the request completes, or returns
+        an <#type>io_ring::awaitable</#type>, which a coroutine can
+        <#type>co_await</#type>.
+
+        The functions without an explicit offset transfer bytes at the
+        position of <#this/> async file and move the position forward
+        by the number of bytes requested as soon as the request is
+        queued, so that many sequential requests can be in flight at
+        once. Short reads near the end of the file don't move the
+        position back.
+
+        Async files are only available on Linux-based systems.
+*/
+class CMP_LIBRARY_NAME async_file
+{
+public:
+    // Types ------------------------------------------------------------------
+
+    using completion_handler = io_ring::completion_handler;
+    using awaitable = io_ring::awaitable;
+
+    // Constructors and Destructor --------------------------------------------
+
+    /**
+        Description:
+            Constructs an <#type>async_file</#type> object that submits
+            its requests through the given I/O ring and isn't associated
+            with any file.
+
+        Parameters:
+            ring:
+                The I/O ring to submit requests through.
+    */
+    CMP_CONDITIONAL_INLINE
+    explicit
+    async_file (
+        io_ring& ring
+    )
+    noexcept;
+
+    /**
+        Description:
+            Constructs an <#type>async_file</#type> object that submits
+            its requests through the given I/O ring and opens the file at
+            the given path.
+
+        Parameters:
+            ring:
+                The I/O ring to submit requests through.
+            file_path:
+                The path to the file to open.
+            mode:
+                The access mode to open the file in.
+            if_file_not_there:
+                The action to take if the specified file does not exist.
+    */
+    CMP_CONDITIONAL_INLINE
+    async_file (
+        io_ring& ring,
+        const std::filesystem::path& file_path,
+        access_mode mode,
+        if_not_there if_file_not_there
+    );
+
+    CMP_CONDITIONAL_INLINE
+    ~async_file ();
+
+    // Copy Operations --------------------------------------------------------
+
+    async_file (
+        const async_file& other
+    )
+    = delete;
+
+    async_file&
+    operator = (
+        const async_file& other
+    )
+    = delete;
+
+    // Move Operations --------------------------------------------------------
+
+    /**
+        Description:
+            Move-constructs an <#type>async_file</#type> from an existing
+            one, which is left not associated with any file.
+
+        Parameters:
+            other:
+                The <#type>async_file</#type>
+                to move from.
+    */
+    CMP_CONDITIONAL_INLINE
+    async_file (
+        async_file&& other
+    )
+    noexcept;
+
+    /**
+        Description:
+            Move-assigns an <#type>async_file</#type> into <#this/> one,
+            closing the file that <#this/> one was associated with. The
+            other one is left not associated with any file.
+
+        Parameters:
+            other:
+                The <#type>async_file</#type>
+                to move from.
+    */
+    CMP_CONDITIONAL_INLINE
+    async_file&
+    operator = (
+        async_file&& other
+    )
+    noexcept;
+
+    // Accessors --------------------------------------------------------------
+
+    /**
+        Description:
+            Returns true if the file is open. Otherwise, returns false.
+    */
+    CMP_CONDITIONAL_INLINE
+    bool
+    is_open ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns the access mode associated with <#this/> async file.
+    */
+    CMP_CONDITIONAL_INLINE
+    access_mode
+    get_access_mode ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns the I/O ring that <#this/> async
+            file submits its requests through.
+    */
+    CMP_CONDITIONAL_INLINE
+    io_ring&
+    get_ring ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns the position at which the next read or write without
+            an explicit offset will take place.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::int64_t
+    get_position ()
+    const noexcept;
+
+    /**
+        Description:
+            Sets the position at which the next read or write without
+            an explicit offset will take place.
+
+        Parameters:
+            new_position:
+                The new position of <#this/> async file.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    set_position (
+        std::int64_t new_position
+    )
+    noexcept;
+
+    // Core -------------------------------------------------------------------
+
+    /**
+        Description:
+            Opens the file at the given path with the given access mode.
+            Returns true if opening the file succeeds. Otherwise, returns
+            false.
+
+        Parameters:
+            file_path:
+                The path to the file to open.
+            mode:
+                The access mode to open the file in.
+            if_file_not_there:
+                The action to take if the specified file does not exist.
+    */
+    CMP_CONDITIONAL_INLINE
+    bool
+    open (
+        const std::filesystem::path& file_path,
+        access_mode mode,
+        if_not_there if_file_not_there
+    )
+    noexcept;
+
+    /**
+        Description:
+            Closes <#this/> async file. Requests already in flight keep
+            the file alive in the operating system until they complete.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    close ()
+    noexcept;
+
+    /**
+        Description:
+            Queues a read of <#parameter>data</#parameter>.size() bytes
+            at the position of <#this/> async file into
+            <#parameter>data</#parameter>, calling
+            <#parameter>handler</#parameter> once it completes.
+
+        Parameters:
+            data:
+                The bytes to read into, which must stay
+                valid until the request completes.
+            handler:
+                The function to call once the request completes.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    read (
+        std::span<std::byte> data,
+        completion_handler handler
+    );
+
+    /**
+        Description:
+            Queues a read of <#parameter>data</#parameter>.size() bytes
+            at <#parameter>offset</#parameter> into
+            <#parameter>data</#parameter>, calling
+            <#parameter>handler</#parameter> once it completes.
+
+        Parameters:
+            offset:
+                The offset in the file to read from.
+            data:
+                The bytes to read into, which must stay
+                valid until the request completes.
+            handler:
+                The function to call once the request completes.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    read_at (
+        std::int64_t offset,
+        std::span<std::byte> data,
+        completion_handler handler
+    );
+
+    /**
+        Description:
+            Queues a read at the position of <#this/> async file that
+            fills the given slot of the I/O ring, calling
+            <#parameter>handler</#parameter> once it completes. The bytes
+            read are then available through
+            <#function>io_ring::get_slot_view</#function>.
+
+        Parameters:
+            slot:
+                The index of the slot to read into.
+            handler:
+                The function to call once the request completes.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    read_slot (
+        std::size_t slot,
+        completion_handler handler
+    );
+
+    /**
+        Description:
+            Queues a write of the bytes of <#parameter>data</#parameter>
+            at the position of <#this/> async file, calling
+            <#parameter>handler</#parameter> once it completes.
+
+        Parameters:
+            data:
+                The bytes to write, which must stay
+                valid until the request completes.
+            handler:
+                The function to call once the request completes.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    write (
+        std::span<const std::byte> data,
+        completion_handler handler
+    );
+
+    /**
+        Description:
+            Queues a write of the bytes of <#parameter>data</#parameter>
+            at <#parameter>offset</#parameter>, calling
+            <#parameter>handler</#parameter> once it completes.
+
+        Parameters:
+            offset:
+                The offset in the file to write at.
+            data:
+                The bytes to write, which must stay
+                valid until the request completes.
+            handler:
+                The function to call once the request completes.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    write_at (
+        std::int64_t offset,
+        std::span<const std::byte> data,
+        completion_handler handler
+    );
+
+    /**
+        Description:
+            Returns an awaitable that reads
+            <#parameter>data</#parameter>.size() bytes at the position of
+            <#this/> async file into <#parameter>data</#parameter>.
+
+        Parameters:
+            data:
+                The bytes to read into.
+    */
+    CMP_CONDITIONAL_INLINE
+    awaitable
+    read_async (
+        std::span<std::byte> data
+    );
+
+    /**
+        Description:
+            Returns an awaitable that reads
+            <#parameter>data</#parameter>.size() bytes at
+            <#parameter>offset</#parameter> into
+            <#parameter>data</#parameter>.
+
+        Parameters:
+            offset:
+                The offset in the file to read from.
+            data:
+                The bytes to read into.
+    */
+    CMP_CONDITIONAL_INLINE
+    awaitable
+    read_at_async (
+        std::int64_t offset,
+        std::span<std::byte> data
+    );
+
+    /**
+        Description:
+            Returns an awaitable that fills the given slot of the I/O ring
+            with the bytes at the position of <#this/> async file.
+
+        Parameters:
+            slot:
+                The index of the slot to read into.
+    */
+    CMP_CONDITIONAL_INLINE
+    awaitable
+    read_slot_async (
+        std::size_t slot
+    );
+
+    /**
+        Description:
+            Returns an awaitable that writes the bytes of
+            <#parameter>data</#parameter> at the position of
+            <#this/> async file.
+
+        Parameters:
+            data:
+                The bytes to write.
+    */
+    CMP_CONDITIONAL_INLINE
+    awaitable
+    write_async (
+        std::span<const std::byte> data
+    );
+
+    /**
+        Description:
+            Returns an awaitable that writes the bytes of
+            <#parameter>data</#parameter> at <#parameter>offset</#parameter>.
+
+        Parameters:
+            offset:
+                The offset in the file to write at.
+            data:
+                The bytes to write.
+    */
+    CMP_CONDITIONAL_INLINE
+    awaitable
+    write_at_async (
+        std::int64_t offset,
+        std::span<const std::byte> data
+    );
+
+private:
+    // Private Data -----------------------------------------------------------
+
+    io_ring* m_ring;
+    int m_file_descriptor;
+    access_mode m_access_mode;
+    std::int64_t m_position;
+
+    // Private Functions ------------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    impl::submission_fields
+    make_fields (
+        std::uint8_t opcode,
+        std::int64_t offset,
+        const std::byte* data,
+        std::size_t byte_count
+    )
+    const;
+
+    CMP_CONDITIONAL_INLINE
+    impl::submission_fields
+    make_slot_fields (
+        std::size_t slot
+    );
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#endif // CMP_OS_LINUX_BASED
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/io/async_file.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_IO_ASYNC_FILE_HPP_INCLUDED
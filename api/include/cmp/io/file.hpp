@@ -149,6 +149,104 @@ public:
     is_at_end ()
     const noexcept override;
 
+    /**
+        Description:
+            Returns the position that <#this/> basic file is at. The
+            position is computed from values tracked in user space, so
+            no system call is made.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::int64_t
+    get_position ()
+    const noexcept override;
+
+    /**
+        Description:
+            Sets the position of <#this/> basic file to
+            <#parameter>new_position</#parameter>, relative to
+            <#parameter>pr</#parameter>. If the new position lies
+            within the bytes currently held in the buffer, the buffer
+            is kept and no system call is made.
+
+        Parameters:
+            new_position:
+                The new position of <#this/> basic file.
+            pr:
+                The reference that the new position is relative to.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    set_position (
+        std::int64_t new_position,
+        position_reference pr
+    )
+    noexcept override;
+
+    /**
+        Description:
+            Returns the end tracking mode of <#this/> basic file.
+    */
+    CMP_CONDITIONAL_INLINE
+    end_tracking
+    get_end_tracking ()
+    const noexcept;
+
+    /**
+        Description:
+            Sets the end tracking mode of <#this/> basic file. In the
+            <#enumerator>end_tracking::cached</#enumerator> mode, which
+            is the default, the size of the file is queried when it is
+            opened and afterwards only updated from the outcome of the
+            reads, writes and seeks made through <#this/> basic file.
+            In the <#enumerator>end_tracking::growing</#enumerator> mode,
+            the size of the file is queried from the operating system
+            again whenever the cached size says that the end has been
+            reached, which is useful when reading a file that another
+            process keeps appending to.
+
+        Parameters:
+            new_end_tracking:
+                The new end tracking mode of <#this/> basic file.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    set_end_tracking (
+        end_tracking new_end_tracking
+    )
+    noexcept;
+
+    /**
+        Description:
+            Returns the read-ahead mode of <#this/> basic file.
+    */
+    CMP_CONDITIONAL_INLINE
+    read_ahead
+    get_read_ahead ()
+    const noexcept;
+
+    /**
+        Description:
+            Sets the read-ahead mode of <#this/> basic file. In the
+            <#enumerator>read_ahead::none</#enumerator> mode, which is
+            the default, the buffer is filled when it runs out of bytes.
+            In the <#enumerator>read_ahead::background</#enumerator>
+            mode, a helper thread reads the next block of the file into
+            a second buffer while the current one is being consumed,
+            and the two buffers are swapped when the current one runs
+            out, which lets decoding overlap with waiting for the disk
+            when reading a file from start to end. Seeking and writing
+            drop the block read ahead.
+
+        Parameters:
+            new_read_ahead:
+                The new read-ahead mode of <#this/> basic file.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    set_read_ahead (
+        read_ahead new_read_ahead
+    );
+
     // Core -------------------------------------------------------------------
 
     /**
@@ -221,6 +319,23 @@ public:
     )
     override;
 
+    /**
+        Description:
+            Returns a view of at least <#parameter>min_bytes</#parameter>
+            bytes that <#this/> basic file would read next, or of all the
+            bytes left if there are fewer, without reading them.
+
+        Parameters:
+            min_bytes:
+                The minimum number of bytes that the view should hold.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::span<const std::byte>
+    peek_view (
+        std::size_t min_bytes = 1
+    )
+    override;
+
     /**
         Description:
             Writes <#parameter>byte_count</#parameter> bytes
@@ -241,12 +356,217 @@ public:
     )
     override;
 
+    /**
+        Description:
+            Writes the bytes of each of the given
+            <#parameter>pieces</#parameter> to <#this/> basic file, one
+            after the other. On platforms that support vectored writes,
+            the bytes waiting in the buffer and the pieces are written
+            with a single system call when they don't fit in the buffer.
+
+        Parameters:
+            pieces:
+                The spans of bytes that will be
+                written to <#this/> basic file.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    write_gather (
+        std::span<const std::span<const std::byte>> pieces
+    )
+    override;
+
+    /**
+        Description:
+            Reads up to <#parameter>data</#parameter>.size() bytes
+            starting at <#parameter>offset</#parameter> in the file into
+            <#parameter>data</#parameter> and returns the number of bytes
+            read, which is only less than requested if the end of the file
+            was reached or an error occurred. Neither the buffer nor the
+            position of <#this/> basic file is used or changed, so any
+            number of threads can call this function at once on the same
+            basic file, as long as none of them uses the other functions
+            that read, write or move the position.
+
+            Bytes waiting in the buffer to be written aren't visible to
+            this function until the buffer is flushed, so <#this/> basic
+            file has to be flushed first for them to be read.
+
+        Parameters:
+            offset:
+                The offset in the file to read from.
+            data:
+                The span into which the read bytes will be placed.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    read_at (
+        std::int64_t offset,
+        std::span<std::byte> data
+    )
+    const;
+
+    /**
+        Description:
+            Writes the bytes of <#parameter>data</#parameter> starting at
+            <#parameter>offset</#parameter> in the file and returns the
+            number of bytes written. Neither the buffer nor the position
+            of <#this/> basic file is used or changed, so any number of
+            threads can call this function at once on the same basic file,
+            as long as none of them uses the other functions that read,
+            write or move the position.
+
+            The cached size of the file isn't updated either, so if this
+            function writes past the cached end, the new end is only seen
+            once the size is queried again, for instance when seeking
+            relative to the end.
+
+            Bytes waiting in the buffer to be written are written over
+            the ones written by this function when the buffer is flushed,
+            wherever the two overlap, so <#this/> basic file has to be
+            flushed first for these bytes to stay. Bytes that the buffer,
+            or a block read ahead, already holds aren't refreshed either,
+            so the functions that read through the buffer may still give
+            the bytes that were there before.
+
+        Parameters:
+            offset:
+                The offset in the file to write at.
+            data:
+                The bytes that will be written to <#this/> basic file.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    write_at (
+        std::int64_t offset,
+        std::span<const std::byte> data
+    );
+
 protected:
+    // Protected Functions ----------------------------------------------------
+
+    /**
+        Description:
+            Asks the operating system for the current size of the file.
+
+            This functionality is platform-dependent and therefore this
+            function must be overridden in a platform-specific subclass.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    std::int64_t
+    query_size ()
+    const noexcept = 0;
+
+    /**
+        Description:
+            Reads bytes starting at <#parameter>offset</#parameter> into
+            <#parameter>data</#parameter> without using or changing the
+            native position, and returns the number of bytes read.
+
+            This functionality is platform-dependent and therefore this
+            function must be overridden in a platform-specific subclass.
+
+        Parameters:
+            offset:
+                The offset in the file to read from.
+            data:
+                The span into which the read bytes will be placed.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    std::size_t
+    read_at_raw (
+        std::int64_t offset,
+        std::span<std::byte> data
+    )
+    const noexcept = 0;
+
+    /**
+        Description:
+            Writes the bytes of <#parameter>data</#parameter> starting at
+            <#parameter>offset</#parameter> without using or changing the
+            native position, and returns the number of bytes written.
+
+            This functionality is platform-dependent and therefore this
+            function must be overridden in a platform-specific subclass.
+
+        Parameters:
+            offset:
+                The offset in the file to write at.
+            data:
+                The bytes to write.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    std::size_t
+    write_at_raw (
+        std::int64_t offset,
+        std::span<const std::byte> data
+    )
+    const noexcept = 0;
+
+    /**
+        Description:
+            Records that the native file position moved forward by
+            <#parameter>byte_count</#parameter> bytes because of a read
+            or a write, growing the cached file size if the new native
+            position lies past it.
+
+        Parameters:
+            byte_count:
+                The number of bytes that were read or written.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    advance_native_position (
+        std::size_t byte_count
+    )
+    noexcept;
+
+    /**
+        Description:
+            Waits for the block being read ahead, if there is one, and
+            drops it, moving the native position back to the end of the
+            bytes in the buffer.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    cancel_read_ahead ()
+    noexcept;
+
     // Protected Data ---------------------------------------------------------
 
     std::filesystem::path m_file_path;
     access_mode m_access_mode;
-    std::size_t m_last_fill_amount;
+    std::int64_t m_native_position;
+    std::int64_t m_file_size;
+    end_tracking m_end_tracking;
+
+private:
+    // Private Functions ------------------------------------------------------
+
+    /**
+        Description:
+            Writes out any bytes waiting in the buffer to be written,
+            so that the buffer can be filled with bytes read from the
+            file.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    prepare_for_reading ();
+
+    /**
+        Description:
+            Drops the bytes read into the buffer, moving the native
+            position back to the logical position first if some of
+            them haven't been read yet, so that the buffer can hold
+            bytes to be written to the file.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    prepare_for_writing ()
+    noexcept;
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
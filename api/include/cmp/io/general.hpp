@@ -44,6 +44,33 @@ enum class if_not_there {
     create
 }; // enum --------------------------------------------------------------------
 
+enum class end_tracking {
+    cached,
+    growing
+}; // enum --------------------------------------------------------------------
+
+enum class access_pattern {
+    normal,
+    sequential,
+    random
+}; // enum --------------------------------------------------------------------
+
+enum class buffer_sizing {
+    fixed,
+    adaptive
+}; // enum --------------------------------------------------------------------
+
+enum class read_ahead {
+    none,
+    background
+}; // enum --------------------------------------------------------------------
+
+enum class tie_flush {
+    on_refill,
+    always,
+    never
+}; // enum --------------------------------------------------------------------
+
 // Free Functions -------------------------------------------------------------
 
 /**
@@ -83,6 +110,67 @@ invert_endianness (
 )
 noexcept;
 
+/**
+    Description:
+        Reverses the order of the bytes in each of the elements in the
+        <#parameter>data</#parameter> array, which is what
+        <#function>invert_endianness</#function> would do to each of
+        them on its own. Elements of 2, 4 or 8 bytes are done in bulk.
+
+    Parameters:
+        data:
+            The array of elements to reverse the bytes of.
+        element_size:
+            The number of bytes in each element.
+        element_count:
+            The number of elements in the array.
+*/
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+void
+invert_endianness_of_elements (
+    std::byte* data,
+    std::size_t element_size,
+    std::size_t element_count
+)
+noexcept;
+
+namespace impl {
+
+/*
+    These reverse the order of the bytes in each of the given elements of
+    2, 4 and 8 bytes, with vector instructions where they're always there.
+*/
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+void
+invert_endianness_of_16_bit_elements (
+    std::byte* data,
+    std::size_t element_count
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+void
+invert_endianness_of_32_bit_elements (
+    std::byte* data,
+    std::size_t element_count
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+void
+invert_endianness_of_64_bit_elements (
+    std::byte* data,
+    std::size_t element_count
+)
+noexcept;
+
+} // namespace ----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
 
 #include <cmp/io/general.ipp>
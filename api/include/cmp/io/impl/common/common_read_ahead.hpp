@@ -0,0 +1,224 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_COMMON_READ_AHEAD_HPP_INCLUDED
+#define CMP_IO_COMMON_READ_AHEAD_HPP_INCLUDED
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/io/io_buffer.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+/**
+    Description:
+        A read-ahead worker owns a spare I/O buffer and, once enabled, a
+        helper thread that fills the spare buffer in the background
+        while the owner of the worker drains its own buffer. The two
+        buffers are then swapped, so no bytes are copied.
+
+        Copies of a read-ahead worker start out disabled, since a helper
+        thread can't be shared. Moving a read-ahead worker first waits
+        for the fill in flight, if there is one, to complete.
+*/
+class CMP_LIBRARY_NAME read_ahead_worker
+{
+public:
+    // Types ------------------------------------------------------------------
+
+    /**
+        Description:
+            The type of function that fills the spare buffer. It's given
+            the bytes to fill and returns the number of bytes it placed
+            in them.
+    */
+    using reader = std::function<std::size_t (std::byte*, std::size_t)>;
+
+    // Constructors and Destructor --------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    read_ahead_worker ()
+    noexcept;
+
+    CMP_CONDITIONAL_INLINE
+    ~read_ahead_worker ();
+
+    // Copy Operations --------------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    read_ahead_worker (
+        const read_ahead_worker& other
+    )
+    noexcept;
+
+    CMP_CONDITIONAL_INLINE
+    read_ahead_worker&
+    operator = (
+        const read_ahead_worker& other
+    )
+    noexcept;
+
+    // Move Operations --------------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    read_ahead_worker (
+        read_ahead_worker&& other
+    )
+    noexcept;
+
+    CMP_CONDITIONAL_INLINE
+    read_ahead_worker&
+    operator = (
+        read_ahead_worker&& other
+    )
+    noexcept;
+
+    // Accessors --------------------------------------------------------------
+
+    /**
+        Description:
+            Returns true if <#this/> read-ahead worker
+            has a helper thread. Otherwise, returns false.
+    */
+    CMP_CONDITIONAL_INLINE
+    bool
+    is_enabled ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns the spare buffer, which must only be used while
+            <#this/> read-ahead worker is enabled and after calling
+            <#function>wait</#function>.
+    */
+    CMP_CONDITIONAL_INLINE
+    io_buffer&
+    get_buffer ()
+    noexcept;
+
+    /**
+        Description:
+            Waits for the fill in flight, if there is one, and returns
+            the number of bytes in the spare buffer that haven't been
+            taken yet. If the reader threw an exception, this is zero
+            and the exception is left for <#function>wait</#function>.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    get_pending_count ()
+    const noexcept;
+
+    // Core -------------------------------------------------------------------
+
+    /**
+        Description:
+            Starts the helper thread if it isn't running yet.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    enable ();
+
+    /**
+        Description:
+            Waits for the fill in flight, if there is one, drops the
+            bytes in the spare buffer and stops the helper thread.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    disable ()
+    noexcept;
+
+    /**
+        Description:
+            Empties the spare buffer, resizes it to the given capacity
+            and has the helper thread fill it with the given reader.
+
+        Parameters:
+            capacity:
+                The capacity that the spare buffer should have.
+            fill_function:
+                The function that fills the spare buffer.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    start (
+        std::size_t capacity,
+        reader fill_function
+    );
+
+    /**
+        Description:
+            Waits for the fill in flight, if there is one, to complete.
+            If the reader threw an exception, it's rethrown here.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    wait ()
+    const;
+
+    /**
+        Description:
+            Waits for the fill in flight, if there is one, and drops
+            the bytes in the spare buffer, as well as the exception
+            that the reader threw, if it threw one.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    discard ()
+    noexcept;
+
+private:
+    // Private Types ----------------------------------------------------------
+
+    /*
+        Everything the helper thread touches lives on the heap, so that
+        moving the worker doesn't move anything out from under it.
+    */
+    struct shared_state {
+        io_buffer buffer{0};
+        std::mutex mutex;
+        std::condition_variable condition;
+        reader fill_function;
+        bool is_in_flight{false};
+        bool is_stopping{false};
+        std::exception_ptr exception;
+    }; // struct --------------------------------------------------------------
+
+    // Private Data -----------------------------------------------------------
+
+    std::unique_ptr<shared_state> m_state;
+    std::thread m_thread;
+
+    // Private Functions ------------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    static
+    void
+    run (
+        shared_state* state
+    );
+
+    CMP_CONDITIONAL_INLINE
+    void
+    wait_noexcept ()
+    const noexcept;
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/io/impl/common/common_read_ahead.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_IO_COMMON_READ_AHEAD_HPP_INCLUDED
@@ -4,6 +4,7 @@
 #ifndef CMP_IO_CTR_ESSENCE_HPP_INCLUDED
 #define CMP_IO_CTR_ESSENCE_HPP_INCLUDED
 
+#include <span>
 #include <string>
 
 #include <cmp/io/inclusion_assert.hpp>
@@ -70,7 +71,7 @@ protected:
         std::byte* data,
         std::size_t byte_count,
         read_request rr,
-        seekable_input_resource<std::int64_t>& resource
+        const io_buffer& buffer
     );
 
     std::size_t
@@ -78,6 +79,23 @@ protected:
         const std::byte* data,
         std::size_t byte_count
     );
+
+    std::size_t
+    read (
+        std::byte* data,
+        std::size_t byte_count
+    )
+    noexcept;
+
+    std::span<const std::byte>
+    peek_view ()
+    const noexcept;
+
+    void
+    consume (
+        std::size_t byte_count
+    )
+    noexcept;
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
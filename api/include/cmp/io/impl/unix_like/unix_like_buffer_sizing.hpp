@@ -0,0 +1,45 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_UNIX_LIKE_BUFFER_SIZING_HPP_INCLUDED
+#define CMP_IO_UNIX_LIKE_BUFFER_SIZING_HPP_INCLUDED
+
+#include <cstddef>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/core/platform.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+/**
+    Description:
+        Returns the number of bytes that the given file descriptor prefers
+        to transfer at once, which is the capacity of the pipe for pipes
+        on systems that can tell it and the block size reported by fstat
+        for regular files, block devices and other pipes. Returns zero for
+        anything else, such as terminals, whose transfers are driven by
+        the user rather than by the size of the buffer.
+
+    Parameters:
+        file_descriptor:
+            The file descriptor to query.
+*/
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+query_preferred_transfer_size (
+    int file_descriptor
+)
+noexcept;
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/io/impl/unix_like/unix_like_buffer_sizing.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_IO_UNIX_LIKE_BUFFER_SIZING_HPP_INCLUDED
@@ -5,10 +5,13 @@
 #define CMP_IO_UNIX_LIKE_FILE_HPP_INCLUDED
 
 #include <fcntl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <cmp/io/inclusion_assert.hpp>
 #include <cmp/io/file.hpp>
+#include <cmp/io/impl/unix_like/unix_like_buffer_sizing.hpp>
+#include <cmp/io/impl/unix_like/unix_like_write_gather.hpp>
 
 namespace cmp {
 
@@ -69,11 +72,6 @@ public:
     is_open ()
     const noexcept override;
 
-    CMP_CONDITIONAL_INLINE
-    std::int64_t
-    get_position ()
-    const noexcept override;
-
     // Core -------------------------------------------------------------------
 
     CMP_CONDITIONAL_INLINE
@@ -93,6 +91,32 @@ public:
 protected:
     // Protected Functions ----------------------------------------------------
 
+    CMP_CONDITIONAL_INLINE
+    std::int64_t
+    query_size ()
+    const noexcept override;
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    query_preferred_buffer_capacity ()
+    const noexcept override;
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    read_at_raw (
+        std::int64_t offset,
+        std::span<std::byte> data
+    )
+    const noexcept override;
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    write_at_raw (
+        std::int64_t offset,
+        std::span<const std::byte> data
+    )
+    const noexcept override;
+
     CMP_CONDITIONAL_INLINE
     void
     set_position_raw (
@@ -118,6 +142,14 @@ protected:
     )
     noexcept override;
 
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    write_gather_raw (
+        std::span<const std::byte> pending,
+        std::span<const std::span<const std::byte>> pieces
+    )
+    noexcept override;
+
 private:
     // Private Data -----------------------------------------------------------
 
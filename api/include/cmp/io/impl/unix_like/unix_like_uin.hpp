@@ -8,6 +8,7 @@
 
 #include <cmp/io/inclusion_assert.hpp>
 #include <cmp/core/platform.hpp>
+#include <cmp/io/impl/unix_like/unix_like_buffer_sizing.hpp>
 #include <cmp/io/impl/unix_like/unix_like_uout.hpp>
 #include <cmp/io/input_resource.hpp>
 #include <cmp/io/text_input_stream.hpp>
@@ -47,6 +48,14 @@ public:
         read_request rr
     )
     override;
+
+protected:
+    // Protected Functions ----------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    query_preferred_buffer_capacity ()
+    const noexcept override;
 }; // class -------------------------------------------------------------------
 
 class CMP_LIBRARY_NAME stdin_stream final
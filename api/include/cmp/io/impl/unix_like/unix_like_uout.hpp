@@ -9,6 +9,8 @@
 #include <cmp/io/inclusion_assert.hpp>
 #include <cmp/core/platform.hpp>
 #include <cmp/io/output_resource.hpp>
+#include <cmp/io/impl/unix_like/unix_like_buffer_sizing.hpp>
+#include <cmp/io/impl/unix_like/unix_like_write_gather.hpp>
 
 namespace cmp {
 
@@ -47,6 +49,22 @@ public:
     )
     override;
 
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    write_gather_raw (
+        std::span<const std::byte> pending,
+        std::span<const std::span<const std::byte>> pieces
+    )
+    override;
+
+protected:
+    // Protected Functions ----------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    query_preferred_buffer_capacity ()
+    const noexcept override;
+
 private:
     // Private Data -----------------------------------------------------------
 
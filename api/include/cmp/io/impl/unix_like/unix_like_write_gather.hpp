@@ -0,0 +1,53 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_UNIX_LIKE_WRITE_GATHER_HPP_INCLUDED
+#define CMP_IO_UNIX_LIKE_WRITE_GATHER_HPP_INCLUDED
+
+#include <cstddef>
+#include <span>
+
+#include <sys/uio.h>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/core/platform.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+/**
+    Description:
+        Writes the <#parameter>pending</#parameter> bytes followed by the
+        bytes of each of the given <#parameter>pieces</#parameter> to the
+        given file descriptor with as few calls to writev as possible,
+        and returns the total number of bytes written. Partial writes
+        are resumed until everything is written or an error occurs.
+
+    Parameters:
+        file_descriptor:
+            The file descriptor to write to.
+        pending:
+            The bytes to write first.
+        pieces:
+            The spans of bytes to write after the pending bytes.
+*/
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+write_gather_to_descriptor (
+    int file_descriptor,
+    std::span<const std::byte> pending,
+    std::span<const std::span<const std::byte>> pieces
+)
+noexcept;
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/io/impl/unix_like/unix_like_write_gather.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_IO_UNIX_LIKE_WRITE_GATHER_HPP_INCLUDED
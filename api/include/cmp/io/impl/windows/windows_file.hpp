@@ -68,11 +68,6 @@ public:
     is_open ()
     const noexcept override;
 
-    CMP_CONDITIONAL_INLINE
-    std::int64_t
-    get_position ()
-    const noexcept override;
-
     // Core -------------------------------------------------------------------
 
     CMP_CONDITIONAL_INLINE
@@ -92,6 +87,27 @@ public:
 protected:
     // Protected Function -----------------------------------------------------
 
+    CMP_CONDITIONAL_INLINE
+    std::int64_t
+    query_size ()
+    const noexcept override;
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    read_at_raw (
+        std::int64_t offset,
+        std::span<std::byte> data
+    )
+    const noexcept override;
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    write_at_raw (
+        std::int64_t offset,
+        std::span<const std::byte> data
+    )
+    const noexcept override;
+
     CMP_CONDITIONAL_INLINE
     void
     set_position_raw (
@@ -127,18 +143,20 @@ private:
     CMP_CONDITIONAL_INLINE
     DWORD
     read_block (
+        std::int64_t offset,
         std::byte* data,
         DWORD byte_count
     )
-    noexcept;
+    const noexcept;
 
     CMP_CONDITIONAL_INLINE
     DWORD
     write_block (
+        std::int64_t offset,
         const std::byte* data,
         DWORD byte_count
     )
-    noexcept;
+    const noexcept;
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
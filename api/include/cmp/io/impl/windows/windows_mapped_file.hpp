@@ -0,0 +1,105 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_WINDOWS_MAPPED_FILE_HPP_INCLUDED
+#define CMP_IO_WINDOWS_MAPPED_FILE_HPP_INCLUDED
+
+#include <Windows.h>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/io/mapped_file.hpp>
+
+namespace cmp {
+
+class CMP_LIBRARY_NAME mapped_file final
+    : public basic_mapped_file
+{
+public:
+    // Constructors and Destructor --------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    mapped_file ()
+    noexcept;
+
+    CMP_CONDITIONAL_INLINE
+    explicit
+    mapped_file (
+        const std::filesystem::path& file_path,
+        access_pattern pattern = access_pattern::normal
+    );
+
+    CMP_CONDITIONAL_INLINE
+    ~mapped_file ()
+    override;
+
+    // Copy Operations --------------------------------------------------------
+
+    mapped_file (
+        const mapped_file& other
+    )
+    = delete;
+
+    mapped_file&
+    operator = (
+        const mapped_file& other
+    )
+    = delete;
+
+    // Move Operations --------------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    mapped_file (
+        mapped_file&& other
+    )
+    noexcept;
+
+    CMP_CONDITIONAL_INLINE
+    mapped_file&
+    operator = (
+        mapped_file&& other
+    )
+    noexcept;
+
+    // Accessors --------------------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    bool
+    is_open ()
+    const noexcept override;
+
+    // Core -------------------------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    bool
+    open (
+        const std::filesystem::path& file_path
+    )
+    noexcept override;
+
+    CMP_CONDITIONAL_INLINE
+    void
+    close ()
+    noexcept override;
+
+protected:
+    // Protected Functions ----------------------------------------------------
+
+    CMP_CONDITIONAL_INLINE
+    void
+    apply_access_pattern ()
+    noexcept override;
+
+private:
+    // Private Data -----------------------------------------------------------
+
+    HANDLE m_file_handle;
+    HANDLE m_mapping_handle;
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/io/impl/windows/windows_mapped_file.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_IO_WINDOWS_MAPPED_FILE_HPP_INCLUDED
@@ -5,10 +5,12 @@
 #define CMP_IO_INPUT_RESOURCE_HPP_INCLUDED
 
 #include <cstddef>
+#include <span>
 
 #include <cmp/io/inclusion_assert.hpp>
 #include <cmp/io/general.hpp>
 #include <cmp/io/output_resource.hpp>
+#include <cmp/io/impl/common/common_read_ahead.hpp>
 
 namespace cmp {
 
@@ -112,6 +114,42 @@ public:
     )
     noexcept = default;
 
+    // Accessors --------------------------------------------------------------
+
+    /**
+        Description:
+            Returns the tie-flush policy of <#this/> input resource.
+    */
+    CMP_CONDITIONAL_INLINE
+    tie_flush
+    get_tie_flush ()
+    const noexcept;
+
+    /**
+        Description:
+            Sets the tie-flush policy of <#this/> input resource, which
+            tells when the tied output resource is flushed. In the
+            <#enumerator>tie_flush::on_refill</#enumerator> policy, which
+            is the default, it's flushed whenever <#this/> input resource
+            has to go to the underlying resource for more bytes, so a
+            prompt is still written before waiting for the answer, but
+            reads that the buffer serves cost nothing extra. In the
+            <#enumerator>tie_flush::always</#enumerator> policy, it's
+            flushed on every read, and in the
+            <#enumerator>tie_flush::never</#enumerator> policy, it's
+            never flushed.
+
+        Parameters:
+            new_tie_flush:
+                The new tie-flush policy of <#this/> input resource.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    set_tie_flush (
+        tie_flush new_tie_flush
+    )
+    noexcept;
+
     // Core -------------------------------------------------------------------
 
     /**
@@ -134,11 +172,55 @@ public:
         std::size_t byte_count
     );
 
+    /**
+        Description:
+            Returns a view of the bytes that <#this/> input resource
+            would read next, without reading them. The view holds at least
+            <#parameter>min_bytes</#parameter> bytes unless the end of
+            <#this/> input resource is reached first, in which case it
+            holds all the bytes that are left. If the buffer doesn't hold
+            enough bytes, it's refilled, keeping the bytes that haven't
+            been read yet, and it's grown if it's too small to hold
+            <#parameter>min_bytes</#parameter> bytes.
+
+            The view points into the buffer, so it's invalidated by any
+            other operation on <#this/> input resource. Use
+            <#function>consume</#function> to mark bytes as read.
+
+        Parameters:
+            min_bytes:
+                The minimum number of bytes that the view should hold.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    std::span<const std::byte>
+    peek_view (
+        std::size_t min_bytes = 1
+    );
+
+    /**
+        Description:
+            Marks the first <#parameter>byte_count</#parameter> bytes of
+            the view last returned by <#function>peek_view</#function> as
+            read. Passing a count greater than the size of that view is
+            treated as passing the size of that view.
+
+        Parameters:
+            byte_count:
+                The number of bytes to mark as read.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    void
+    consume (
+        std::size_t byte_count
+    );
+
     /**
         Description:
             Ties the given output resource to <#this/> input resource.
             The tied output resource is flushed when <#this/> input
-            resource is read from.
+            resource is read from, as the tie-flush policy dictates.
     */
     CMP_CONDITIONAL_INLINE
     void
@@ -177,16 +259,47 @@ protected:
 
     /**
         Description:
-            Fills the buffer and returns the number of bytes read.
+            Fills the buffer and returns the number of bytes read. The
+            bytes in the buffer that haven't been read yet are kept at
+            its beginning and the new bytes are placed after them. The
+            tied output resource is flushed first.
+
+            When <#function>read_raw</#function> is called with
+            <#enumerator>read_request::fill_buffer</#enumerator>, the size
+            of the buffer is the number of bytes that were kept, so that
+            seekable resources can account for them in their position.
+
+            When the read-ahead worker is enabled, the bytes come from the
+            spare buffer that it filled in the background, which is
+            swapped with the buffer if no bytes were kept, and the next
+            fill of the spare buffer is started right away. In that case,
+            <#function>read_raw</#function> is called from the helper
+            thread, and the size of the buffer tells nothing.
     */
     CMP_CONDITIONAL_INLINE
     std::size_t
     fill ();
 
+    /**
+        Description:
+            Flushes the output resource tied to <#this/> input resource,
+            if there is one and the tie-flush policy isn't
+            <#enumerator>tie_flush::never</#enumerator>. This is meant
+            to be called right before going to the underlying resource.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    flush_tied_resource ();
+
+    // Protected Data ---------------------------------------------------------
+
+    impl::read_ahead_worker m_read_ahead;
+
 private:
     // Private Data -----------------------------------------------------------
 
     output_resource* m_tied_resource;
+    tie_flush m_tie_flush;
 
     // Private Functions ------------------------------------------------------
 
@@ -196,6 +309,12 @@ private:
         std::byte* data,
         std::size_t byte_count
     );
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    fill_from_read_ahead (
+        std::size_t kept_byte_count
+    );
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -4,6 +4,7 @@
 #ifndef CMP_IO_IO_BUFFER_HPP_INCLUDED
 #define CMP_IO_IO_BUFFER_HPP_INCLUDED
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -125,6 +126,22 @@ public:
     get_capacity ()
     const noexcept;
 
+    /**
+        Description:
+            Sets the capacity of <#this/> I/O buffer. The bytes that are
+            currently in <#this/> I/O buffer are kept as long as they fit
+            in the new capacity.
+
+        Parameters:
+            new_capacity:
+                The new capacity of <#this/> I/O buffer.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    set_capacity (
+        std::size_t new_capacity
+    );
+
     /**
         Description:
             Returns the size of <#this/> I/O buffer.
@@ -272,6 +289,18 @@ public:
         std::size_t byte_count
     );
 
+    /**
+        Description:
+            Moves the bytes that haven't been read yet to the beginning
+            of <#this/> I/O buffer, making room for more bytes after them.
+            The position is set to zero and the size is set to the number
+            of bytes that were kept, which is also returned.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    compact ()
+    noexcept;
+
 private:
     // Private Data -----------------------------------------------------------
 
@@ -0,0 +1,425 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_IO_RING_HPP_INCLUDED
+#define CMP_IO_IO_RING_HPP_INCLUDED
+
+#include <coroutine>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/core/platform.hpp>
+#include <cmp/io/io_buffer.hpp>
+
+#if defined(CMP_OS_LINUX_BASED)
+
+#include <linux/io_uring.h>
+
+namespace cmp {
+
+class async_file;
+
+namespace impl {
+
+/*
+    The fields of a submission queue entry that a request fills in.
+    io_ring::queue copies them into the entry itself, so that
+    io_uring_sqe, whose zero-length array member pedantic builds warn
+    about, is never held by value outside of the I/O ring.
+*/
+struct submission_fields {
+    std::uint8_t opcode;
+    int file_descriptor;
+    std::uint64_t offset;
+    std::uint64_t address;
+    std::uint32_t length;
+    std::uint16_t buffer_index;
+}; // struct ------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+/**
+    Description:
+        An I/O ring is a pair of queues shared with the operating system
+        through which asynchronous reads and writes are submitted and their
+        completions are collected, using Linux's io_uring interface. Any
+        number of <#type>async_file</#type> objects can submit requests
+        through the same I/O ring, which keeps many requests in flight at
+        once with a single system call per batch.
+
+        Requests are only handed to the operating system when
+        <#function>submit</#function>, <#function>poll</#function> or
+        <#function>wait</#function> is called, and completion handlers
+        run and awaiting coroutines resume from within
+        <#function>poll</#function> and <#function>wait</#function>,
+        on the thread that calls them.
+
+        An I/O ring can also own a number of slots, which are I/O buffers
+        that are registered with the operating system once so that reads
+        into them skip the per-request mapping of the destination memory.
+*/
+class CMP_LIBRARY_NAME io_ring
+{
+public:
+    // Types ------------------------------------------------------------------
+
+    /**
+        Description:
+            The type of function called when a request completes. It's
+            given the number of bytes transferred, or a negated errno
+            value if the request failed.
+    */
+    using completion_handler = std::function<void (std::int64_t result)>;
+
+    /**
+        Description:
+            An awaitable is what a coroutine awaits to suspend until a
+            request completes. The request is queued when the coroutine
+            suspends, and awaiting it yields the number of bytes that
+            were transferred. If the request fails, a
+            <#type>std::system_error</#type> is thrown instead.
+    */
+    class CMP_LIBRARY_NAME awaitable
+    {
+    public:
+        // Core ---------------------------------------------------------------
+
+        /**
+            Description:
+                Returns false, since a request has to be queued
+                before it can complete.
+        */
+        CMP_CONDITIONAL_INLINE
+        bool
+        await_ready ()
+        const noexcept;
+
+        /**
+            Description:
+                Queues the request, arranging for the given
+                coroutine to be resumed once it completes.
+
+            Parameters:
+                handle:
+                    The handle of the coroutine that is awaiting.
+        */
+        CMP_CONDITIONAL_INLINE
+        void
+        await_suspend (
+            std::coroutine_handle<> handle
+        );
+
+        /**
+            Description:
+                Returns the number of bytes transferred by the request,
+                or throws a <#type>std::system_error</#type> if it failed.
+        */
+        CMP_CONDITIONAL_INLINE
+        std::size_t
+        await_resume ()
+        const;
+
+    private:
+        // Private Data -------------------------------------------------------
+
+        io_ring* m_ring;
+        impl::submission_fields m_fields;
+        std::size_t m_slot;
+        std::coroutine_handle<> m_handle;
+        std::int64_t m_result;
+
+        // Private Functions --------------------------------------------------
+
+        friend class io_ring;
+        friend class async_file;
+
+        CMP_CONDITIONAL_INLINE
+        awaitable (
+            io_ring& ring,
+            const impl::submission_fields& fields,
+            std::size_t slot
+        )
+        noexcept;
+    }; // class ---------------------------------------------------------------
+
+    // Constants --------------------------------------------------------------
+
+    /**
+        Description:
+            The number of requests that an I/O ring can have in
+            flight at once unless a different number is requested.
+    */
+    static constexpr unsigned default_queue_depth{64};
+
+    /**
+        Description:
+            The slot index of requests that don't read into a slot.
+    */
+    static constexpr std::size_t no_slot{
+        std::numeric_limits<std::size_t>::max()
+    };
+
+    // Constructors and Destructor --------------------------------------------
+
+    /**
+        Description:
+            Sets up an I/O ring with room for the given number of requests
+            in flight and the given number of slots. If the operating system
+            refuses to set up the ring, a <#type>std::system_error</#type>
+            is thrown.
+
+        Parameters:
+            queue_depth:
+                The number of requests that can be in flight at once. The
+                operating system may round this up to a power of two.
+            slot_count:
+                The number of slots to create and register.
+            slot_capacity:
+                The capacity of each slot, in bytes.
+    */
+    CMP_CONDITIONAL_INLINE
+    explicit
+    io_ring (
+        unsigned queue_depth = default_queue_depth,
+        std::size_t slot_count = 0,
+        std::size_t slot_capacity = io_buffer::default_buffer_capacity
+    );
+
+    /**
+        Description:
+            Waits for all the requests in flight to complete,
+            without running their completion handlers, and
+            tears down <#this/> I/O ring.
+    */
+    CMP_CONDITIONAL_INLINE
+    ~io_ring ();
+
+    // Copy Operations --------------------------------------------------------
+
+    io_ring (
+        const io_ring& other
+    )
+    = delete;
+
+    io_ring&
+    operator = (
+        const io_ring& other
+    )
+    = delete;
+
+    // Move Operations --------------------------------------------------------
+
+    io_ring (
+        io_ring&& other
+    )
+    = delete;
+
+    io_ring&
+    operator = (
+        io_ring&& other
+    )
+    = delete;
+
+    // Accessors --------------------------------------------------------------
+
+    /**
+        Description:
+            Returns the number of requests that have been queued
+            but whose completions haven't been processed yet.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    get_outstanding_count ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns the number of slots owned by <#this/> I/O ring.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    get_slot_count ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns true if the slots were registered with the operating
+            system. Registration can fail, for example when it would
+            exceed the limit on locked memory, in which case reads into
+            the slots still work but take the regular path.
+    */
+    CMP_CONDITIONAL_INLINE
+    bool
+    are_slots_registered ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns a view of the bytes that the last completed read
+            into the given slot placed in it.
+
+        Parameters:
+            slot:
+                The index of the slot.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::span<const std::byte>
+    get_slot_view (
+        std::size_t slot
+    )
+    noexcept;
+
+    // Core -------------------------------------------------------------------
+
+    /**
+        Description:
+            Hands all the queued requests to the operating
+            system and returns the number handed over.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    submit ();
+
+    /**
+        Description:
+            Submits the queued requests and processes the completions
+            that are already available, without waiting for more.
+            Returns the number of completions processed.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    poll ();
+
+    /**
+        Description:
+            Submits the queued requests and waits until at least
+            <#parameter>min_completions</#parameter> completions are
+            available, or fewer if fewer requests are outstanding, then
+            processes all the available completions. Returns the number
+            of completions processed.
+
+        Parameters:
+            min_completions:
+                The number of completions to wait for.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    wait (
+        std::size_t min_completions = 1
+    );
+
+    /**
+        Description:
+            Keeps waiting for completions until no request is outstanding,
+            including the requests queued by completion handlers and
+            resumed coroutines along the way.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    drain ();
+
+private:
+    // Private Types ----------------------------------------------------------
+
+    struct request {
+        completion_handler handler;
+        awaitable* awaiter;
+        std::size_t slot;
+    }; // struct --------------------------------------------------------------
+
+    // Private Data -----------------------------------------------------------
+
+    int m_ring_descriptor;
+    unsigned m_entry_count;
+
+    void* m_submission_ring;
+    std::size_t m_submission_ring_size;
+    unsigned* m_submission_head;
+    unsigned* m_submission_tail;
+    unsigned m_submission_mask;
+    unsigned* m_submission_array;
+    io_uring_sqe* m_submission_entries;
+    unsigned m_unsubmitted_count;
+
+    void* m_completion_ring;
+    std::size_t m_completion_ring_size;
+    unsigned* m_completion_head;
+    unsigned* m_completion_tail;
+    unsigned m_completion_mask;
+    io_uring_cqe* m_completion_entries;
+
+    std::vector<request> m_requests;
+    std::vector<std::uint32_t> m_free_requests;
+
+    std::vector<io_buffer> m_slots;
+    bool m_slots_registered;
+
+    // Private Functions ------------------------------------------------------
+
+    friend class async_file;
+
+    /**
+        Description:
+            Queues the request described by <#parameter>fields</#parameter>,
+            to be completed either by calling
+            <#parameter>handler</#parameter> or by resuming
+            <#parameter>awaiter</#parameter>. If the request reads into
+            a slot, <#parameter>slot</#parameter> is its index, and
+            otherwise it's <#function>no_slot</#function>. If all the
+            requests are in flight, waits for one of them to complete
+            first.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    queue (
+        const impl::submission_fields& fields,
+        std::size_t slot,
+        completion_handler handler,
+        awaitable* awaiter
+    );
+
+    /**
+        Description:
+            Fills in the fields of a request that reads into the given
+            slot, using the registered buffer if registration succeeded.
+    */
+    CMP_CONDITIONAL_INLINE
+    impl::submission_fields
+    make_slot_read_fields (
+        int file_descriptor,
+        std::int64_t offset,
+        std::size_t slot
+    )
+    noexcept;
+
+    CMP_CONDITIONAL_INLINE
+    int
+    enter (
+        unsigned submit_count,
+        unsigned min_completions
+    )
+    noexcept;
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    process_completions ();
+
+    CMP_CONDITIONAL_INLINE
+    void
+    tear_down ()
+    noexcept;
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#endif // CMP_OS_LINUX_BASED
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/io/io_ring.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_IO_IO_RING_HPP_INCLUDED
@@ -0,0 +1,338 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_MAPPED_FILE_HPP_INCLUDED
+#define CMP_IO_MAPPED_FILE_HPP_INCLUDED
+
+#include <filesystem>
+#include <span>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/core/platform.hpp>
+#include <cmp/io/general.hpp>
+#include <cmp/io/seekable_input_resource.hpp>
+
+namespace cmp {
+
+/**
+    Description:
+        This class serves as a base class for classes that implement the
+        platform-specific code for mapping files into memory. All
+        platform-specific subclasses of <#type>basic_mapped_file</#type>
+        are called simply <#type>mapped_file</#type> so that code that uses
+        them stays the same across all platforms.
+
+        A mapped file is a read-only input resource that reads straight
+        from the pages that the operating system maps the file into,
+        so no I/O buffer is used and no bytes are copied into one.
+        Seeking only changes a position kept in user space.
+*/
+class CMP_LIBRARY_NAME basic_mapped_file
+    : public seekable_input_resource<std::int64_t>
+{
+public:
+    // Constructors and Destructor --------------------------------------------
+
+    /**
+        Description:
+            Constructs a <#type>basic_mapped_file</#type> object not
+            associated with any file, with the given access pattern.
+
+        Parameters:
+            pattern:
+                The access pattern to advise the operating
+                system of once a file is mapped.
+    */
+    CMP_CONDITIONAL_INLINE
+    explicit
+    basic_mapped_file (
+        access_pattern pattern = access_pattern::normal
+    )
+    noexcept;
+
+    CMP_CONDITIONAL_INLINE
+    ~basic_mapped_file ()
+    override = default;
+
+    // Copy Operations --------------------------------------------------------
+
+    basic_mapped_file (
+        const basic_mapped_file& other
+    )
+    = delete;
+
+    basic_mapped_file&
+    operator = (
+        const basic_mapped_file& other
+    )
+    = delete;
+
+    // Move Operations --------------------------------------------------------
+
+    /**
+        Description:
+            Move-constructs a <#type>basic_mapped_file</#type>
+            from an existing one, which is left not
+            associated with any file.
+
+        Parameters:
+            other:
+                The <#type>basic_mapped_file</#type>
+                to move from.
+    */
+    CMP_CONDITIONAL_INLINE
+    basic_mapped_file (
+        basic_mapped_file&& other
+    )
+    noexcept;
+
+    /**
+        Description:
+            Move-assigns a <#type>basic_mapped_file</#type>
+            into <#this/> one. The other one is left not
+            associated with any file.
+
+        Parameters:
+            other:
+                The <#type>basic_mapped_file</#type>
+                to move from.
+    */
+    CMP_CONDITIONAL_INLINE
+    basic_mapped_file&
+    operator = (
+        basic_mapped_file&& other
+    )
+    noexcept;
+
+    // Accessors --------------------------------------------------------------
+
+    /**
+        Description:
+            Returns true if a file is open. Otherwise, returns false.
+
+            This functionality is platform-dependent and therefore this
+            function must be overridden in a platform-specific subclass.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    bool
+    is_open ()
+    const noexcept = 0;
+
+    /**
+        Description:
+            Returns true if <#this/> mapped file is at the end of the
+            mapped file. Otherwise, returns false.
+    */
+    CMP_CONDITIONAL_INLINE
+    bool
+    is_at_end ()
+    const noexcept override;
+
+    /**
+        Description:
+            Returns the position that <#this/> mapped file is at.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::int64_t
+    get_position ()
+    const noexcept override;
+
+    /**
+        Description:
+            Returns the size of the mapped file, which is
+            the size that the file had when it was opened.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::int64_t
+    get_size ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns a view of all the bytes of the mapped file. The view
+            is invalidated when <#this/> mapped file is closed.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::span<const std::byte>
+    get_view ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns the access pattern of <#this/> mapped file.
+    */
+    CMP_CONDITIONAL_INLINE
+    access_pattern
+    get_access_pattern ()
+    const noexcept;
+
+    /**
+        Description:
+            Sets the access pattern of <#this/> mapped file and advises
+            the operating system of it if a file is mapped. With
+            <#enumerator>access_pattern::sequential</#enumerator>, pages
+            are read ahead aggressively and dropped soon after they're
+            read, and with <#enumerator>access_pattern::random</#enumerator>,
+            read-ahead is turned off. On Windows, the access pattern can
+            only be given when the file is opened, so a new one takes
+            effect the next time a file is opened.
+
+        Parameters:
+            new_access_pattern:
+                The new access pattern of <#this/> mapped file.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    set_access_pattern (
+        access_pattern new_access_pattern
+    )
+    noexcept;
+
+    // Core -------------------------------------------------------------------
+
+    /**
+        Description:
+            Opens the file at the given path and maps it into memory for
+            reading. Returns true if mapping the file succeeds. Otherwise,
+            returns false.
+
+            This functionality is platform-dependent and therefore this
+            function must be overridden in a platform-specific subclass.
+
+        Parameters:
+            file_path:
+                The path to the file to map.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    bool
+    open (
+        const std::filesystem::path& file_path
+    )
+    noexcept = 0;
+
+    /**
+        Description:
+            Unmaps and closes the mapped file.
+
+            This functionality is platform-dependent and therefore this
+            function must be overridden in a platform-specific subclass.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    void
+    close ()
+    noexcept = 0;
+
+    /**
+        Description:
+            Reads <#parameter>byte_count</#parameter> bytes from
+            <#this/> mapped file and places them in the provided
+            <#parameter>data</#parameter> array. The bytes are copied
+            straight from the mapping.
+
+        Parameters:
+            data:
+                The array into which the read bytes will be placed.
+            byte_count:
+                The number of bytes to read from <#this/> mapped file.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    read (
+        std::byte* data,
+        std::size_t byte_count
+    )
+    override;
+
+    /**
+        Description:
+            Returns a view of all the bytes of the mapped file from the
+            current position to its end. The view points straight into
+            the mapping, so no bytes are copied.
+
+        Parameters:
+            min_bytes:
+                Unused, since the view always holds all the
+                bytes that are left in the mapped file.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::span<const std::byte>
+    peek_view (
+        std::size_t min_bytes = 1
+    )
+    override;
+
+    /**
+        Description:
+            Advances the position of <#this/> mapped file by
+            <#parameter>byte_count</#parameter> bytes, up to
+            the end of the mapped file.
+
+        Parameters:
+            byte_count:
+                The number of bytes to mark as read.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    consume (
+        std::size_t byte_count
+    )
+    override;
+
+protected:
+    // Protected Functions ----------------------------------------------------
+
+    /**
+        Description:
+            Advises the operating system of the access pattern of
+            <#this/> mapped file.
+
+            This functionality is platform-dependent and therefore this
+            function must be overridden in a platform-specific subclass.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    void
+    apply_access_pattern ()
+    noexcept = 0;
+
+    CMP_CONDITIONAL_INLINE
+    void
+    set_position_raw (
+        std::int64_t new_position,
+        position_reference pr
+    )
+    noexcept override;
+
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    read_raw (
+        std::byte* data,
+        std::size_t byte_count,
+        read_request rr
+    )
+    override;
+
+    // Protected Data ---------------------------------------------------------
+
+    const std::byte* m_data;
+    std::int64_t m_size;
+    std::int64_t m_position;
+    access_pattern m_access_pattern;
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/io/mapped_file.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#if defined(CMP_OS_WINDOWS)
+#   include <cmp/io/impl/windows/windows_mapped_file.hpp>
+#elif defined(CMP_OS_UNIX_LIKE)
+#   include <cmp/io/impl/unix_like/unix_like_mapped_file.hpp>
+#endif
+
+#endif // CMP_IO_MAPPED_FILE_HPP_INCLUDED
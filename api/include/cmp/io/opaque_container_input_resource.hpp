@@ -4,6 +4,7 @@
 #ifndef CMP_IO_OPAQUE_CONTAINER_INPUT_RESOURCE_HPP_INCLUDED
 #define CMP_IO_OPAQUE_CONTAINER_INPUT_RESOURCE_HPP_INCLUDED
 
+#include <span>
 #include <string>
 
 #include <cmp/io/inclusion_assert.hpp>
@@ -52,8 +53,8 @@ public:
 
         Parameters:
             buffer_capacity:
-                The capacity of the I/O buffer. If this is zero, the
-                opaque container input resource is completely unbuffered.
+                The capacity of the I/O buffer. Reads are served
+                straight from the content, so the buffer is unused.
     */
     explicit
     opaque_container_input_resource (
@@ -70,8 +71,8 @@ public:
                 The content that <#this/> opaque
                 container input resource will reference.
             buffer_capacity:
-                The capacity of the I/O buffer. If this is zero, the
-                opaque container input resource is completely unbuffered.
+                The capacity of the I/O buffer. Reads are served
+                straight from the content, so the buffer is unused.
     */
     explicit
     opaque_container_input_resource (
@@ -89,8 +90,8 @@ public:
                 The content that <#this/> opaque
                 container input resource will reference.
             buffer_capacity:
-                The capacity of the I/O buffer. If this is zero, the
-                opaque container input resource is completely unbuffered.
+                The capacity of the I/O buffer. Reads are served
+                straight from the content, so the buffer is unused.
     */
     explicit
     opaque_container_input_resource (
@@ -197,6 +198,63 @@ public:
     grab_content ()
     const noexcept;
 
+    // Core -------------------------------------------------------------------
+
+    /**
+        Description:
+            Reads <#parameter>byte_count</#parameter> bytes from <#this/>
+            opaque container input resource and places them in the provided
+            <#parameter>data</#parameter> array. The bytes are copied straight
+            from the content, bypassing the I/O buffer.
+
+        Parameters:
+            data:
+                The array into which the read bytes will be placed.
+            byte_count:
+                The number of bytes to read from
+                <#this/> opaque container input resource.
+    */
+    std::size_t
+    read (
+        std::byte* data,
+        std::size_t byte_count
+    )
+    override;
+
+    /**
+        Description:
+            Returns a view of all the bytes of the content from the
+            current position to its end. The view points straight into
+            the content, so no bytes are copied, and it's invalidated
+            by any operation that modifies the content.
+
+        Parameters:
+            min_bytes:
+                Unused, since the view always holds all the
+                bytes that are left in the content.
+    */
+    std::span<const std::byte>
+    peek_view (
+        std::size_t min_bytes = 1
+    )
+    override;
+
+    /**
+        Description:
+            Advances the position of <#this/> opaque container input resource
+            by <#parameter>byte_count</#parameter> bytes, up to
+            the end of the content.
+
+        Parameters:
+            byte_count:
+                The number of bytes to mark as read.
+    */
+    void
+    consume (
+        std::size_t byte_count
+    )
+    override;
+
 protected:
     // Protected Types --------------------------------------------------------
 
@@ -5,6 +5,7 @@
 #define CMP_IO_OUTPUT_RESOURCE_HPP_INCLUDED
 
 #include <cstddef>
+#include <span>
 
 #include <cmp/io/inclusion_assert.hpp>
 #include <cmp/io/transfer_resource.hpp>
@@ -134,6 +135,28 @@ public:
         std::size_t byte_count
     );
 
+    /**
+        Description:
+            Writes the bytes of each of the given
+            <#parameter>pieces</#parameter> to <#this/> output resource,
+            one after the other, and returns the number of bytes written.
+            If they all fit in the buffer, they're copied into it.
+            Otherwise, the bytes waiting in the buffer and the pieces are
+            handed to the resource together, so that resources that
+            support vectored writes can write them all at once.
+
+        Parameters:
+            pieces:
+                The spans of bytes that will be
+                written to <#this/> output resource.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    std::size_t
+    write_gather (
+        std::span<const std::span<const std::byte>> pieces
+    );
+
     /**
         Description:
             Flushes <#this/> output resource, ensuring that any data that
@@ -169,6 +192,31 @@ protected:
     )
     = 0;
 
+    /**
+        Description:
+            Writes the <#parameter>pending</#parameter> bytes, which are
+            the bytes that were waiting in the buffer, followed by the
+            bytes of each of the given <#parameter>pieces</#parameter>
+            to <#this/> output resource, and returns the total number of
+            bytes written. By default, this calls
+            <#function>write_raw</#function> once for every non-empty
+            span, but resources that support vectored writes override it
+            to write them all at once.
+
+        Parameters:
+            pending:
+                The bytes that were waiting in the buffer.
+            pieces:
+                The spans of bytes to write after the pending bytes.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    std::size_t
+    write_gather_raw (
+        std::span<const std::byte> pending,
+        std::span<const std::span<const std::byte>> pieces
+    );
+
 private:
     // Private Functions ------------------------------------------------------
 
@@ -4,7 +4,17 @@
 #ifndef CMP_IO_TEXT_INPUT_STREAM_HPP_INCLUDED
 #define CMP_IO_TEXT_INPUT_STREAM_HPP_INCLUDED
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
 #include <cmp/io/inclusion_assert.hpp>
+#include <cmp/io/general.hpp>
 #include <cmp/io/input_stream.hpp>
 #include <cmp/unicode/impl/impl.hpp>
 #include <cmp/unicode/algorithms.hpp>
@@ -193,6 +203,57 @@ public:
         TargetString& target
     );
 
+    /**
+        Description:
+            Reads a line and returns a view of it. When the source text is
+            UTF-8 and the whole line is in the buffer of the resource, the
+            view refers to it there and nothing is copied; otherwise the
+            line is read into storage held by <#this/> text input stream.
+            Either way, the view is only valid until the next operation on
+            <#this/> text input stream or on its resource.
+    */
+    std::u8string_view
+    read_line ();
+
+    /**
+        Description:
+            Skips the delimiters at the current position, reads a token,
+            which runs up to the next delimiter or to the end of the text,
+            and returns a view of it. The delimiter after the token is
+            read too, the way it is by the operator that reads strings.
+            When the source text is UTF-8 and the whole token is in the
+            buffer of the resource, the view refers to it there and
+            nothing is copied; otherwise the token is read into storage
+            held by <#this/> text input stream. Either way, the view is
+            only valid until the next operation on <#this/> text input
+            stream or on its resource.
+
+        Parameters:
+            delimiters:
+                The characters that separate tokens, which have to be
+                ASCII characters.
+    */
+    std::u8string_view
+    read_token (
+        std::u8string_view delimiters
+    );
+
+    /**
+        Description:
+            Skips the whitespace at the current position, reads a word,
+            which runs up to the next whitespace character or to the end
+            of the text, and returns a view of it, reading the whitespace
+            character after the word too, just like the operator that
+            reads strings does. When the source text is UTF-8 and the
+            whole word is ASCII and in the buffer of the resource, the
+            view refers to it there and nothing is copied; otherwise the
+            word is read into storage held by <#this/> text input stream.
+            Either way, the view is only valid until the next operation
+            on <#this/> text input stream or on its resource.
+    */
+    std::u8string_view
+    read_word ();
+
     /**
         Description:
             Reads all remaining text and appends it to the given string object.
@@ -241,6 +302,13 @@ private:
     // Private Data -----------------------------------------------------------
 
     encoding_form m_source_encoding_form;
+    std::u8string m_line_storage;
+
+    /*
+        The number of UTF-16 or UTF-32 code units that are copied out of
+        the resource at a time.
+    */
+    static constexpr std::size_t text_block_size{1024};
 
     // Private Functions ------------------------------------------------------
 
@@ -274,6 +342,9 @@ private:
     char32_t
     read_utf8_code_point ();
 
+    char32_t
+    read_utf8_code_point_by_code_unit ();
+
     char32_t
     read_utf16_code_point ();
 
@@ -291,6 +362,72 @@ private:
 
     char32_t
     read_utf32_bom ();
+
+    /*
+        Reads text in the given code unit type and appends it to the
+        target, dropping carriage returns the way read_filtered_code_point
+        does. If the target is meant to receive a line, this stops after
+        the first line feed. UTF-8 is decoded straight from the buffered
+        window of the resource, while UTF-16 and UTF-32 are copied out of
+        it in blocks of text_block_size code units, whose endianness is
+        inverted all at once when it isn't the native one.
+    */
+    template <
+        typename CodeUnit,
+        writable_raii_text_object TargetString
+    >
+    void
+    append_text (
+        TargetString& target,
+        bool stops_at_line_feed
+    );
+
+    /*
+        Appends the given valid text to the target in slices between
+        carriage returns, which are filtered the way append_text does
+        with the given state.
+    */
+    template <
+        typename CodeUnit,
+        writable_raii_text_object TargetString
+    >
+    static
+    void
+    append_segment (
+        TargetString& target,
+        const CodeUnit* data,
+        std::size_t size,
+        bool& is_after_carriage_return
+    );
+
+    /*
+        Appends the given valid text to the target all at once.
+    */
+    template <
+        typename CodeUnit,
+        writable_raii_text_object TargetString
+    >
+    static
+    void
+    append_slice (
+        TargetString& target,
+        const CodeUnit* data,
+        std::size_t size
+    );
+
+    /*
+        Decodes the multi-byte UTF-8 sequence at the beginning of the
+        given bytes into the given code point and returns its length,
+        or returns zero if the bytes don't hold a whole valid sequence.
+    */
+    static
+    std::size_t
+    decode_utf8_sequence (
+        const unsigned char* data,
+        std::size_t byte_count,
+        char32_t& code_point
+    )
+    noexcept;
 }; // class -------------------------------------------------------------------
 
 // Free Functions -------------------------------------------------------------
@@ -4,7 +4,13 @@
 #ifndef CMP_IO_TEXT_OUTPUT_STREAM_HPP_INCLUDED
 #define CMP_IO_TEXT_OUTPUT_STREAM_HPP_INCLUDED
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
 #include <cmp/io/inclusion_assert.hpp>
+#include <cmp/io/general.hpp>
 #include <cmp/io/output_stream.hpp>
 #include <cmp/unicode/algorithms.hpp>
 #include <cmp/unicode/formatters.hpp>
@@ -237,6 +243,13 @@ private:
 
     encoding_form m_target_encoding_form;
 
+    /*
+        The number of code units that are transcoded at once, on the
+        stack, when writing strings that aren't already in the target
+        encoding form and endianness.
+    */
+    static constexpr std::size_t text_block_size{256};
+
     // Private Functions ------------------------------------------------------
 
     void
@@ -258,6 +271,77 @@ private:
     write_code_point (
         char32_t code_point
     );
+
+    /*
+        Writes the given code units in the target endianness with a
+        single write, reordering their bytes in place if need be.
+    */
+    template <
+        typename CodeUnit
+    >
+    void
+    write_code_units (
+        CodeUnit* data,
+        std::size_t count
+    );
+
+    /*
+        Writes the given Unicode text in the target encoding form,
+        transcoding it in blocks of text_block_size code units.
+    */
+    template <
+        typename CodeUnit
+    >
+    void
+    write_text (
+        const CodeUnit* data,
+        std::size_t size
+    );
+
+    template <
+        typename OutputCodeUnit,
+        typename InputCodeUnit
+    >
+    void
+    write_text_as (
+        const InputCodeUnit* data,
+        std::size_t size
+    );
+
+    /*
+        Writes every char of the given string as a code point of its
+        own, in blocks, which is what is done with chars when the target
+        encoding form isn't UTF-8.
+    */
+    template <
+        typename OutputCodeUnit
+    >
+    void
+    write_chars_as (
+        std::string_view source
+    );
+
+    /*
+        These encode the given code point in the given array, which has
+        to have room for a whole sequence, and return the number of code
+        units written. They encode code points the way append_code_point
+        does.
+    */
+
+    static
+    std::size_t
+    encode_in_utf8 (
+        char32_t code_point,
+        char8_t* output
+    );
+
+    static
+    std::size_t
+    encode_in_utf16 (
+        char32_t code_point,
+        char16_t* output
+    )
+    noexcept;
 }; // class -------------------------------------------------------------------
 
 // Free Functions -------------------------------------------------------------
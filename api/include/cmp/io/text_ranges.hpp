@@ -0,0 +1,296 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_TEXT_RANGES_HPP_INCLUDED
+#define CMP_IO_TEXT_RANGES_HPP_INCLUDED
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/io/text_input_stream.hpp>
+
+namespace cmp {
+
+/**
+    Description:
+        A line range is a single-pass range of the lines that are left
+        in a text input stream, which are read with
+        <#function>read_line</#function> as the range is iterated over.
+        Each line is a view that is only valid until the range is
+        advanced or the stream is used otherwise.
+*/
+template <
+    typename InputResource
+>
+class line_range {
+public:
+    // Types ------------------------------------------------------------------
+
+    class iterator {
+    public:
+        // Types --------------------------------------------------------------
+
+        using difference_type = std::ptrdiff_t;
+
+        using value_type = std::u8string_view;
+
+        using reference = std::u8string_view;
+
+        using iterator_category = std::input_iterator_tag;
+
+        using iterator_concept = std::input_iterator_tag;
+
+        // Constructors and Destructor ----------------------------------------
+
+        iterator ()
+        noexcept = default;
+
+        explicit
+        iterator (
+            line_range& range
+        )
+        noexcept;
+
+        // Operator Overloads -------------------------------------------------
+
+        reference
+        operator * ()
+        const noexcept;
+
+        iterator&
+        operator ++ ();
+
+        void
+        operator ++ (
+            int
+        );
+
+        bool
+        operator == (
+            std::default_sentinel_t
+        )
+        const noexcept;
+
+    private:
+        // Private Data -------------------------------------------------------
+
+        line_range* m_range{nullptr};
+    }; // class ---------------------------------------------------------------
+
+    // Constructors and Destructor --------------------------------------------
+
+    /**
+        Description:
+            Constructs a line range over the lines that are left in the
+            given text input stream, which is expected to stay valid when
+            using the line range.
+
+        Parameters:
+            stream:
+                The text input stream to read lines from.
+    */
+    explicit
+    line_range (
+        text_input_stream<InputResource>& stream
+    )
+    noexcept;
+
+    // Core -------------------------------------------------------------------
+
+    /**
+        Description:
+            Reads the first line and returns an iterator to it.
+    */
+    iterator
+    begin ();
+
+    /**
+        Description:
+            Returns the sentinel that the iterators of <#this/> line range
+            compare equal to once there are no lines left.
+    */
+    std::default_sentinel_t
+    end ()
+    const noexcept;
+
+private:
+    // Private Data -----------------------------------------------------------
+
+    text_input_stream<InputResource>* m_stream;
+    std::u8string_view m_current_line;
+    bool m_is_done;
+
+    // Private Functions ------------------------------------------------------
+
+    void
+    advance ();
+}; // class -------------------------------------------------------------------
+
+/**
+    Description:
+        A token range is a single-pass range of the tokens that are left
+        in a text input stream, which are read with
+        <#function>read_token</#function> as the range is iterated over.
+        Each token is a view that is only valid until the range is
+        advanced or the stream is used otherwise.
+*/
+template <
+    typename InputResource
+>
+class token_range {
+public:
+    // Types ------------------------------------------------------------------
+
+    class iterator {
+    public:
+        // Types --------------------------------------------------------------
+
+        using difference_type = std::ptrdiff_t;
+
+        using value_type = std::u8string_view;
+
+        using reference = std::u8string_view;
+
+        using iterator_category = std::input_iterator_tag;
+
+        using iterator_concept = std::input_iterator_tag;
+
+        // Constructors and Destructor ----------------------------------------
+
+        iterator ()
+        noexcept = default;
+
+        explicit
+        iterator (
+            token_range& range
+        )
+        noexcept;
+
+        // Operator Overloads -------------------------------------------------
+
+        reference
+        operator * ()
+        const noexcept;
+
+        iterator&
+        operator ++ ();
+
+        void
+        operator ++ (
+            int
+        );
+
+        bool
+        operator == (
+            std::default_sentinel_t
+        )
+        const noexcept;
+
+    private:
+        // Private Data -------------------------------------------------------
+
+        token_range* m_range{nullptr};
+    }; // class ---------------------------------------------------------------
+
+    // Constructors and Destructor --------------------------------------------
+
+    /**
+        Description:
+            Constructs a token range over the tokens that are left in the
+            given text input stream, which is expected to stay valid when
+            using the token range, like the given delimiters.
+
+        Parameters:
+            stream:
+                The text input stream to read tokens from.
+            delimiters:
+                The characters that separate tokens, which have to be
+                ASCII characters.
+    */
+    token_range (
+        text_input_stream<InputResource>& stream,
+        std::u8string_view delimiters
+    )
+    noexcept;
+
+    // Core -------------------------------------------------------------------
+
+    /**
+        Description:
+            Reads the first token and returns an iterator to it.
+    */
+    iterator
+    begin ();
+
+    /**
+        Description:
+            Returns the sentinel that the iterators of <#this/> token range
+            compare equal to once there are no tokens left.
+    */
+    std::default_sentinel_t
+    end ()
+    const noexcept;
+
+private:
+    // Private Data -----------------------------------------------------------
+
+    text_input_stream<InputResource>* m_stream;
+    std::u8string_view m_delimiters;
+    std::u8string_view m_current_token;
+    bool m_is_done;
+
+    // Private Functions ------------------------------------------------------
+
+    void
+    advance ();
+}; // class -------------------------------------------------------------------
+
+// Free Functions -------------------------------------------------------------
+
+/**
+    Description:
+        Returns a range of the lines that are left in the given text
+        input stream.
+
+    Parameters:
+        stream:
+            The text input stream to read lines from.
+*/
+template <
+    typename InputResource
+>
+line_range<InputResource>
+lines (
+    text_input_stream<InputResource>& stream
+)
+noexcept;
+
+/**
+    Description:
+        Returns a range of the tokens that are left in the given text
+        input stream, separated by the given delimiters.
+
+    Parameters:
+        stream:
+            The text input stream to read tokens from.
+        delimiters:
+            The characters that separate tokens, which have to be ASCII
+            characters.
+*/
+template <
+    typename InputResource
+>
+token_range<InputResource>
+tokens (
+    text_input_stream<InputResource>& stream,
+    std::u8string_view delimiters = u8" \t\n\v\f"
+)
+noexcept;
+
+} // namespace ----------------------------------------------------------------
+
+#include <cmp/io/text_ranges.ipp>
+
+#endif // CMP_IO_TEXT_RANGES_HPP_INCLUDED
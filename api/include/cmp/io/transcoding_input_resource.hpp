@@ -0,0 +1,273 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_IO_TRANSCODING_INPUT_RESOURCE_HPP_INCLUDED
+#define CMP_IO_TRANSCODING_INPUT_RESOURCE_HPP_INCLUDED
+
+#include <bit>
+#include <cstddef>
+#include <span>
+
+#include <cmp/io/inclusion_assert.hpp>
+#include <cmp/io/exceptions.hpp>
+#include <cmp/io/general.hpp>
+#include <cmp/io/input_resource.hpp>
+#include <cmp/unicode/impl/transcoding.hpp>
+
+namespace cmp {
+
+/**
+    Description:
+        A transcoding input resource is an input resource that reads text
+        in UTF-8, UTF-16 or UTF-32, in either endianness, from another
+        input resource, and gives it out as UTF-8. The text is transcoded
+        a block at a time, so that a
+        <#type>text_input_stream</#type> reading UTF-8 from it takes its
+        fast paths whatever the encoding form of the source is.
+
+        Invalid UTF-16 throws <#type>invalid_unicode_encoding</#type> and
+        invalid UTF-32 throws <#type>invalid_code_point</#type> when they
+        are reached, while UTF-8 is handed out as it is and left for the
+        reader to validate. A code unit cut short at the end of the source
+        throws <#type>read_past_end</#type>.
+*/
+template <
+    typename Source
+>
+class transcoding_input_resource
+    : public virtual input_resource
+{
+public:
+    // Types ------------------------------------------------------------------
+
+    /**
+        Description:
+            The type of the referenced input resource.
+    */
+    using referenced_resource_type = Source;
+
+    // Constants --------------------------------------------------------------
+
+    /**
+        Description:
+            The number of UTF-16 or UTF-32 code units that are transcoded
+            at a time.
+    */
+    static constexpr std::size_t text_block_size{1024};
+
+    // Constructors and Destructor --------------------------------------------
+
+    /**
+        Description:
+            Constructs a transcoding input resource that reads from the
+            given input resource, whose encoding form and endianness are
+            told by the BOM (byte order mark) at its beginning, which is
+            skipped. Text without a BOM is taken to be in UTF-8. The
+            transcoding input resource holds a non-owning reference to
+            the source, which is expected to stay valid when using it.
+
+        Parameters:
+            source:
+                The input resource to read from.
+            buffer_capacity:
+                The capacity of the I/O buffer, which holds UTF-8 text.
+    */
+    explicit
+    transcoding_input_resource (
+        referenced_resource_type& source,
+        std::size_t buffer_capacity = io_buffer::default_buffer_capacity
+    );
+
+    /**
+        Description:
+            Constructs a transcoding input resource that reads from the
+            given input resource, whose text is in the given encoding
+            form and endianness. A BOM at the beginning of the text isn't
+            skipped. The transcoding input resource holds a non-owning
+            reference to the source, which is expected to stay valid when
+            using it.
+
+        Parameters:
+            source:
+                The input resource to read from.
+            source_encoding_form:
+                The encoding form that the text is expected to be in.
+            source_endianness:
+                The endianness that the text is expected to be in.
+            buffer_capacity:
+                The capacity of the I/O buffer, which holds UTF-8 text.
+    */
+    transcoding_input_resource (
+        referenced_resource_type& source,
+        encoding_form source_encoding_form,
+        std::endian source_endianness = std::endian::big,
+        std::size_t buffer_capacity = io_buffer::default_buffer_capacity
+    );
+
+    ~transcoding_input_resource ()
+    override = default;
+
+    // Copy Operations --------------------------------------------------------
+
+    transcoding_input_resource (
+        const transcoding_input_resource& other
+    )
+    = delete;
+
+    transcoding_input_resource&
+    operator = (
+        const transcoding_input_resource& other
+    )
+    = delete;
+
+    // Move Operations --------------------------------------------------------
+
+    /**
+        Description:
+            Move-constructs a <#type>transcoding_input_resource</#type>
+            from an existing one.
+
+        Parameters:
+            other:
+                The <#type>transcoding_input_resource</#type>
+                to move from.
+    */
+    transcoding_input_resource (
+        transcoding_input_resource&& other
+    )
+    noexcept = default;
+
+    /**
+        Description:
+            Move-assigns a <#type>transcoding_input_resource</#type>
+            into <#this/> one.
+
+        Parameters:
+            other:
+                The <#type>transcoding_input_resource</#type>
+                to move from.
+    */
+    transcoding_input_resource&
+    operator = (
+        transcoding_input_resource&& other
+    )
+    noexcept = default;
+
+    // Accessors --------------------------------------------------------------
+
+    /**
+        Description:
+            Returns true if <#this/> transcoding input resource has given
+            out all the text of its source. Otherwise, returns false.
+    */
+    bool
+    is_at_end ()
+    const noexcept override;
+
+    /**
+        Description:
+            Returns the encoding form of the text of the source.
+    */
+    encoding_form
+    get_source_encoding_form ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns the endianness of the text of the source.
+    */
+    std::endian
+    get_source_endianness ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns a reference to the referenced input resource.
+    */
+    referenced_resource_type&
+    grab_source ()
+    noexcept;
+
+    /**
+        Description:
+            Returns a constant reference to the referenced input resource.
+    */
+    const referenced_resource_type&
+    grab_source ()
+    const noexcept;
+
+protected:
+    // Protected Functions ----------------------------------------------------
+
+    /**
+        Description:
+            Transcodes text from the source into up to
+            <#parameter>byte_count</#parameter> bytes of UTF-8, places
+            them in the provided <#parameter>data</#parameter> array and
+            returns their number. When filling the buffer, this returns
+            after the first block, so that it doesn't wait on sources such
+            as pipes and terminals for more text than they have.
+
+        Parameters:
+            data:
+                The array into which the read bytes will be placed.
+            byte_count:
+                The number of bytes to read from <#this/> input resource.
+            rr:
+                The kind of read request that is
+                being issued to <#this/> input resource.
+    */
+    std::size_t
+    read_raw (
+        std::byte* data,
+        std::size_t byte_count,
+        read_request rr
+    )
+    override;
+
+private:
+    // Private Data -----------------------------------------------------------
+
+    referenced_resource_type* m_source;
+    encoding_form m_source_encoding_form;
+    std::endian m_source_endianness;
+
+    /*
+        A code point that didn't fit in what was asked for is transcoded
+        here and given out over the following reads.
+    */
+    std::byte m_pending_bytes[4];
+    std::size_t m_pending_position;
+    std::size_t m_pending_size;
+
+    // Private Functions ------------------------------------------------------
+
+    void
+    skip_bom ();
+
+    /*
+        Transcodes the next block of the source into the given output,
+        which has to have room for at least four bytes, and returns the
+        number of bytes written, which is zero at the end of the source.
+    */
+    std::size_t
+    transcode_block (
+        std::byte* output,
+        std::size_t output_size
+    );
+
+    template <
+        typename CodeUnit
+    >
+    std::size_t
+    transcode_wide_block (
+        std::byte* output,
+        std::size_t output_size
+    );
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#include <cmp/io/transcoding_input_resource.ipp>
+
+#endif // CMP_IO_TRANSCODING_INPUT_RESOURCE_HPP_INCLUDED
@@ -5,6 +5,7 @@
 #define CMP_IO_TRANSFER_RESOURCE_HPP_INCLUDED
 
 #include <cmp/io/inclusion_assert.hpp>
+#include <cmp/io/general.hpp>
 #include <cmp/io/io_buffer.hpp>
 
 namespace cmp {
@@ -17,6 +18,24 @@ namespace cmp {
 */
 class CMP_LIBRARY_NAME transfer_resource {
 public:
+    // Constants --------------------------------------------------------------
+
+    /**
+        Description:
+            The largest capacity that the buffer of a transfer
+            resource grows to when its buffer is sized adaptively.
+    */
+    static constexpr std::size_t max_adaptive_buffer_capacity{
+        CMP_CONFIG_MAX_ADAPTIVE_BUFFER_CAPACITY
+    };
+
+    /**
+        Description:
+            The number of times that the buffer has to go to the resource
+            between two decisions on whether to resize an adaptive buffer.
+    */
+    static constexpr std::size_t buffer_adaptation_period{8};
+
     // Constructors and Destructor --------------------------------------------
 
     /**
@@ -121,10 +140,128 @@ public:
     is_at_end ()
     const noexcept = 0;
 
+    /**
+        Description:
+            Returns the current capacity of the buffer of <#this/>
+            transfer resource.
+    */
+    CMP_CONDITIONAL_INLINE
+    std::size_t
+    get_buffer_capacity ()
+    const noexcept;
+
+    /**
+        Description:
+            Returns the buffer sizing mode of <#this/> transfer resource.
+    */
+    CMP_CONDITIONAL_INLINE
+    buffer_sizing
+    get_buffer_sizing ()
+    const noexcept;
+
+    /**
+        Description:
+            Sets the buffer sizing mode of <#this/> transfer resource. In
+            the <#enumerator>buffer_sizing::fixed</#enumerator> mode,
+            which is the default, the buffer keeps the capacity it was
+            given. In the <#enumerator>buffer_sizing::adaptive</#enumerator>
+            mode, the buffer is first grown to the transfer size that the
+            underlying resource prefers, if it can tell, such as the block
+            size of a file or the capacity of a pipe. Afterwards, the
+            capacity is doubled, up to
+            <#function>max_adaptive_buffer_capacity</#function>, while the
+            buffer keeps serving most requests and keeps being filled or
+            flushed whole, and halved, down to the capacity it started
+            from, while most requests miss it, as happens with large
+            requests or with small ones far apart from each other.
+
+            An unbuffered transfer resource stays unbuffered.
+
+        Parameters:
+            new_buffer_sizing:
+                The new buffer sizing mode of <#this/> transfer resource.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    set_buffer_sizing (
+        buffer_sizing new_buffer_sizing
+    );
+
 protected:
+    // Protected Functions ----------------------------------------------------
+
+    /**
+        Description:
+            Returns the number of bytes that the underlying resource
+            prefers to transfer at once, or zero if it can't tell, in
+            which case the buffer capacity is left alone.
+    */
+    CMP_CONDITIONAL_INLINE
+    virtual
+    std::size_t
+    query_preferred_buffer_capacity ()
+    const noexcept;
+
+    /**
+        Description:
+            Grows the buffer to the capacity that the underlying resource
+            prefers, if the buffer is sized adaptively. This should be
+            called whenever the underlying resource changes, for instance
+            when a different file is opened.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    apply_preferred_buffer_capacity ();
+
+    /**
+        Description:
+            Records that a request was served by the buffer alone.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    record_buffer_hit ()
+    noexcept;
+
+    /**
+        Description:
+            Records that a request had to go to the resource, which
+            transferred <#parameter>byte_count</#parameter> bytes in or
+            out of the buffer.
+
+        Parameters:
+            byte_count:
+                The number of bytes that filling or flushing the buffer
+                transferred, or zero if the request went around it.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    record_buffer_miss (
+        std::size_t byte_count
+    )
+    noexcept;
+
+    /**
+        Description:
+            Resizes the buffer if it's sized adaptively and enough misses
+            were recorded since the last time. This must only be called
+            when the buffer holds no bytes left to read or to write.
+    */
+    CMP_CONDITIONAL_INLINE
+    void
+    adapt_buffer_capacity ();
+
     // Protected Data ---------------------------------------------------------
 
     io_buffer m_buffer;
+
+private:
+    // Private Data -----------------------------------------------------------
+
+    buffer_sizing m_buffer_sizing;
+    std::size_t m_min_buffer_capacity;
+    std::size_t m_buffer_hit_count;
+    std::size_t m_buffer_miss_count;
+    std::size_t m_buffer_whole_count;
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -4,6 +4,7 @@
 #ifndef CMP_IO_TRANSPARENT_CONTAINER_IO_RESOURCE_HPP_INCLUDED
 #define CMP_IO_TRANSPARENT_CONTAINER_IO_RESOURCE_HPP_INCLUDED
 
+#include <span>
 #include <string>
 
 #include <cmp/io/inclusion_assert.hpp>
@@ -56,8 +57,9 @@ public:
                 The content that <#this/> transparent
                 container I/O resource will reference.
             buffer_capacity:
-                The capacity of the I/O buffer. If this is zero, the
-                transparent container I/O resource is completely unbuffered.
+                The capacity of the I/O buffer, which is only used
+                for writing, since reads are served straight from
+                the content. If this is zero, writes are unbuffered.
     */
     explicit
     transparent_container_io_resource (
@@ -174,6 +176,63 @@ public:
     grab_content ()
     const noexcept;
 
+    // Core -------------------------------------------------------------------
+
+    /**
+        Description:
+            Reads <#parameter>byte_count</#parameter> bytes from <#this/>
+            transparent container I/O resource and places them in the provided
+            <#parameter>data</#parameter> array. The bytes are copied straight
+            from the content, bypassing the I/O buffer.
+
+        Parameters:
+            data:
+                The array into which the read bytes will be placed.
+            byte_count:
+                The number of bytes to read from
+                <#this/> transparent container I/O resource.
+    */
+    std::size_t
+    read (
+        std::byte* data,
+        std::size_t byte_count
+    )
+    override;
+
+    /**
+        Description:
+            Returns a view of all the bytes of the content from the
+            current position to its end. The view points straight into
+            the content, so no bytes are copied, and it's invalidated
+            by any operation that modifies the content.
+
+        Parameters:
+            min_bytes:
+                Unused, since the view always holds all the
+                bytes that are left in the content.
+    */
+    std::span<const std::byte>
+    peek_view (
+        std::size_t min_bytes = 1
+    )
+    override;
+
+    /**
+        Description:
+            Advances the position of <#this/> transparent container I/O
+            resource by <#parameter>byte_count</#parameter> bytes, up to the
+            end of the content.
+
+        Parameters:
+            byte_count:
+                The number of bytes to mark as read.
+    */
+    void
+    consume (
+        std::size_t byte_count
+    )
+    override;
+
 protected:
     // Protected Types --------------------------------------------------------
 
@@ -5,12 +5,16 @@
 #define CMP_UNICODE_ALGORITHMS_HPP_INCLUDED
 
 #include <cstring>
+#include <span>
+#include <stdexcept>
 #include <string_view>
 
 #include <cmp/unicode/inclusion_assert.hpp>
 #include <cmp/unicode/by_code_point.hpp>
 #include <cmp/unicode/concepts.hpp>
 #include <cmp/unicode/exceptions.hpp>
+#include <cmp/unicode/impl/transcoding.hpp>
+#include <cmp/unicode/impl/validation.hpp>
 
 namespace cmp {
 
@@ -377,6 +381,48 @@ convert_string (
     const InputString& s
 );
 
+/**
+    Description:
+        Returns the number of code units of the given type that the given
+        string takes up once it's converted to them, which is how much
+        room <#function>transcode_into</#function> needs.
+
+    Parameters:
+        s:
+            The string to measure.
+*/
+template <
+    typename OutputCodeUnit,
+    unicode_text_object InputString
+>
+std::size_t
+transcoded_size (
+    const InputString& s
+);
+
+/**
+    Description:
+        Converts the given string into the given storage and returns the
+        number of code units written to it. If the storage doesn't have
+        room for all of them, a <#type>std::length_error</#type> is thrown
+        and nothing is written.
+
+    Parameters:
+        s:
+            The string to convert.
+        target:
+            The storage to write the converted string to.
+*/
+template <
+    unicode_text_object InputString,
+    typename OutputCodeUnit
+>
+std::size_t
+transcode_into (
+    const InputString& s,
+    std::span<OutputCodeUnit> target
+);
+
 /**
     Description:
         Converts the given string to a <#type>std::string</#type>.
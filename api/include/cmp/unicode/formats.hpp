@@ -127,6 +127,12 @@ enum class radix_place_limit {
     up_to
 }; // enum --------------------------------------------------------------------
 
+enum class floating_point_notation {
+    fixed,
+    scientific,
+    shortest
+}; // enum --------------------------------------------------------------------
+
 /**
     Description:
         A bool format is an object that provides the information that
@@ -300,7 +306,8 @@ private:
         An integer format is an object that provides the information that
         a formatter needs to turn an integer value into a string, and the
         information that a parser needs to turn a string into an integer
-        value.
+        value. Since it is a literal type, it can also be given as a
+        template argument, for formatting and parsing specialized for it.
 */
 class CMP_LIBRARY_NAME integer_format {
 public:
@@ -314,7 +321,7 @@ public:
             and the thousands separator is
             <#enumerator>thousands_separator::none</#enumerator>.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     integer_format ()
     noexcept;
 
@@ -331,7 +338,7 @@ public:
             initial_thousands_separator:
                 The thousands separator.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     integer_format (
         unsigned int initial_radix,
         sign_status initial_sign_status,
@@ -418,7 +425,7 @@ public:
         Description:
             Returns the radix of <#this/> integer format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     unsigned int
     get_radix ()
     const noexcept;
@@ -431,7 +438,7 @@ public:
             new_radix:
                 The new radix of <#this/> integer format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_radix (
         unsigned int new_radix
@@ -442,7 +449,7 @@ public:
         Description:
             Returns the sign status of <#this/> integer format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     sign_status
     get_sign_status ()
     const noexcept;
@@ -455,7 +462,7 @@ public:
             new_sign_status:
                 The new sign status of <#this/> integer format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_sign_status (
         sign_status new_sign_status
@@ -466,7 +473,7 @@ public:
         Description:
             Returns the thousands separator of <#this/> integer format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     thousands_separator
     get_thousands_separator ()
     const noexcept;
@@ -479,15 +486,20 @@ public:
             new_thousands_separator:
                 The new thousands separator of <#this/> integer format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_thousands_separator (
         thousands_separator new_thousands_separator
     )
     noexcept;
 
-private:
-    // Private Data -----------------------------------------------------------
+    // Data -------------------------------------------------------------------
+
+    /*
+        The data is public only so that formats are structural types and
+        can be template arguments; it is meant to be used through the
+        accessors.
+    */
 
     unsigned int m_radix;
     sign_status m_sign_status;
@@ -499,7 +511,9 @@ private:
         A floating-point format is an object that provides the information
         that a formatter needs to turn a floating-point value into
         a string, and the information that a parser needs to turn
-        a string into a floating-point value.
+        a string into a floating-point value. Since it is a literal type,
+        it can also be given as a template argument, for formatting and
+        parsing specialized for it.
 */
 class CMP_LIBRARY_NAME floating_point_format {
 public:
@@ -514,10 +528,11 @@ public:
             <#enumerator>thousands_separator::none</#enumerator>, the radix
             character is <#enumerator>radix_character::period</#enumerator>,
             the radix place limit is
-            <#enumerator>radix_place_limit::none</#enumerator> and the radix
-            place count is 0.
+            <#enumerator>radix_place_limit::none</#enumerator>, the radix
+            place count is 0 and the notation is
+            <#enumerator>floating_point_notation::fixed</#enumerator>.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     floating_point_format ()
     noexcept;
 
@@ -525,7 +540,7 @@ public:
         Description:
             Construct a floating-point format with the given radix,
             sign status, thousands separator, radix character, radix
-            place limit and radix place count.
+            place limit, radix place count and notation.
 
         Parameters:
             initial_radix:
@@ -540,15 +555,19 @@ public:
                 The radix place limit.
             initial_radix_place_count:
                 The radix place count.
+            initial_notation:
+                The notation.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     floating_point_format (
         unsigned int initial_radix,
         sign_status initial_sign_status,
         thousands_separator initial_thousands_separator,
         radix_character initial_radix_character,
         radix_place_limit initial_radix_place_limit,
-        unsigned int initial_radix_place_count
+        unsigned int initial_radix_place_count,
+        floating_point_notation initial_notation
+            = floating_point_notation::fixed
     );
 
     CMP_CONDITIONAL_INLINE
@@ -631,7 +650,7 @@ public:
         Description:
             Returns the radix of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     unsigned int
     get_radix ()
     const noexcept;
@@ -644,7 +663,7 @@ public:
             new_radix:
                 The new radix of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_radix (
         unsigned int new_radix
@@ -655,7 +674,7 @@ public:
         Description:
             Returns the sign status of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     sign_status
     get_sign_status ()
     const noexcept;
@@ -668,7 +687,7 @@ public:
             new_sign_status:
                 The new sign status of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_sign_status (
         sign_status new_sign_status
@@ -679,7 +698,7 @@ public:
         Description:
             Returns the thousands separator of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     thousands_separator
     get_thousands_separator ()
     const noexcept;
@@ -692,7 +711,7 @@ public:
             new_thousands_separator:
                 The new thousands separator of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_thousands_separator (
         thousands_separator new_thousands_separator
@@ -703,7 +722,7 @@ public:
         Description:
             Returns the radix character of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     radix_character
     get_radix_character ()
     const noexcept;
@@ -716,7 +735,7 @@ public:
             new_radix_character:
                 The new radix character of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_radix_character (
         radix_character new_radix_character
@@ -727,7 +746,7 @@ public:
         Description:
             Returns the radix place limit of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     radix_place_limit
     get_radix_place_limit ()
     const noexcept;
@@ -740,7 +759,7 @@ public:
             new_radix_place_limit:
                 The new radix place limit of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_radix_place_limit (
         radix_place_limit new_radix_place_limit
@@ -751,7 +770,7 @@ public:
         Description:
             Returns the radix place count of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     unsigned int
     get_radix_place_count ()
     const noexcept;
@@ -764,15 +783,47 @@ public:
             new_radix_place_count:
                 The new radix place count of <#this/> floating-point format.
     */
-    CMP_CONDITIONAL_INLINE
+    constexpr
     void
     set_radix_place_count (
         unsigned int new_radix_place_count
     )
     noexcept;
 
-private:
-    // Private Data -----------------------------------------------------------
+    /**
+        Description:
+            Returns the notation of <#this/> floating-point format, which
+            tells whether values are written out in full, with an
+            exponent, or in whichever of the two is shorter. Values are
+            only written with an exponent in radix 10.
+    */
+    constexpr
+    floating_point_notation
+    get_notation ()
+    const noexcept;
+
+    /**
+        Description:
+            Sets the notation of <#this/> floating-point format.
+
+        Parameters:
+            new_notation:
+                The new notation of <#this/> floating-point format.
+    */
+    constexpr
+    void
+    set_notation (
+        floating_point_notation new_notation
+    )
+    noexcept;
+
+    // Data -------------------------------------------------------------------
+
+    /*
+        The data is public only so that formats are structural types and
+        can be template arguments; it is meant to be used through the
+        accessors.
+    */
 
     unsigned int m_radix;
     sign_status m_sign_status;
@@ -780,10 +831,92 @@ private:
     radix_character m_radix_character;
     radix_place_limit m_radix_place_limit;
     unsigned int m_radix_place_count;
+    floating_point_notation m_notation;
 }; // class -------------------------------------------------------------------
 
+namespace impl {
+
+/*
+    These stand in for the format given as a template argument wherever
+    a format object is taken, and return its values as constants, so
+    that the code using them is specialized for that format.
+*/
+
+template <
+    integer_format Format
+>
+struct constant_integer_format {
+    static
+    constexpr
+    unsigned int
+    get_radix ()
+    noexcept;
+
+    static
+    constexpr
+    sign_status
+    get_sign_status ()
+    noexcept;
+
+    static
+    constexpr
+    thousands_separator
+    get_thousands_separator ()
+    noexcept;
+}; // struct ------------------------------------------------------------------
+
+template <
+    floating_point_format Format
+>
+struct constant_floating_point_format {
+    static
+    constexpr
+    unsigned int
+    get_radix ()
+    noexcept;
+
+    static
+    constexpr
+    sign_status
+    get_sign_status ()
+    noexcept;
+
+    static
+    constexpr
+    thousands_separator
+    get_thousands_separator ()
+    noexcept;
+
+    static
+    constexpr
+    radix_character
+    get_radix_character ()
+    noexcept;
+
+    static
+    constexpr
+    radix_place_limit
+    get_radix_place_limit ()
+    noexcept;
+
+    static
+    constexpr
+    unsigned int
+    get_radix_place_count ()
+    noexcept;
+
+    static
+    constexpr
+    floating_point_notation
+    get_notation ()
+    noexcept;
+}; // struct ------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
 
+#include <cmp/unicode/formats.ipp>
 #if CMP_CONFIG_HEADER_ONLY == true
 #   include <cmp/unicode/formats.cpp>
 #endif // CMP_CONFIG_HEADER_ONLY
@@ -4,45 +4,227 @@
 #ifndef CMP_UNICODE_FORMATTERS_HPP_INCLUDED
 #define CMP_UNICODE_FORMATTERS_HPP_INCLUDED
 
+#include <bit>
+#include <charconv>
 #include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 #include <cmp/unicode/inclusion_assert.hpp>
 #include <cmp/unicode/algorithms.hpp>
 #include <cmp/unicode/formats.hpp>
+#include <cmp/unicode/impl/floating_point.hpp>
 
 namespace cmp {
 
 namespace impl {
 
-class number_formatter {
+/*
+    The format these take is either a format object or one of the
+    constant formats standing in for a format given as a template
+    argument.
+*/
+class CMP_LIBRARY_NAME number_formatter {
 public:
     // Core -------------------------------------------------------------------
 
     template <
         writable_raii_text_object Output,
-        std::integral Input
+        std::integral Input,
+        typename Format
     >
     static
     Output
     format_integer (
         Input input,
-        const integer_format& format
+        const Format& format
+    );
+
+    template <
+        std::integral Input,
+        typename Format
+    >
+    static
+    std::size_t
+    format_integer_to (
+        Input input,
+        std::span<char8_t> target,
+        const Format& format
     );
 
     template <
         writable_raii_text_object Output,
-        std::floating_point Input
+        std::floating_point Input,
+        typename Format
     >
     static
     Output
     format_floating_point (
         Input input,
-        const floating_point_format& format
+        const Format& format
+    );
+
+private:
+    // Private Types ----------------------------------------------------------
+
+    /*
+        The significant digits of a decimal value, without leading or
+        trailing zeros, and the position of its decimal point relative to
+        the first of them, so that the value is 0.d1d2d3... times ten to
+        the power of point_position. Zero has no digits.
+    */
+    struct decimal_digits {
+        char8_t digits[40];
+        int digit_count;
+        int point_position;
+    }; // struct --------------------------------------------------------------
+
+    // Private Data -----------------------------------------------------------
+
+    static constexpr char8_t digit_characters[]{
+        u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    };
+
+    /*
+        The two digits of every number below one hundred, so that
+        decimal digits can be written two at a time.
+    */
+    static constexpr char8_t decimal_digit_pairs[]{
+        u8"00010203040506070809"
+        u8"10111213141516171819"
+        u8"20212223242526272829"
+        u8"30313233343536373839"
+        u8"40414243444546474849"
+        u8"50515253545556575859"
+        u8"60616263646566676869"
+        u8"70717273747576777879"
+        u8"80818283848586878889"
+        u8"90919293949596979899"
+    };
+
+    // Private Functions ------------------------------------------------------
+
+    /*
+        Writes the digits of the given magnitude right to left, ending
+        right before the given end, and returns where they begin.
+    */
+    template <
+        std::unsigned_integral Magnitude
+    >
+    static
+    char8_t*
+    write_digits (
+        Magnitude magnitude,
+        unsigned int radix,
+        char8_t* end
+    )
+    noexcept;
+
+    template <
+        std::unsigned_integral Magnitude
+    >
+    static
+    char8_t*
+    write_decimal_digits (
+        Magnitude magnitude,
+        char8_t* end
+    )
+    noexcept;
+
+    template <
+        std::unsigned_integral Magnitude
+    >
+    static
+    char8_t*
+    write_power_of_two_digits (
+        Magnitude magnitude,
+        int bits_per_digit,
+        char8_t* end
+    )
+    noexcept;
+
+    /*
+        Formats the given value the way format_floating_point did before
+        it had a notation, which is used for every radix but 10.
+    */
+    template <
+        writable_raii_text_object Output,
+        std::floating_point Input,
+        typename Format
+    >
+    static
+    Output
+    format_floating_point_in_radix (
+        Input input,
+        const Format& format
     );
+
+    /*
+        Returns the shortest digits that read back as the given finite,
+        non-negative value.
+    */
+    template <
+        std::floating_point Input
+    >
+    static
+    decimal_digits
+    find_shortest_digits (
+        Input magnitude
+    );
+
+    /*
+        Returns the digits of the given finite, non-negative value
+        correctly rounded to the given number of places after the decimal
+        point in the given notation of std::to_chars.
+    */
+    template <
+        std::floating_point Input
+    >
+    static
+    decimal_digits
+    find_rounded_digits (
+        Input magnitude,
+        std::chars_format notation,
+        int place_count
+    );
+
+    /*
+        Reads the digits of a number written by std::to_chars in fixed or
+        scientific notation.
+    */
+    CMP_CONDITIONAL_INLINE
+    static
+    decimal_digits
+    read_digits (
+        std::string_view text
+    )
+    noexcept;
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
 
+// Constants ------------------------------------------------------------------
+
+/**
+    Description:
+        The largest number of code units that formatting an integer of
+        the given type takes, whatever the integer format is.
+*/
+template <
+    std::integral Input
+>
+constexpr std::size_t max_formatted_integer_size_v{
+    std::numeric_limits<
+        std::make_unsigned_t<decltype(+Input{})>
+    >::digits * 4 / 3 + 1
+};
+
 // Free Functions -------------------------------------------------------------
 
 /**
@@ -74,10 +256,78 @@ format_integer (
     const integer_format& format
 );
 
+/**
+    Description:
+        Formats the given integer value with the integer format given as
+        a template argument and returns the formatted string. The code is
+        specialized for the format, so that nothing about it is looked at
+        while formatting.
+*/
+template <
+    writable_raii_text_object Output,
+    integer_format Format,
+    std::integral Input
+>
+Output
+format_integer (
+    Input input
+);
+
+/**
+    Description:
+        Formats the given integer value with the given integer format
+        into the given storage and returns the number of code units
+        written to it. If the storage doesn't have room for all of them,
+        a <#type>std::length_error</#type> is thrown and nothing is
+        written. Storage of max_formatted_integer_size_v code units
+        always has room.
+
+    Parameters:
+        input:
+            The integer value to format.
+        target:
+            The storage to write the formatted integer to.
+        format:
+            The integer format to format with.
+*/
+template <
+    std::integral Input
+>
+std::size_t
+format_integer_to (
+    Input input,
+    std::span<char8_t> target,
+    const integer_format& format
+);
+
+/**
+    Description:
+        Formats the given integer value with the integer format given as
+        a template argument into the given storage and returns the number
+        of code units written to it, like the overload that takes the
+        format as an argument.
+*/
+template <
+    integer_format Format,
+    std::integral Input
+>
+std::size_t
+format_integer_to (
+    Input input,
+    std::span<char8_t> target
+);
+
 /**
     Description:
         Formats the given floating-point value with the given
         floating-point format and returns the formatted string.
+
+        In radix 10, a value is written with the fewest significant
+        digits that read back as the same value, and zeros after them
+        where the notation needs more. With a radix place limit, it is
+        correctly rounded to that many places, which are padded with
+        zeros when the limit is exactly_equal. Infinities and NaNs are
+        written as "inf" and "nan".
 */
 template <
     writable_raii_text_object Output,
@@ -89,8 +339,27 @@ format_floating_point (
     const floating_point_format& format
 );
 
+/**
+    Description:
+        Formats the given floating-point value with the floating-point
+        format given as a template argument and returns the formatted
+        string. The code is specialized for the format.
+*/
+template <
+    writable_raii_text_object Output,
+    floating_point_format Format,
+    std::floating_point Input
+>
+Output
+format_floating_point (
+    Input input
+);
+
 } // namespace ----------------------------------------------------------------
 
 #include <cmp/unicode/formatters.ipp>
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/unicode/formatters.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
 
 #endif // CMP_UNICODE_FORMATTERS_HPP_INCLUDED
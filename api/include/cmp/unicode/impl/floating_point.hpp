@@ -0,0 +1,153 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_UNICODE_IMPL_FLOATING_POINT_HPP_INCLUDED
+#define CMP_UNICODE_IMPL_FLOATING_POINT_HPP_INCLUDED
+
+#include <cstdint>
+#include <string_view>
+
+#include <cmp/core/platform.hpp>
+#include <cmp/unicode/inclusion_assert.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+// Types ----------------------------------------------------------------------
+
+/*
+    A decimal floating-point value, which is the significand times ten
+    to the power of the exponent.
+*/
+struct decimal_floating_point {
+    std::uint64_t significand;
+    int exponent;
+}; // struct ------------------------------------------------------------------
+
+// Constants ------------------------------------------------------------------
+
+/*
+    The number of significant digits of a decimal value that are enough
+    to compare it with any value halfway between two binary values of
+    double or float.
+*/
+inline constexpr int max_compared_digit_count{768};
+
+// Free Functions -------------------------------------------------------------
+
+/*
+    These return the shortest decimal value that reads back as the
+    magnitude of the given finite value, and the one closest to it when
+    there are several, after "Ryū: Fast Float-to-String Conversion" by
+    Adams. The sign is ignored and zero gives a zero significand.
+*/
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+decimal_floating_point
+to_shortest_decimal (
+    double value
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+decimal_floating_point
+to_shortest_decimal (
+    float value
+)
+noexcept;
+
+/*
+    Returns the shortest decimal value that reads back as the binary
+    value that is the given significand times two to the power of the
+    given exponent, where the significand has at most 54 bits. The lower
+    bound of the values that read back as it is half as far from it as
+    the upper one when the significand is a power of two that isn't the
+    smallest one of its format.
+*/
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+decimal_floating_point
+to_shortest_decimal (
+    std::uint64_t binary_significand,
+    int binary_exponent,
+    bool has_closer_lower_bound
+)
+noexcept;
+
+/*
+    These return the binary value nearest to the given decimal
+    significand times ten to the power of the given exponent, with ties
+    rounded to the even one. The result is only sure to be right when
+    the significand holds every significant digit of the value; when it
+    doesn't, the results for it and for it plus one are the same unless
+    the value is near halfway between them, which compare_with_halfway
+    tells.
+*/
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+double
+to_nearest_double (
+    std::uint64_t decimal_significand,
+    int decimal_exponent
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+float
+to_nearest_float (
+    std::uint64_t decimal_significand,
+    int decimal_exponent
+)
+noexcept;
+
+/*
+    Compares the decimal value with the given significant digits, which
+    are ASCII digits followed by nonzero digits if has_nonzero_digits_after
+    is true, and whose last one is worth ten to the power of the given
+    exponent, with the value halfway between the binary value that is the
+    given significand times two to the power of the given exponent and
+    the next one up. Returns a negative number, zero or a positive number
+    when the decimal value is below, at or above it. There can be up to
+    max_compared_digit_count digits, and the decimal value has to be
+    within a few binary values of the halfway one.
+*/
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+int
+compare_with_halfway (
+    std::string_view digits,
+    bool has_nonzero_digits_after,
+    int decimal_exponent,
+    std::uint64_t binary_significand,
+    int binary_exponent
+)
+noexcept;
+
+/*
+    Returns the high 64 bits of the 128-bit product of the given values
+    and stores the low 64 bits in the given one.
+*/
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::uint64_t
+multiply_64_to_128 (
+    std::uint64_t a,
+    std::uint64_t b,
+    std::uint64_t& low
+)
+noexcept;
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/unicode/impl/floating_point.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_UNICODE_IMPL_FLOATING_POINT_HPP_INCLUDED
@@ -0,0 +1,317 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_UNICODE_IMPL_TRANSCODING_HPP_INCLUDED
+#define CMP_UNICODE_IMPL_TRANSCODING_HPP_INCLUDED
+
+#include <cstddef>
+#include <type_traits>
+
+#include <cmp/core/platform.hpp>
+#include <cmp/unicode/inclusion_assert.hpp>
+#include <cmp/unicode/by_code_point.hpp>
+#include <cmp/unicode/constants.hpp>
+#include <cmp/unicode/examiners.hpp>
+#include <cmp/unicode/exceptions.hpp>
+#include <cmp/unicode/impl/validation.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+// Types ----------------------------------------------------------------------
+
+/*
+    The code unit type of the encoding form that the given code unit type
+    is in, which is what the vector kernels below work with.
+*/
+template <
+    typename CodeUnit
+>
+using encoding_form_unit_t = std::conditional_t<
+    std::is_same_v<CodeUnit, wchar_t>,
+    std::conditional_t<sizeof (wchar_t) == 2, char16_t, char32_t>,
+    CodeUnit
+>;
+
+template <
+    typename CodeUnit
+>
+constexpr bool is_transcodable_unit_v{
+    std::is_same_v<CodeUnit, char8_t>
+        || std::is_same_v<CodeUnit, char16_t>
+        || std::is_same_v<CodeUnit, char32_t>
+        || std::is_same_v<CodeUnit, wchar_t>
+};
+
+// Free Functions -------------------------------------------------------------
+
+/*
+    Returns the number of code units that the given code units take up
+    once they're transcoded to the output code unit type. Throws what
+    by_code_point would throw if the input isn't valid, and throws
+    invalid_code_point if the input holds a code point that the output
+    can't encode.
+*/
+template <
+    typename OutputCodeUnit,
+    typename InputCodeUnit
+>
+std::size_t
+measure_transcoding (
+    const InputCodeUnit* input,
+    std::size_t input_size
+);
+
+/*
+    Transcodes the given code units into the given output, which has to
+    have room for as many code units as measure_transcoding returns. The
+    input has to have been measured first, since this doesn't validate
+    it.
+*/
+template <
+    typename OutputCodeUnit,
+    typename InputCodeUnit
+>
+void
+transcode_unchecked (
+    const InputCodeUnit* input,
+    std::size_t input_size,
+    OutputCodeUnit* output
+)
+noexcept;
+
+/*
+    Returns the offset of the first surrogate encoded in the given UTF-8
+    code units, which have to be valid, or the number of code units if
+    there is none. Those are valid input, but they aren't code points
+    that can be written as UTF-8.
+*/
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+find_encoded_surrogate (
+    const char8_t* input,
+    std::size_t input_size
+)
+noexcept;
+
+/*
+    These transcode the longest run of whole blocks at the beginning of
+    the given code units that are all ASCII, or for UTF-16 and UTF-32 all
+    in the BMP, and return the number of code units in it, which is the
+    same for the input and the output. The first six pick the fastest of
+    the kernels below that the processor supports, the first time that
+    they're called, and do nothing where there are no vector kernels.
+
+    The kernels only touch memory with vector loads and stores, so they
+    can be handed the code units of wide strings too.
+*/
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+transcode_fast_run (
+    const char8_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+transcode_fast_run (
+    const char8_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+transcode_fast_run (
+    const char16_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+transcode_fast_run (
+    const char16_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+transcode_fast_run (
+    const char32_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+transcode_fast_run (
+    const char32_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept;
+
+#if defined(CMP_ARCHITECTURE_X86)
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char8_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char8_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char16_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char16_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char32_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char32_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char8_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char8_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char16_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char16_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char32_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char32_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept;
+
+#endif // CMP_ARCHITECTURE_X86
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#include <cmp/unicode/impl/transcoding.ipp>
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/unicode/impl/transcoding.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_UNICODE_IMPL_TRANSCODING_HPP_INCLUDED
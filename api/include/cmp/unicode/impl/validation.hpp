@@ -0,0 +1,156 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_UNICODE_IMPL_VALIDATION_HPP_INCLUDED
+#define CMP_UNICODE_IMPL_VALIDATION_HPP_INCLUDED
+
+#include <cstddef>
+
+#include <cmp/core/platform.hpp>
+#include <cmp/unicode/inclusion_assert.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+// Free Functions -------------------------------------------------------------
+
+/*
+    These return the offset of the first code point that is invalid in
+    the given code units, or the number of code units if they're all
+    valid. UTF-8 is valid when every sequence has the right number of
+    trailing bytes and decodes to a code point no greater than the
+    maximum, which is what by_code_point accepts. UTF-16 is valid when
+    every surrogate is part of a pair.
+
+    The first two pick the fastest of the kernels below that the
+    processor supports, the first time that they're called.
+*/
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+find_invalid_utf8 (
+    const char8_t* data,
+    std::size_t size
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+find_invalid_utf16 (
+    const char16_t* data,
+    std::size_t size
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+find_invalid_utf8_scalar (
+    const char8_t* data,
+    std::size_t size
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+find_invalid_utf16_scalar (
+    const char16_t* data,
+    std::size_t size
+)
+noexcept;
+
+/*
+    The vector kernels stop at the first block of code units that holds
+    an error, and these find where the error is from the last position
+    before the given block where a code point is known to start.
+*/
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+find_invalid_utf8_from_block (
+    const char8_t* data,
+    std::size_t size,
+    std::size_t block_position
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+std::size_t
+find_invalid_utf16_from_block (
+    const char16_t* data,
+    std::size_t size,
+    std::size_t block_position
+)
+noexcept;
+
+#if defined(CMP_ARCHITECTURE_X86)
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+bool
+is_sse4_supported ()
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+bool
+is_avx2_supported ()
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+find_invalid_utf8_sse4 (
+    const char8_t* data,
+    std::size_t size
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+find_invalid_utf8_avx2 (
+    const char8_t* data,
+    std::size_t size
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+find_invalid_utf16_sse4 (
+    const char16_t* data,
+    std::size_t size
+)
+noexcept;
+
+CMP_CONDITIONAL_INLINE
+CMP_LIBRARY_NAME
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+find_invalid_utf16_avx2 (
+    const char16_t* data,
+    std::size_t size
+)
+noexcept;
+
+#endif // CMP_ARCHITECTURE_X86
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#if CMP_CONFIG_HEADER_ONLY == true
+#   include <cmp/unicode/impl/validation.cpp>
+#endif // CMP_CONFIG_HEADER_ONLY
+
+#endif // CMP_UNICODE_IMPL_VALIDATION_HPP_INCLUDED
@@ -5,41 +5,57 @@
 #define CMP_UNICODE_PARSERS_HPP_INCLUDED
 
 #include <algorithm>
+#include <bit>
+#include <charconv>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 #include <cmp/unicode/inclusion_assert.hpp>
 #include <cmp/core/general.hpp>
 #include <cmp/unicode/algorithms.hpp>
 #include <cmp/unicode/formats.hpp>
+#include <cmp/unicode/impl/floating_point.hpp>
 
 namespace cmp {
 
 namespace impl {
 
+/*
+    The format these take is either a format object or one of the
+    constant formats standing in for a format given as a template
+    argument.
+*/
 class CMP_LIBRARY_NAME number_parser {
 public:
     // Core -------------------------------------------------------------------
 
     template <
         std::integral Output,
-        text_object Input
+        text_object Input,
+        typename Format
     >
     static
     Output
     parse_integer (
         const Input& input,
-        const integer_format& format
+        const Format& format
     );
 
     template <
         std::floating_point Output,
-        text_object Input
+        text_object Input,
+        typename Format
     >
     static
     Output
     parse_floating_point (
         const Input& input,
-        const floating_point_format& format
+        const Format& format
     );
 
 private:
@@ -93,6 +109,51 @@ private:
         thousands_separator format_thousands_separator
     );
 
+    /*
+        Parses the given code units as an optional sign followed by ASCII
+        digits in radix 10, eight of them at a time in UTF-8, and stores
+        the value in the given output. Returns false without touching the
+        output when there is anything else among them, so that the
+        general parse can tell what is wrong. Throws when the value
+        doesn't fit in the output type.
+    */
+    template <
+        std::integral Output,
+        typename CodeUnit
+    >
+    static
+    bool
+    parse_decimal_integer (
+        std::basic_string_view<CodeUnit> input,
+        sign_status format_sign_status,
+        Output& output
+    );
+
+    /*
+        Returns true when all eight bytes of the given word, loaded from
+        UTF-8 in little-endian order, are ASCII digits.
+    */
+    static
+    constexpr
+    bool
+    is_made_of_eight_digits (
+        std::uint64_t word
+    )
+    noexcept;
+
+    /*
+        Returns the value of the eight ASCII digits in the given word,
+        loaded from UTF-8 in little-endian order, by combining them in
+        pairs, then in fours and then all together.
+    */
+    static
+    constexpr
+    std::uint32_t
+    parse_eight_digits (
+        std::uint64_t word
+    )
+    noexcept;
+
     template <
         std::integral Output
     >
@@ -107,6 +168,76 @@ private:
     )
     noexcept;
 
+    /*
+        Parses the code units of the given text, which are either those
+        of the input or those of its UTF-32 transcoding.
+    */
+    template <
+        std::floating_point Output,
+        typename CodeUnit,
+        typename Format
+    >
+    static
+    Output
+    parse_floating_point_code_units (
+        std::basic_string_view<CodeUnit> input,
+        const Format& format
+    );
+
+    /*
+        Parses the given code units in radix 10, where an exponent may
+        follow the digits, by collecting up to 19 significant digits and
+        converting them with impl::to_nearest_double or
+        impl::to_nearest_float. Only when there are more digits than that
+        and they leave the result in doubt are all of them compared with
+        the value halfway between the two candidates.
+    */
+    template <
+        std::floating_point Output,
+        typename CodeUnit,
+        typename Format
+    >
+    static
+    Output
+    parse_decimal_floating_point (
+        std::basic_string_view<CodeUnit> input,
+        const Format& format
+    );
+
+    /*
+        Copies the significant digits between the given code units into
+        the given storage, skipping any leading zeros, radix characters
+        and thousands separators, up to impl::max_compared_digit_count of
+        them, and returns how many were copied.
+    */
+    template <
+        typename CodeUnit
+    >
+    static
+    int
+    collect_digits (
+        const CodeUnit* begin,
+        const CodeUnit* end,
+        char* digits,
+        bool& has_nonzero_digits_after
+    )
+    noexcept;
+
+    /*
+        Returns the value of the given type nearest to the given decimal
+        significand times ten to the power of the given exponent.
+    */
+    template <
+        std::floating_point Output
+    >
+    static
+    Output
+    to_nearest (
+        std::uint64_t decimal_significand,
+        int decimal_exponent
+    )
+    noexcept;
+
     template <
         std::floating_point Output
     >
@@ -145,7 +276,8 @@ public:
         thousands_separator_missing,
         digit_character_expected,
         negative_unsigned,
-        wrong_place_limit
+        wrong_place_limit,
+        out_of_range
     }; // enum ----------------------------------------------------------------
 
     // Constructors and Destructor --------------------------------------------
@@ -281,6 +413,9 @@ parse_bool (
         Parses the input string and returns the corresponding integer value.
         The input string is expected to conform to the given integer format.
         If it doesn't, a <#type>parse_failed</#type> exception is thrown.
+
+        In radix 10 without thousands separators, a value that doesn't
+        fit in the output type is reported as out_of_range.
 */
 template <
     std::integral Output,
@@ -292,6 +427,23 @@ parse_integer (
     const integer_format& format
 );
 
+/**
+    Description:
+        Parses the input string and returns the corresponding integer value
+        like the overload that takes the integer format as an argument, but
+        with the integer format given as a template argument, for which
+        the code is specialized.
+*/
+template <
+    std::integral Output,
+    integer_format Format,
+    text_object Input
+>
+Output
+parse_integer (
+    const Input& input
+);
+
 /**
     Description:
         Parses the input string and returns the corresponding
@@ -309,6 +461,24 @@ parse_floating_point (
     const floating_point_format& format
 );
 
+/**
+    Description:
+        Parses the input string and returns the corresponding
+        floating-point value like the overload that takes the
+        floating-point format as an argument, but with the floating-point
+        format given as a template argument, for which the code is
+        specialized.
+*/
+template <
+    std::floating_point Output,
+    floating_point_format Format,
+    text_object Input
+>
+Output
+parse_floating_point (
+    const Input& input
+);
+
 } // namespace ----------------------------------------------------------------
 
 #include <cmp/unicode/parsers.ipp>
@@ -0,0 +1,326 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cmp/io/async_file.hpp>
+
+#if defined(CMP_OS_LINUX_BASED)
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace cmp {
+
+// ----------------------------------------------------------- cmp::async_file
+
+// Constructors and Destructor ------------------------------------------------
+
+async_file::async_file (
+    io_ring& ring
+)
+noexcept
+    : m_ring{&ring}
+    , m_file_descriptor{-1}
+    , m_access_mode{read_only}
+    , m_position{0}
+{
+} // function -----------------------------------------------------------------
+
+async_file::async_file (
+    io_ring& ring,
+    const std::filesystem::path& file_path,
+    access_mode mode,
+    if_not_there if_file_not_there
+)
+    : m_ring{&ring}
+    , m_file_descriptor{-1}
+    , m_access_mode{mode}
+    , m_position{0}
+{
+    open(file_path, mode, if_file_not_there);
+} // function -----------------------------------------------------------------
+
+async_file::~async_file ()
+{
+    close();
+} // function -----------------------------------------------------------------
+
+// Move Operations ------------------------------------------------------------
+
+async_file::async_file (
+    async_file&& other
+)
+noexcept
+    : m_ring{other.m_ring}
+    , m_file_descriptor{std::exchange(other.m_file_descriptor, -1)}
+    , m_access_mode{other.m_access_mode}
+    , m_position{std::exchange(other.m_position, 0)}
+{
+} // function -----------------------------------------------------------------
+
+async_file&
+async_file::operator = (
+    async_file&& other
+)
+noexcept
+{
+    if (this != &other) {
+        close();
+        m_ring = other.m_ring;
+        m_file_descriptor = std::exchange(other.m_file_descriptor, -1);
+        m_access_mode = other.m_access_mode;
+        m_position = std::exchange(other.m_position, 0);
+    }
+    return *this;
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+bool
+async_file::is_open ()
+const noexcept
+{
+    return m_file_descriptor != -1;
+} // function -----------------------------------------------------------------
+
+access_mode
+async_file::get_access_mode ()
+const noexcept
+{
+    return m_access_mode;
+} // function -----------------------------------------------------------------
+
+io_ring&
+async_file::get_ring ()
+const noexcept
+{
+    return *m_ring;
+} // function -----------------------------------------------------------------
+
+std::int64_t
+async_file::get_position ()
+const noexcept
+{
+    return m_position;
+} // function -----------------------------------------------------------------
+
+void
+async_file::set_position (
+    std::int64_t new_position
+)
+noexcept
+{
+    m_position = std::max<std::int64_t>(new_position, 0);
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+bool
+async_file::open (
+    const std::filesystem::path& file_path,
+    access_mode mode,
+    if_not_there if_file_not_there
+)
+noexcept
+{
+    if (is_open()) {
+        close();
+    }
+    int flags{O_RDONLY};
+    switch (mode) {
+        case read_only:
+            flags = O_RDONLY;
+            break;
+        case write_only:
+            flags = O_WRONLY;
+            break;
+        case read_and_write:
+            flags = O_RDWR;
+            break;
+    }
+    if (if_file_not_there == if_not_there::create) {
+        flags |= O_CREAT;
+    }
+    m_file_descriptor = ::open(file_path.string().c_str(), flags, 0777);
+    m_access_mode = mode;
+    m_position = 0;
+    return is_open();
+} // function -----------------------------------------------------------------
+
+void
+async_file::close ()
+noexcept
+{
+    if (is_open()) {
+        ::close(m_file_descriptor);
+    }
+    m_file_descriptor = -1;
+} // function -----------------------------------------------------------------
+
+void
+async_file::read (
+    std::span<std::byte> data,
+    completion_handler handler
+) {
+    impl::submission_fields fields{
+        make_fields(IORING_OP_READ, m_position, data.data(), data.size())
+    };
+    m_position += static_cast<std::int64_t>(data.size());
+    m_ring->queue(fields, io_ring::no_slot, std::move(handler), nullptr);
+} // function -----------------------------------------------------------------
+
+void
+async_file::read_at (
+    std::int64_t offset,
+    std::span<std::byte> data,
+    completion_handler handler
+) {
+    m_ring->queue(
+        make_fields(IORING_OP_READ, offset, data.data(), data.size()),
+        io_ring::no_slot,
+        std::move(handler),
+        nullptr
+    );
+} // function -----------------------------------------------------------------
+
+void
+async_file::read_slot (
+    std::size_t slot,
+    completion_handler handler
+) {
+    m_ring->queue(make_slot_fields(slot), slot, std::move(handler), nullptr);
+} // function -----------------------------------------------------------------
+
+void
+async_file::write (
+    std::span<const std::byte> data,
+    completion_handler handler
+) {
+    impl::submission_fields fields{
+        make_fields(IORING_OP_WRITE, m_position, data.data(), data.size())
+    };
+    m_position += static_cast<std::int64_t>(data.size());
+    m_ring->queue(fields, io_ring::no_slot, std::move(handler), nullptr);
+} // function -----------------------------------------------------------------
+
+void
+async_file::write_at (
+    std::int64_t offset,
+    std::span<const std::byte> data,
+    completion_handler handler
+) {
+    m_ring->queue(
+        make_fields(IORING_OP_WRITE, offset, data.data(), data.size()),
+        io_ring::no_slot,
+        std::move(handler),
+        nullptr
+    );
+} // function -----------------------------------------------------------------
+
+async_file::awaitable
+async_file::read_async (
+    std::span<std::byte> data
+) {
+    impl::submission_fields fields{
+        make_fields(IORING_OP_READ, m_position, data.data(), data.size())
+    };
+    m_position += static_cast<std::int64_t>(data.size());
+    return {*m_ring, fields, io_ring::no_slot};
+} // function -----------------------------------------------------------------
+
+async_file::awaitable
+async_file::read_at_async (
+    std::int64_t offset,
+    std::span<std::byte> data
+) {
+    return {
+        *m_ring,
+        make_fields(IORING_OP_READ, offset, data.data(), data.size()),
+        io_ring::no_slot
+    };
+} // function -----------------------------------------------------------------
+
+async_file::awaitable
+async_file::read_slot_async (
+    std::size_t slot
+) {
+    return {*m_ring, make_slot_fields(slot), slot};
+} // function -----------------------------------------------------------------
+
+async_file::awaitable
+async_file::write_async (
+    std::span<const std::byte> data
+) {
+    impl::submission_fields fields{
+        make_fields(IORING_OP_WRITE, m_position, data.data(), data.size())
+    };
+    m_position += static_cast<std::int64_t>(data.size());
+    return {*m_ring, fields, io_ring::no_slot};
+} // function -----------------------------------------------------------------
+
+async_file::awaitable
+async_file::write_at_async (
+    std::int64_t offset,
+    std::span<const std::byte> data
+) {
+    return {
+        *m_ring,
+        make_fields(IORING_OP_WRITE, offset, data.data(), data.size()),
+        io_ring::no_slot
+    };
+} // function -----------------------------------------------------------------
+
+// Private Functions ----------------------------------------------------------
+
+impl::submission_fields
+async_file::make_fields (
+    std::uint8_t opcode,
+    std::int64_t offset,
+    const std::byte* data,
+    std::size_t byte_count
+)
+const
+{
+    if (
+        (opcode == IORING_OP_READ && m_access_mode == write_only)
+            || (opcode == IORING_OP_WRITE && m_access_mode == read_only)
+    ) {
+        throw invalid_access_mode{};
+    }
+
+    /*
+        A single request can't transfer more bytes than fit in 32 bits,
+        so larger requests simply complete with a short count.
+    */
+    impl::submission_fields fields{};
+    fields.opcode = opcode;
+    fields.file_descriptor = m_file_descriptor;
+    fields.offset = static_cast<std::uint64_t>(offset);
+    fields.address = reinterpret_cast<std::uint64_t>(data);
+    fields.length = static_cast<std::uint32_t>(std::min<std::size_t>(
+        byte_count,
+        std::numeric_limits<std::uint32_t>::max()
+    ));
+    return fields;
+} // function -----------------------------------------------------------------
+
+impl::submission_fields
+async_file::make_slot_fields (
+    std::size_t slot
+) {
+    if (m_access_mode == write_only) {
+        throw invalid_access_mode{};
+    }
+    impl::submission_fields fields{
+        m_ring->make_slot_read_fields(m_file_descriptor, m_position, slot)
+    };
+    m_position += static_cast<std::int64_t>(fields.length);
+    return fields;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#endif // CMP_OS_LINUX_BASED
@@ -1,6 +1,8 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <algorithm>
+
 #include <cmp/io/file.hpp>
 
 namespace cmp {
@@ -15,7 +17,9 @@ noexcept
     , seekable_io_resource{io_buffer::default_buffer_capacity}
     , m_file_path{}
     , m_access_mode{read_only}
-    , m_last_fill_amount{0}
+    , m_native_position{0}
+    , m_file_size{0}
+    , m_end_tracking{end_tracking::cached}
 {
 } // function -----------------------------------------------------------------
 
@@ -28,7 +32,9 @@ basic_file::basic_file (
     , seekable_io_resource{buffer_capacity}
     , m_file_path{file_path}
     , m_access_mode{mode}
-    , m_last_fill_amount{0}
+    , m_native_position{0}
+    , m_file_size{0}
+    , m_end_tracking{end_tracking::cached}
 {
 } // function -----------------------------------------------------------------
 
@@ -45,7 +51,134 @@ bool
 basic_file::is_at_end ()
 const noexcept
 {
-    return get_position() == std::filesystem::file_size(m_file_path);
+    /*
+        Bytes left in the buffer settle the question without having to
+        wait for the block being read ahead.
+    */
+    if (
+        !m_buffer.is_read_dirty()
+            && !m_buffer.is_write_dirty()
+            && m_buffer.get_position() < m_buffer.get_size()
+    ) {
+        return false;
+    }
+
+    std::int64_t position{get_position()};
+    if (position < m_file_size) {
+        return false;
+    }
+
+    /*
+        The cached size says that we're at the end, but a file that's
+        being appended to by someone else may have grown since we last
+        looked at it, so in that case we ask the operating system.
+    */
+    if (m_end_tracking == end_tracking::growing) {
+        return position >= query_size();
+    }
+    return true;
+} // function -----------------------------------------------------------------
+
+std::int64_t
+basic_file::get_position ()
+const noexcept
+{
+    /*
+        The native position always sits at the end of the bytes that
+        the buffer mirrors. When the buffer holds bytes read from the
+        file, they're the ones right before the native position, and
+        when it holds bytes waiting to be written, they're the ones
+        right after it. Otherwise, the buffer mirrors nothing and the
+        native position is the position. A block read ahead sits
+        between the bytes in the buffer and the native position, so
+        we wait for it to arrive before looking at the native position.
+    */
+    const std::int64_t pending_byte_count{
+        static_cast<std::int64_t>(m_read_ahead.get_pending_count())
+    };
+    if (m_buffer.is_write_dirty()) {
+        return m_native_position + m_buffer.get_position();
+    }
+    if (m_buffer.is_read_dirty()) {
+        return m_native_position;
+    }
+    return m_native_position - pending_byte_count
+        - m_buffer.get_size() + m_buffer.get_position();
+} // function -----------------------------------------------------------------
+
+void
+basic_file::set_position (
+    std::int64_t new_position,
+    position_reference pr
+)
+noexcept
+{
+    this->flush();
+    cancel_read_ahead();
+
+    /*
+        If the buffer holds bytes read from the file and the new position
+        is among them, we just move the position of the buffer. Seeking
+        relative to the end is left to the operating system, since the
+        cached size of a growing file may be out of date.
+    */
+    if (!m_buffer.is_read_dirty() && pr != position_reference::end) {
+        std::int64_t target{new_position};
+        if (pr == position_reference::current) {
+            target += get_position();
+        }
+        const std::int64_t window_begin{
+            m_native_position - static_cast<std::int64_t>(m_buffer.get_size())
+        };
+        if (target >= window_begin && target <= m_native_position) {
+            m_buffer.set_position(
+                static_cast<std::size_t>(target - window_begin)
+            );
+            return;
+        }
+    }
+
+    set_position_raw(new_position, pr);
+    m_buffer.set_read_dirty(true);
+} // function -----------------------------------------------------------------
+
+end_tracking
+basic_file::get_end_tracking ()
+const noexcept
+{
+    return m_end_tracking;
+} // function -----------------------------------------------------------------
+
+void
+basic_file::set_end_tracking (
+    end_tracking new_end_tracking
+)
+noexcept
+{
+    m_end_tracking = new_end_tracking;
+} // function -----------------------------------------------------------------
+
+read_ahead
+basic_file::get_read_ahead ()
+const noexcept
+{
+    return m_read_ahead.is_enabled() ? read_ahead::background
+                                     : read_ahead::none;
+} // function -----------------------------------------------------------------
+
+void
+basic_file::set_read_ahead (
+    read_ahead new_read_ahead
+) {
+    if (new_read_ahead == get_read_ahead()) {
+        return;
+    }
+    if (new_read_ahead == read_ahead::background) {
+        m_read_ahead.enable();
+    } else {
+        cancel_read_ahead();
+        m_read_ahead.disable();
+    }
 } // function -----------------------------------------------------------------
 
 // Core -----------------------------------------------------------------------
@@ -58,6 +191,7 @@ basic_file::read (
     switch (m_access_mode) {
         case read_only:
         case read_and_write: {
+            prepare_for_reading();
             return input_resource::read(data, byte_count);
         }
         case write_only:
@@ -65,6 +199,21 @@ basic_file::read (
     }
 } // function -----------------------------------------------------------------
 
+std::span<const std::byte>
+basic_file::peek_view (
+    std::size_t min_bytes
+) {
+    switch (m_access_mode) {
+        case read_only:
+        case read_and_write: {
+            prepare_for_reading();
+            return input_resource::peek_view(min_bytes);
+        }
+        case write_only:
+            throw invalid_access_mode{};
+    }
+} // function -----------------------------------------------------------------
+
 std::size_t
 basic_file::write (
     const std::byte* data,
@@ -75,9 +224,114 @@ basic_file::write (
             throw invalid_access_mode{};
         case write_only:
         case read_and_write: {
+            prepare_for_writing();
             return output_resource::write(data, byte_count);
         }
     }
 } // function -----------------------------------------------------------------
 
+std::size_t
+basic_file::write_gather (
+    std::span<const std::span<const std::byte>> pieces
+) {
+    switch (m_access_mode) {
+        case read_only:
+            throw invalid_access_mode{};
+        case write_only:
+        case read_and_write: {
+            prepare_for_writing();
+            return output_resource::write_gather(pieces);
+        }
+    }
+} // function -----------------------------------------------------------------
+
+std::size_t
+basic_file::read_at (
+    std::int64_t offset,
+    std::span<std::byte> data
+)
+const
+{
+    switch (m_access_mode) {
+        case read_only:
+        case read_and_write:
+            return read_at_raw(std::max<std::int64_t>(offset, 0), data);
+        case write_only:
+            throw invalid_access_mode{};
+    }
+} // function -----------------------------------------------------------------
+
+std::size_t
+basic_file::write_at (
+    std::int64_t offset,
+    std::span<const std::byte> data
+) {
+    switch (m_access_mode) {
+        case read_only:
+            throw invalid_access_mode{};
+        case write_only:
+        case read_and_write:
+            return write_at_raw(std::max<std::int64_t>(offset, 0), data);
+    }
+} // function -----------------------------------------------------------------
+
+// Protected Functions --------------------------------------------------------
+
+void
+basic_file::advance_native_position (
+    std::size_t byte_count
+)
+noexcept
+{
+    m_native_position += static_cast<std::int64_t>(byte_count);
+    if (byte_count > 0 && m_native_position > m_file_size) {
+        m_file_size = m_native_position;
+    }
+} // function -----------------------------------------------------------------
+
+void
+basic_file::cancel_read_ahead ()
+noexcept
+{
+    const std::size_t pending_byte_count{m_read_ahead.get_pending_count()};
+    m_read_ahead.discard();
+    if (pending_byte_count > 0) {
+        set_position_raw(
+            m_native_position - static_cast<std::int64_t>(pending_byte_count),
+            position_reference::begin
+        );
+    }
+} // function -----------------------------------------------------------------
+
+// Private Functions ----------------------------------------------------------
+
+void
+basic_file::prepare_for_reading ()
+{
+    if (m_buffer.is_write_dirty()) {
+        this->flush();
+        m_buffer.set_read_dirty(true);
+    }
+} // function -----------------------------------------------------------------
+
+void
+basic_file::prepare_for_writing ()
+noexcept
+{
+    cancel_read_ahead();
+    if (m_buffer.is_read_dirty()) {
+        return;
+    }
+
+    /*
+        The native position is past the bytes in the buffer that haven't
+        been read yet, so if there are any, we have to bring the native
+        position back to the logical position before writing.
+    */
+    if (m_buffer.get_position() < m_buffer.get_size()) {
+        set_position_raw(get_position(), position_reference::begin);
+    }
+    m_buffer.set_read_dirty(true);
+} // function -----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
@@ -1,8 +1,17 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <cmp/core/platform.hpp>
 #include <cmp/io/general.hpp>
 
+#if defined(CMP_ARCHITECTURE_X86_64)
+#   include <emmintrin.h>
+#endif // CMP_ARCHITECTURE_X86_64
+
 namespace cmp {
 
 // Free Functions -------------------------------------------------------------
@@ -14,6 +23,18 @@ invert_endianness (
 )
 noexcept
 {
+    switch (byte_count) {
+        case 2:
+            impl::invert_endianness_of_16_bit_elements(data, 1);
+            return;
+        case 4:
+            impl::invert_endianness_of_32_bit_elements(data, 1);
+            return;
+        case 8:
+            impl::invert_endianness_of_64_bit_elements(data, 1);
+            return;
+    }
+
     std::byte* begin{data};
     std::byte* end{data + byte_count - 1};
     while (begin < end) {
@@ -21,4 +42,142 @@ noexcept
     }
 } // function -----------------------------------------------------------------
 
+void
+invert_endianness_of_elements (
+    std::byte* data,
+    std::size_t element_size,
+    std::size_t element_count
+)
+noexcept
+{
+    switch (element_size) {
+        case 1:
+            return;
+        case 2:
+            impl::invert_endianness_of_16_bit_elements(data, element_count);
+            return;
+        case 4:
+            impl::invert_endianness_of_32_bit_elements(data, element_count);
+            return;
+        case 8:
+            impl::invert_endianness_of_64_bit_elements(data, element_count);
+            return;
+    }
+
+    for (std::size_t i{0}; i < element_count; ++i) {
+        invert_endianness(data + i * element_size, element_size);
+    }
+} // function -----------------------------------------------------------------
+
+namespace impl {
+
+/*
+    SSE2 is always there on x86-64, and it's enough to do sixteen bytes
+    at once: the bytes of each 16-bit lane are swapped with shifts, after
+    the lanes of wider elements are put in reverse order. The scalar
+    loops are written so that compilers turn them into byte swap
+    instructions.
+*/
+
+void
+invert_endianness_of_16_bit_elements (
+    std::byte* data,
+    std::size_t element_count
+)
+noexcept
+{
+    std::size_t i{0};
+#if defined(CMP_ARCHITECTURE_X86_64)
+    for (; i + 8 <= element_count; i += 8) {
+        auto* address{reinterpret_cast<__m128i*>(data + i * 2)};
+        __m128i vector{_mm_loadu_si128(address)};
+        vector = _mm_or_si128(
+            _mm_slli_epi16(vector, 8),
+            _mm_srli_epi16(vector, 8)
+        );
+        _mm_storeu_si128(address, vector);
+    }
+#endif // CMP_ARCHITECTURE_X86_64
+    for (; i < element_count; ++i) {
+        std::uint16_t element;
+        std::memcpy(&element, data + i * 2, 2);
+        element = static_cast<std::uint16_t>((element << 8) | (element >> 8));
+        std::memcpy(data + i * 2, &element, 2);
+    }
+} // function -----------------------------------------------------------------
+
+void
+invert_endianness_of_32_bit_elements (
+    std::byte* data,
+    std::size_t element_count
+)
+noexcept
+{
+    std::size_t i{0};
+#if defined(CMP_ARCHITECTURE_X86_64)
+    for (; i + 4 <= element_count; i += 4) {
+        auto* address{reinterpret_cast<__m128i*>(data + i * 4)};
+        __m128i vector{_mm_loadu_si128(address)};
+        vector = _mm_shufflehi_epi16(
+            _mm_shufflelo_epi16(vector, 0b10'11'00'01),
+            0b10'11'00'01
+        );
+        vector = _mm_or_si128(
+            _mm_slli_epi16(vector, 8),
+            _mm_srli_epi16(vector, 8)
+        );
+        _mm_storeu_si128(address, vector);
+    }
+#endif // CMP_ARCHITECTURE_X86_64
+    for (; i < element_count; ++i) {
+        std::uint32_t element;
+        std::memcpy(&element, data + i * 4, 4);
+        element = (element << 24)
+            | ((element << 8) & 0x00FF'0000)
+            | ((element >> 8) & 0x0000'FF00)
+            | (element >> 24);
+        std::memcpy(data + i * 4, &element, 4);
+    }
+} // function -----------------------------------------------------------------
+
+void
+invert_endianness_of_64_bit_elements (
+    std::byte* data,
+    std::size_t element_count
+)
+noexcept
+{
+    std::size_t i{0};
+#if defined(CMP_ARCHITECTURE_X86_64)
+    for (; i + 2 <= element_count; i += 2) {
+        auto* address{reinterpret_cast<__m128i*>(data + i * 8)};
+        __m128i vector{_mm_loadu_si128(address)};
+        vector = _mm_shufflehi_epi16(
+            _mm_shufflelo_epi16(vector, 0b00'01'10'11),
+            0b00'01'10'11
+        );
+        vector = _mm_or_si128(
+            _mm_slli_epi16(vector, 8),
+            _mm_srli_epi16(vector, 8)
+        );
+        _mm_storeu_si128(address, vector);
+    }
+#endif // CMP_ARCHITECTURE_X86_64
+    for (; i < element_count; ++i) {
+        std::uint64_t element;
+        std::memcpy(&element, data + i * 8, 8);
+        element = (element << 56)
+            | ((element << 40) & 0x00FF'0000'0000'0000)
+            | ((element << 24) & 0x0000'FF00'0000'0000)
+            | ((element << 8) & 0x0000'00FF'0000'0000)
+            | ((element >> 8) & 0x0000'0000'FF00'0000)
+            | ((element >> 24) & 0x0000'0000'00FF'0000)
+            | ((element >> 40) & 0x0000'0000'0000'FF00)
+            | (element >> 56);
+        std::memcpy(data + i * 8, &element, 8);
+    }
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
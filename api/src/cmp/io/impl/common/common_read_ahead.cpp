@@ -0,0 +1,242 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <utility>
+
+#include <cmp/io/impl/common/common_read_ahead.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+// ---------------------------------------------- cmp::impl::read_ahead_worker
+
+// Constructors and Destructor ------------------------------------------------
+
+read_ahead_worker::read_ahead_worker ()
+noexcept
+    : m_state{}
+    , m_thread{}
+{
+} // function -----------------------------------------------------------------
+
+read_ahead_worker::~read_ahead_worker ()
+{
+    disable();
+} // function -----------------------------------------------------------------
+
+// Copy Operations ------------------------------------------------------------
+
+read_ahead_worker::read_ahead_worker (
+    const read_ahead_worker&
+)
+noexcept
+    : m_state{}
+    , m_thread{}
+{
+    /* A copy starts without a pending block. */
+} // function -----------------------------------------------------------------
+
+read_ahead_worker&
+read_ahead_worker::operator = (
+    const read_ahead_worker&
+)
+noexcept
+{
+    disable();
+    return *this;
+} // function -----------------------------------------------------------------
+
+// Move Operations ------------------------------------------------------------
+
+read_ahead_worker::read_ahead_worker (
+    read_ahead_worker&& other
+)
+noexcept
+    : m_state{}
+    , m_thread{}
+{
+    /*
+        The fill in flight was started with a reader bound to the object
+        that owned the other worker, so it has to complete before the
+        worker changes hands.
+    */
+    other.wait_noexcept();
+    m_state = std::move(other.m_state);
+    m_thread = std::move(other.m_thread);
+} // function -----------------------------------------------------------------
+
+read_ahead_worker&
+read_ahead_worker::operator = (
+    read_ahead_worker&& other
+)
+noexcept
+{
+    if (this != &other) {
+        disable();
+        other.wait_noexcept();
+        m_state = std::move(other.m_state);
+        m_thread = std::move(other.m_thread);
+    }
+    return *this;
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+bool
+read_ahead_worker::is_enabled ()
+const noexcept
+{
+    return m_state != nullptr;
+} // function -----------------------------------------------------------------
+
+io_buffer&
+read_ahead_worker::get_buffer ()
+noexcept
+{
+    return m_state->buffer;
+} // function -----------------------------------------------------------------
+
+std::size_t
+read_ahead_worker::get_pending_count ()
+const noexcept
+{
+    if (!m_state) {
+        return 0;
+    }
+    wait_noexcept();
+    return m_state->buffer.get_size() - m_state->buffer.get_position();
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+void
+read_ahead_worker::enable ()
+{
+    if (m_state) {
+        return;
+    }
+    m_state = std::make_unique<shared_state>();
+    m_thread = std::thread{&read_ahead_worker::run, m_state.get()};
+} // function -----------------------------------------------------------------
+
+void
+read_ahead_worker::disable ()
+noexcept
+{
+    if (!m_state) {
+        return;
+    }
+    {
+        std::lock_guard lock{m_state->mutex};
+        m_state->is_stopping = true;
+    }
+    m_state->condition.notify_all();
+    m_thread.join();
+    m_state.reset();
+} // function -----------------------------------------------------------------
+
+void
+read_ahead_worker::start (
+    std::size_t capacity,
+    reader fill_function
+) {
+    wait();
+    if (m_state->buffer.get_capacity() != capacity) {
+        m_state->buffer.set_capacity(capacity);
+    }
+    m_state->buffer.set_size(0);
+    m_state->buffer.set_position(0);
+    {
+        std::lock_guard lock{m_state->mutex};
+        m_state->fill_function = std::move(fill_function);
+        m_state->is_in_flight = true;
+    }
+    m_state->condition.notify_all();
+} // function -----------------------------------------------------------------
+
+void
+read_ahead_worker::wait ()
+const
+{
+    if (!m_state) {
+        return;
+    }
+    std::unique_lock lock{m_state->mutex};
+    m_state->condition.wait(lock, [this] {
+        return !m_state->is_in_flight;
+    });
+    if (m_state->exception) {
+        std::rethrow_exception(std::exchange(m_state->exception, nullptr));
+    }
+} // function -----------------------------------------------------------------
+
+void
+read_ahead_worker::discard ()
+noexcept
+{
+    if (!m_state) {
+        return;
+    }
+    wait_noexcept();
+    m_state->buffer.set_size(0);
+    m_state->buffer.set_position(0);
+    m_state->exception = nullptr;
+} // function -----------------------------------------------------------------
+
+// Private Functions ----------------------------------------------------------
+
+void
+read_ahead_worker::run (
+    shared_state* state
+) {
+    std::unique_lock lock{state->mutex};
+    while (true) {
+        state->condition.wait(lock, [state] {
+            return state->is_in_flight || state->is_stopping;
+        });
+        if (state->is_stopping) {
+            return;
+        }
+
+        /*
+            The owner doesn't touch the spare buffer while a fill is in
+            flight, so the lock isn't held while the reader runs.
+        */
+        lock.unlock();
+        std::size_t bytes_read{0};
+        std::exception_ptr exception;
+        try {
+            bytes_read = state->fill_function(
+                state->buffer.get_data_ptr(),
+                state->buffer.get_capacity()
+            );
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        lock.lock();
+
+        state->buffer.set_size(bytes_read);
+        state->exception = exception;
+        state->fill_function = nullptr;
+        state->is_in_flight = false;
+        state->condition.notify_all();
+    }
+} // function -----------------------------------------------------------------
+
+void
+read_ahead_worker::wait_noexcept ()
+const noexcept
+{
+    if (!m_state) {
+        return;
+    }
+    std::unique_lock lock{m_state->mutex};
+    m_state->condition.wait(lock, [this] {
+        return !m_state->is_in_flight;
+    });
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
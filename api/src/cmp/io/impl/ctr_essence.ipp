@@ -113,14 +113,20 @@ ctr_essence<Container>::read_raw (
     std::byte *data,
     std::size_t byte_count,
     cmp::read_request rr,
-    seekable_input_resource<std::int64_t>& resource
+    const io_buffer& buffer
 ) {
     using element_type = typename Container::value_type;
 
     const auto& content_ref{*get_const_content_ptr()};
 
-    if (rr == read_request::fill_buffer && m_last_fill_amount > 0) {
-        resource.go_forward(m_last_fill_amount);
+    /*
+        The position is kept at the beginning of the buffered window, so
+        before filling the buffer we move it past the previous window.
+        The position is in bytes, so we adjust it directly rather than
+        going through set_position_raw, which works in elements.
+    */
+    if (rr == read_request::fill_buffer) {
+        m_position += m_last_fill_amount;
     }
 
     /*
@@ -159,12 +165,14 @@ ctr_essence<Container>::read_raw (
     m_position += byte_count;
 
     /*
-        If the read request is meant to fill the buffer
-        then we go back by the number of bytes read.
+        If the read request is meant to fill the buffer then we go back
+        to the beginning of the buffered window, which starts with the
+        bytes that were kept in the buffer from the previous fill.
     */
     if (rr == read_request::fill_buffer) {
-        resource.go_back(static_cast<std::int64_t>(byte_count));
-        m_last_fill_amount = byte_count;
+        std::size_t kept_byte_count{buffer.get_size()};
+        m_position -= static_cast<std::int64_t>(kept_byte_count + byte_count);
+        m_last_fill_amount = kept_byte_count + byte_count;
     }
 
     return byte_count;
@@ -222,6 +230,74 @@ ctr_essence<Container>::write_raw (
     return byte_count;
 } // function -----------------------------------------------------------------
 
+template <
+    typename Container
+>
+std::size_t
+ctr_essence<Container>::read (
+    std::byte* data,
+    std::size_t byte_count
+)
+noexcept
+{
+    /*
+        The content is already in memory, so there's nothing to gain
+        from staging it in the buffer. We copy straight from the
+        content into the caller's array, which is the only copy made.
+    */
+    std::span<const std::byte> view{peek_view()};
+    if (byte_count > view.size()) {
+        byte_count = view.size();
+    }
+    if (byte_count > 0) {
+        std::memcpy(data, view.data(), byte_count);
+    }
+    m_position += static_cast<std::int64_t>(byte_count);
+    m_last_fill_amount = 0;
+    return byte_count;
+} // function -----------------------------------------------------------------
+
+template <
+    typename Container
+>
+std::span<const std::byte>
+ctr_essence<Container>::peek_view ()
+const noexcept
+{
+    using element_type = typename Container::value_type;
+
+    const auto& content_ref{*get_const_content_ptr()};
+
+    const std::size_t content_size{
+        std::size(content_ref) * sizeof (element_type)
+    };
+    const std::size_t position{static_cast<std::size_t>(m_position)};
+    if (position >= content_size) {
+        return {};
+    }
+    return {
+        reinterpret_cast<const std::byte*>(std::data(content_ref)) + position,
+        content_size - position
+    };
+} // function -----------------------------------------------------------------
+
+template <
+    typename Container
+>
+void
+ctr_essence<Container>::consume (
+    std::size_t byte_count
+)
+noexcept
+{
+    std::size_t available_byte_count{peek_view().size()};
+    if (byte_count > available_byte_count) {
+        byte_count = available_byte_count;
+    }
+    m_position += static_cast<std::int64_t>(byte_count);
+    m_last_fill_amount = 0;
+} // function -----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
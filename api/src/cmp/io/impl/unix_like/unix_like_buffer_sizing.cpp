@@ -0,0 +1,47 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include <cmp/io/impl/unix_like/unix_like_buffer_sizing.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+// Free Functions -------------------------------------------------------------
+
+std::size_t
+query_preferred_transfer_size (
+    int file_descriptor
+)
+noexcept
+{
+    struct stat file_status;
+    if (::fstat(file_descriptor, &file_status) == -1) {
+        return 0;
+    }
+
+    if (S_ISFIFO(file_status.st_mode)) {
+#if defined(F_GETPIPE_SZ)
+        int pipe_size{::fcntl(file_descriptor, F_GETPIPE_SZ)};
+        if (pipe_size > 0) {
+            return static_cast<std::size_t>(pipe_size);
+        }
+#endif
+    } else if (
+        !S_ISREG(file_status.st_mode) && !S_ISBLK(file_status.st_mode)
+    ) {
+        return 0;
+    }
+
+    if (file_status.st_blksize <= 0) {
+        return 0;
+    }
+    return static_cast<std::size_t>(file_status.st_blksize);
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -1,6 +1,9 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <algorithm>
+#include <limits>
+
 #include <cmp/io/impl/unix_like/unix_like_file.hpp>
 
 namespace cmp {
@@ -44,13 +47,6 @@ const noexcept
     return m_file_descriptor != -1;
 } // function -----------------------------------------------------------------
 
-std::int64_t
-file::get_position ()
-const noexcept
-{
-    return ::lseek(m_file_descriptor, 0, SEEK_CUR) + m_buffer.get_position();
-} // function -----------------------------------------------------------------
-
 // Core -----------------------------------------------------------------------
 
 bool
@@ -88,6 +84,12 @@ noexcept
     }
     m_file_descriptor = ::open(file_path.string().c_str(), flags, 0777);
     m_access_mode = mode;
+    m_buffer.set_read_dirty(true);
+    m_native_position = 0;
+    m_file_size = is_open() ? query_size() : 0;
+    if (is_open()) {
+        apply_preferred_buffer_capacity();
+    }
     return is_open();
 } // function -----------------------------------------------------------------
 
@@ -96,12 +98,87 @@ file::close ()
 noexcept
 {
     this->flush();
+    m_read_ahead.discard();
     ::close(m_file_descriptor);
     m_file_descriptor = -1;
 } // function -----------------------------------------------------------------
 
 // Protected Functions --------------------------------------------------------
 
+std::int64_t
+file::query_size ()
+const noexcept
+{
+    struct stat file_status;
+    if (::fstat(m_file_descriptor, &file_status) == -1) {
+        return m_file_size;
+    }
+    return file_status.st_size;
+} // function -----------------------------------------------------------------
+
+std::size_t
+file::query_preferred_buffer_capacity ()
+const noexcept
+{
+    return impl::query_preferred_transfer_size(m_file_descriptor);
+} // function -----------------------------------------------------------------
+
+std::size_t
+file::read_at_raw (
+    std::int64_t offset,
+    std::span<std::byte> data
+)
+const noexcept
+{
+    /*
+        pread doesn't use or move the offset of the file descriptor,
+        which is what lets many threads read through it at once.
+    */
+    const std::size_t ssize_t_max{
+        static_cast<std::size_t>(std::numeric_limits<ssize_t>::max())
+    };
+    std::size_t bytes_read_total{0};
+    while (bytes_read_total < data.size()) {
+        ssize_t bytes_read_last{::pread(
+            m_file_descriptor,
+            data.data() + bytes_read_total,
+            std::min(data.size() - bytes_read_total, ssize_t_max),
+            static_cast<off_t>(offset + bytes_read_total)
+        )};
+        if (bytes_read_last == -1 || bytes_read_last == 0) {
+            break;
+        }
+        bytes_read_total += bytes_read_last;
+    }
+    return bytes_read_total;
+} // function -----------------------------------------------------------------
+
+std::size_t
+file::write_at_raw (
+    std::int64_t offset,
+    std::span<const std::byte> data
+)
+const noexcept
+{
+    const std::size_t ssize_t_max{
+        static_cast<std::size_t>(std::numeric_limits<ssize_t>::max())
+    };
+    std::size_t bytes_written_total{0};
+    while (bytes_written_total < data.size()) {
+        ssize_t bytes_written_last{::pwrite(
+            m_file_descriptor,
+            data.data() + bytes_written_total,
+            std::min(data.size() - bytes_written_total, ssize_t_max),
+            static_cast<off_t>(offset + bytes_written_total)
+        )};
+        if (bytes_written_last == -1 || bytes_written_last == 0) {
+            break;
+        }
+        bytes_written_total += bytes_written_last;
+    }
+    return bytes_written_total;
+} // function -----------------------------------------------------------------
+
 void
 file::set_position_raw (
     std::int64_t new_position,
@@ -118,30 +195,52 @@ noexcept
             }
             break;
         case position_reference::current:
-            unix_like_position_reference = SEEK_CUR;
+            /*
+                The native position is generally not the logical
+                position, since it sits at the end of the bytes that
+                the buffer mirrors, so we seek relative to the latter.
+            */
+            unix_like_position_reference = SEEK_SET;
+            new_position += get_position();
+            if (new_position < 0) {
+                new_position = 0;
+            }
             break;
         case position_reference::end:
             unix_like_position_reference = SEEK_END;
             break;
     }
 
-    ::lseek(m_file_descriptor, new_position, unix_like_position_reference);
-
-    m_last_fill_amount = 0;
+    off_t native_position{
+        ::lseek(m_file_descriptor, new_position, unix_like_position_reference)
+    };
+    if (native_position != -1) {
+        /*
+            Seeking relative to the end tells us the size of the
+            file for free, so we refresh the cached size with it.
+        */
+        if (pr == position_reference::end) {
+            m_file_size = native_position - new_position;
+        }
+        m_native_position = native_position;
+    }
 } // function -----------------------------------------------------------------
 
 std::size_t
 file::read_raw (
     std::byte* data,
     std::size_t byte_count,
-    read_request rr
+    read_request
 )
 noexcept
 {
-    if (rr == read_request::fill_buffer && m_last_fill_amount > 0) {
-        go_forward(m_last_fill_amount);
-    }
-
+    /*
+        The native position always sits at the end of the bytes that the
+        buffer mirrors. A fill appends to those bytes, and a lean retrieval
+        only happens once they've all been read and leaves the buffer
+        read-dirty, so in both cases we read from wherever the native
+        position is, without seeking.
+    */
     std::size_t total_result;
     ssize_t native_bytes_read{0};
     const ssize_t ssize_t_max{std::numeric_limits<ssize_t>::max()};
@@ -158,7 +257,10 @@ noexcept
                 native_byte_count = ssize_t_max;
                 byte_count -= ssize_t_max;
             }
-            native_bytes_read = read_block(data, native_byte_count);
+            native_bytes_read = read_block(
+                data + bytes_read,
+                native_byte_count
+            );
             bytes_read += native_bytes_read;
             if (native_bytes_read != native_byte_count) {
                 break;
@@ -166,15 +268,7 @@ noexcept
         }
         total_result = bytes_read;
     }
-
-    /*
-        If the read request is meant to fill the buffer
-        then we go back by the number of bytes read.
-    */
-    if (rr == read_request::fill_buffer) {
-        go_back(static_cast<position_type>(total_result));
-        m_last_fill_amount = total_result;
-    }
+    advance_native_position(total_result);
 
     return total_result;
 } // function -----------------------------------------------------------------
@@ -202,7 +296,10 @@ noexcept
                 native_byte_count = ssize_t_max;
                 byte_count -= ssize_t_max;
             }
-            native_bytes_written = write_block(data, native_byte_count);
+            native_bytes_written = write_block(
+                data + bytes_written,
+                native_byte_count
+            );
             bytes_written += native_bytes_written;
             if (native_bytes_written != native_byte_count) {
                 break;
@@ -210,6 +307,21 @@ noexcept
         }
         total_result = bytes_written;
     }
+    advance_native_position(total_result);
+    return total_result;
+} // function -----------------------------------------------------------------
+
+std::size_t
+file::write_gather_raw (
+    std::span<const std::byte> pending,
+    std::span<const std::span<const std::byte>> pieces
+)
+noexcept
+{
+    std::size_t total_result{
+        impl::write_gather_to_descriptor(m_file_descriptor, pending, pieces)
+    };
+    advance_native_position(total_result);
     return total_result;
 } // function -----------------------------------------------------------------
 
@@ -225,7 +337,11 @@ noexcept
     ssize_t bytes_read_last;
     ssize_t bytes_read_total{0};
     while (true) {
-        bytes_read_last = ::read(m_file_descriptor, data, byte_count);
+        bytes_read_last = ::read(
+            m_file_descriptor,
+            data + bytes_read_total,
+            byte_count - bytes_read_total
+        );
         if (bytes_read_last == -1 || bytes_read_last == 0) {
             break;
         }
@@ -0,0 +1,166 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <utility>
+
+#include <cmp/io/impl/unix_like/unix_like_mapped_file.hpp>
+
+namespace cmp {
+
+// ---------------------------------------------------------- cmp::mapped_file
+
+// Constructors and Destructor ------------------------------------------------
+
+mapped_file::mapped_file ()
+noexcept
+    : transfer_resource{0}
+    , basic_mapped_file{}
+    , m_file_descriptor{-1}
+{
+} // function -----------------------------------------------------------------
+
+mapped_file::mapped_file (
+    const std::filesystem::path& file_path,
+    access_pattern pattern
+)
+    : transfer_resource{0}
+    , basic_mapped_file{pattern}
+    , m_file_descriptor{-1}
+{
+    open(file_path);
+} // function -----------------------------------------------------------------
+
+mapped_file::~mapped_file ()
+{
+    close();
+} // function -----------------------------------------------------------------
+
+// Move Operations ------------------------------------------------------------
+
+mapped_file::mapped_file (
+    mapped_file&& other
+)
+noexcept
+    : transfer_resource{std::move(other)}
+    , basic_mapped_file{std::move(other)}
+    , m_file_descriptor{std::exchange(other.m_file_descriptor, -1)}
+{
+} // function -----------------------------------------------------------------
+
+mapped_file&
+mapped_file::operator = (
+    mapped_file&& other
+)
+noexcept
+{
+    if (this != &other) {
+        close();
+        basic_mapped_file::operator = (std::move(other));
+        m_file_descriptor = std::exchange(other.m_file_descriptor, -1);
+    }
+    return *this;
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+bool
+mapped_file::is_open ()
+const noexcept
+{
+    return m_file_descriptor != -1;
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+bool
+mapped_file::open (
+    const std::filesystem::path& file_path
+)
+noexcept
+{
+    if (is_open()) {
+        close();
+    }
+    m_file_descriptor = ::open(file_path.string().c_str(), O_RDONLY);
+    if (!is_open()) {
+        return false;
+    }
+
+    struct stat file_status;
+    if (::fstat(m_file_descriptor, &file_status) == -1) {
+        close();
+        return false;
+    }
+
+    /*
+        Mapping zero bytes fails, so an empty file stays open
+        without a mapping and simply reads as being at its end.
+    */
+    if (file_status.st_size > 0) {
+        void* mapping{::mmap(
+            nullptr,
+            static_cast<std::size_t>(file_status.st_size),
+            PROT_READ,
+            MAP_PRIVATE,
+            m_file_descriptor,
+            0
+        )};
+        if (mapping == MAP_FAILED) {
+            close();
+            return false;
+        }
+        m_data = static_cast<const std::byte*>(mapping);
+        m_size = file_status.st_size;
+        apply_access_pattern();
+    }
+    return true;
+} // function -----------------------------------------------------------------
+
+void
+mapped_file::close ()
+noexcept
+{
+    if (m_data != nullptr) {
+        ::munmap(
+            const_cast<std::byte*>(m_data),
+            static_cast<std::size_t>(m_size)
+        );
+    }
+    if (is_open()) {
+        ::close(m_file_descriptor);
+    }
+    m_file_descriptor = -1;
+    m_data = nullptr;
+    m_size = 0;
+    m_position = 0;
+} // function -----------------------------------------------------------------
+
+// Protected Functions --------------------------------------------------------
+
+void
+mapped_file::apply_access_pattern ()
+noexcept
+{
+    if (m_data == nullptr) {
+        return;
+    }
+    int advice{MADV_NORMAL};
+    switch (m_access_pattern) {
+        case access_pattern::normal:
+            advice = MADV_NORMAL;
+            break;
+        case access_pattern::sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case access_pattern::random:
+            advice = MADV_RANDOM;
+            break;
+    }
+    ::madvise(
+        const_cast<std::byte*>(m_data),
+        static_cast<std::size_t>(m_size),
+        advice
+    );
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -39,6 +39,15 @@ stdin_resource::read_raw (
     return ::read(STDIN_FILENO, data, byte_count);
 } // function -----------------------------------------------------------------
 
+// Protected Functions --------------------------------------------------------
+
+std::size_t
+stdin_resource::query_preferred_buffer_capacity ()
+const noexcept
+{
+    return impl::query_preferred_transfer_size(STDIN_FILENO);
+} // function -----------------------------------------------------------------
+
 // --------------------------------------------------------- cmp::stdin_stream
 
 // Constructors and Destructor ------------------------------------------------
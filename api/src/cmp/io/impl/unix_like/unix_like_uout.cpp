@@ -43,6 +43,27 @@ stdout_resource::write_raw (
     return bytes_written;
 } // function -----------------------------------------------------------------
 
+std::size_t
+stdout_resource::write_gather_raw (
+    std::span<const std::byte> pending,
+    std::span<const std::span<const std::byte>> pieces
+) {
+    return impl::write_gather_to_descriptor(
+        m_file_descriptor,
+        pending,
+        pieces
+    );
+} // function -----------------------------------------------------------------
+
+// Protected Functions --------------------------------------------------------
+
+std::size_t
+stdout_resource::query_preferred_buffer_capacity ()
+const noexcept
+{
+    return impl::query_preferred_transfer_size(m_file_descriptor);
+} // function -----------------------------------------------------------------
+
 #if CMP_CONFIG_HEADER_ONLY == false
 
 stdout_resource uout_resource{
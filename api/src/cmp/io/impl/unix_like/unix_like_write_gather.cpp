@@ -0,0 +1,81 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cmp/io/impl/unix_like/unix_like_write_gather.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+// Free Functions -------------------------------------------------------------
+
+std::size_t
+write_gather_to_descriptor (
+    int file_descriptor,
+    std::span<const std::byte> pending,
+    std::span<const std::span<const std::byte>> pieces
+)
+noexcept
+{
+    /*
+        The spans are written in batches that fit in a small array
+        of I/O vectors on the stack, so that no allocation is needed
+        and we stay well below the IOV_MAX limit.
+    */
+    constexpr int batch_capacity{64};
+    iovec vectors[batch_capacity];
+
+    const std::size_t span_count{pieces.size() + 1};
+    std::size_t next_span{0};
+    std::size_t total_bytes_written{0};
+    while (next_span < span_count) {
+        int vector_count{0};
+        while (next_span < span_count && vector_count < batch_capacity) {
+            std::span<const std::byte> span{
+                next_span == 0 ? pending : pieces[next_span - 1]
+            };
+            ++next_span;
+            if (span.empty()) {
+                continue;
+            }
+            vectors[vector_count].iov_base = const_cast<std::byte*>(
+                span.data()
+            );
+            vectors[vector_count].iov_len = span.size();
+            ++vector_count;
+        }
+
+        /*
+            The operating system may write fewer bytes than we asked for,
+            in which case we skip the vectors that were written entirely,
+            trim the one that was written partially and try again.
+        */
+        iovec* first_vector{vectors};
+        while (vector_count > 0) {
+            ssize_t bytes_written{
+                ::writev(file_descriptor, first_vector, vector_count)
+            };
+            if (bytes_written <= 0) {
+                return total_bytes_written;
+            }
+            total_bytes_written += static_cast<std::size_t>(bytes_written);
+            auto bytes_left{static_cast<std::size_t>(bytes_written)};
+            while (vector_count > 0 && bytes_left >= first_vector->iov_len) {
+                bytes_left -= first_vector->iov_len;
+                ++first_vector;
+                --vector_count;
+            }
+            if (vector_count > 0) {
+                first_vector->iov_base
+                    = static_cast<std::byte*>(first_vector->iov_base)
+                          + bytes_left;
+                first_vector->iov_len -= bytes_left;
+            }
+        }
+    }
+    return total_bytes_written;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
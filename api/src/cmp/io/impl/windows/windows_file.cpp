@@ -1,6 +1,10 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
 #include <cmp/io/impl/windows/windows_file.hpp>
 
 namespace cmp {
@@ -44,22 +48,6 @@ const noexcept
     return m_handle != INVALID_HANDLE_VALUE;
 } // function -----------------------------------------------------------------
 
-std::int64_t
-file::get_position ()
-const noexcept
-{
-    LARGE_INTEGER distance_to_move;
-    distance_to_move.QuadPart = 0;
-    LARGE_INTEGER position_structure;
-    SetFilePointerEx(
-        m_handle,
-        distance_to_move,
-        &position_structure,
-        FILE_CURRENT
-    );
-    return position_structure.QuadPart + m_buffer.get_position();
-} // function -----------------------------------------------------------------
-
 // Core -----------------------------------------------------------------------
 
 bool
@@ -107,6 +95,9 @@ noexcept
         nullptr
     );
     m_access_mode = mode;
+    m_buffer.set_read_dirty(true);
+    m_native_position = 0;
+    m_file_size = is_open() ? query_size() : 0;
     return is_open();
 } // function -----------------------------------------------------------------
 
@@ -115,12 +106,76 @@ file::close ()
 noexcept
 {
     this->flush();
+    m_read_ahead.discard();
     CloseHandle(m_handle);
     m_handle = INVALID_HANDLE_VALUE;
 } // function -----------------------------------------------------------------
 
 // Protected Functions --------------------------------------------------------
 
+std::int64_t
+file::query_size ()
+const noexcept
+{
+    LARGE_INTEGER size_structure;
+    if (!GetFileSizeEx(m_handle, &size_structure)) {
+        return m_file_size;
+    }
+    return size_structure.QuadPart;
+} // function -----------------------------------------------------------------
+
+std::size_t
+file::read_at_raw (
+    std::int64_t offset,
+    std::span<std::byte> data
+)
+const noexcept
+{
+    const std::size_t dword_max{(std::numeric_limits<DWORD>::max)()};
+    std::size_t bytes_read_total{0};
+    while (bytes_read_total < data.size()) {
+        DWORD native_byte_count{static_cast<DWORD>(
+            (std::min)(data.size() - bytes_read_total, dword_max)
+        )};
+        DWORD native_bytes_read{read_block(
+            offset + static_cast<std::int64_t>(bytes_read_total),
+            data.data() + bytes_read_total,
+            native_byte_count
+        )};
+        bytes_read_total += native_bytes_read;
+        if (native_bytes_read != native_byte_count) {
+            break;
+        }
+    }
+    return bytes_read_total;
+} // function -----------------------------------------------------------------
+
+std::size_t
+file::write_at_raw (
+    std::int64_t offset,
+    std::span<const std::byte> data
+)
+const noexcept
+{
+    const std::size_t dword_max{(std::numeric_limits<DWORD>::max)()};
+    std::size_t bytes_written_total{0};
+    while (bytes_written_total < data.size()) {
+        DWORD native_byte_count{static_cast<DWORD>(
+            (std::min)(data.size() - bytes_written_total, dword_max)
+        )};
+        DWORD native_bytes_written{write_block(
+            offset + static_cast<std::int64_t>(bytes_written_total),
+            data.data() + bytes_written_total,
+            native_byte_count
+        )};
+        bytes_written_total += native_bytes_written;
+        if (native_bytes_written != native_byte_count) {
+            break;
+        }
+    }
+    return bytes_written_total;
+} // function -----------------------------------------------------------------
+
 void
 file::set_position_raw (
     std::int64_t new_position,
@@ -128,9 +183,6 @@ file::set_position_raw (
 )
 noexcept
 {
-    LARGE_INTEGER distance_to_move;
-    distance_to_move.QuadPart = new_position;
-
     int windows_position_reference;
     switch (pr) {
         case position_reference::begin:
@@ -140,21 +192,43 @@ noexcept
             }
             break;
         case position_reference::current:
-            windows_position_reference = FILE_CURRENT;
+            /*
+                The native position is generally not the logical
+                position, since it sits at the end of the bytes that
+                the buffer mirrors, so we seek relative to the latter.
+            */
+            windows_position_reference = FILE_BEGIN;
+            new_position += get_position();
+            if (new_position < 0) {
+                new_position = 0;
+            }
             break;
         case position_reference::end:
             windows_position_reference = FILE_END;
             break;
     }
 
-    SetFilePointerEx(
-        m_handle,
-        distance_to_move,
-        nullptr,
-        windows_position_reference
-    );
+    LARGE_INTEGER distance_to_move;
+    distance_to_move.QuadPart = new_position;
 
-    m_last_fill_amount = 0;
+    LARGE_INTEGER position_structure;
+    if (
+        SetFilePointerEx(
+            m_handle,
+            distance_to_move,
+            &position_structure,
+            windows_position_reference
+        )
+    ) {
+        /*
+            Seeking relative to the end tells us the size of the
+            file for free, so we refresh the cached size with it.
+        */
+        if (pr == position_reference::end) {
+            m_file_size = position_structure.QuadPart - new_position;
+        }
+        m_native_position = position_structure.QuadPart;
+    }
 } // function -----------------------------------------------------------------
 
 std::size_t
@@ -165,15 +239,18 @@ file::read_raw (
 )
 noexcept
 {
-    if (rr == read_request::fill_buffer && m_last_fill_amount > 0) {
-        go_forward(m_last_fill_amount);
-    }
-
+    /*
+        The native position always sits at the end of the bytes that the
+        buffer mirrors. A fill appends to those bytes, and a lean retrieval
+        only happens once they've all been read and leaves the buffer
+        read-dirty, so in both cases we read from wherever the native
+        position is, without seeking.
+    */
     std::size_t total_result;
     DWORD native_bytes_read{0};
     const DWORD dword_max{(std::numeric_limits<DWORD>::max)()};
     if constexpr ((std::numeric_limits<std::size_t>::max)() <= dword_max) {
-        total_result = read_block(data, byte_count);
+        total_result = read_block(m_native_position, data, byte_count);
     } else {
         std::size_t bytes_read{0};
         DWORD native_byte_count;
@@ -185,7 +262,11 @@ noexcept
                 native_byte_count = dword_max;
                 byte_count -= dword_max;
             }
-            native_bytes_read = read_block(data, native_byte_count);
+            native_bytes_read = read_block(
+                m_native_position + bytes_read,
+                data + bytes_read,
+                native_byte_count
+            );
             bytes_read += native_bytes_read;
             if (native_bytes_read != native_byte_count) {
                 break;
@@ -193,15 +274,7 @@ noexcept
         }
         total_result = bytes_read;
     }
-
-    /*
-        If the read request is meant to fill the buffer
-        then we go back by the number of bytes read.
-    */
-    if (rr == read_request::fill_buffer) {
-        go_back(static_cast<position_type>(total_result));
-        m_last_fill_amount = total_result;
-    }
+    advance_native_position(total_result);
 
     return total_result;
 } // function -----------------------------------------------------------------
@@ -217,7 +290,7 @@ noexcept
     DWORD native_bytes_written{0};
     const DWORD dword_max{(std::numeric_limits<DWORD>::max)()};
     if constexpr ((std::numeric_limits<std::size_t>::max)() <= dword_max) {
-        total_result = write_block(data, byte_count);
+        total_result = write_block(m_native_position, data, byte_count);
     } else {
         std::size_t bytes_written{0};
         DWORD native_byte_count;
@@ -229,7 +302,11 @@ noexcept
                 native_byte_count = dword_max;
                 byte_count -= dword_max;
             }
-            native_bytes_written = write_block(data, native_byte_count);
+            native_bytes_written = write_block(
+                m_native_position + bytes_written,
+                data + bytes_written,
+                native_byte_count
+            );
             bytes_written += native_bytes_written;
             if (native_bytes_written != native_byte_count) {
                 break;
@@ -237,6 +314,7 @@ noexcept
         }
         total_result = bytes_written;
     }
+    advance_native_position(total_result);
     return total_result;
 } // function -----------------------------------------------------------------
 
@@ -244,21 +322,35 @@ noexcept
 
 DWORD
 file::read_block (
+    std::int64_t offset,
     std::byte* data,
     DWORD byte_count
 )
-noexcept
+const noexcept
 {
+    /*
+        Every read names its offset explicitly, so the file pointer of
+        the handle is never relied on. This is what allows read_at_raw
+        and write_at_raw to leave the native position alone, since a
+        read or write with an offset on a synchronous handle moves the
+        file pointer.
+    */
     DWORD bytes_read_last;
     DWORD bytes_read_total{0};
     HRESULT result;
     while (true) {
+        std::uint64_t block_offset{
+            static_cast<std::uint64_t>(offset) + bytes_read_total
+        };
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(block_offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(block_offset >> 32);
         result = ReadFile(
             m_handle,
             static_cast<LPVOID>(data + bytes_read_total),
             byte_count - bytes_read_total,
             &bytes_read_last,
-            nullptr
+            &overlapped
         );
         bytes_read_total += bytes_read_last;
         if (result == TRUE) {
@@ -275,19 +367,29 @@ noexcept
 
 DWORD
 file::write_block (
+    std::int64_t offset,
     const std::byte* data,
     DWORD byte_count
 )
-noexcept
+const noexcept
 {
-    DWORD bytes_written;
-    WriteFile(
-        m_handle,
-        static_cast<LPCVOID>(data),
-        byte_count,
-        &bytes_written,
-        nullptr
+    OVERLAPPED overlapped{};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(
+        static_cast<std::uint64_t>(offset) >> 32
     );
+    DWORD bytes_written;
+    if (
+        !WriteFile(
+            m_handle,
+            static_cast<LPCVOID>(data),
+            byte_count,
+            &bytes_written,
+            &overlapped
+        )
+    ) {
+        return 0;
+    }
     return bytes_written;
 } // function -----------------------------------------------------------------
 
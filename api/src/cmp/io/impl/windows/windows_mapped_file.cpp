@@ -0,0 +1,188 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <utility>
+
+#include <cmp/io/impl/windows/windows_mapped_file.hpp>
+
+namespace cmp {
+
+// ---------------------------------------------------------- cmp::mapped_file
+
+// Constructors and Destructor ------------------------------------------------
+
+mapped_file::mapped_file ()
+noexcept
+    : transfer_resource{0}
+    , basic_mapped_file{}
+    , m_file_handle{INVALID_HANDLE_VALUE}
+    , m_mapping_handle{nullptr}
+{
+} // function -----------------------------------------------------------------
+
+mapped_file::mapped_file (
+    const std::filesystem::path& file_path,
+    access_pattern pattern
+)
+    : transfer_resource{0}
+    , basic_mapped_file{pattern}
+    , m_file_handle{INVALID_HANDLE_VALUE}
+    , m_mapping_handle{nullptr}
+{
+    open(file_path);
+} // function -----------------------------------------------------------------
+
+mapped_file::~mapped_file ()
+{
+    close();
+} // function -----------------------------------------------------------------
+
+// Move Operations ------------------------------------------------------------
+
+mapped_file::mapped_file (
+    mapped_file&& other
+)
+noexcept
+    : transfer_resource{std::move(other)}
+    , basic_mapped_file{std::move(other)}
+    , m_file_handle{std::exchange(other.m_file_handle, INVALID_HANDLE_VALUE)}
+    , m_mapping_handle{std::exchange(other.m_mapping_handle, nullptr)}
+{
+} // function -----------------------------------------------------------------
+
+mapped_file&
+mapped_file::operator = (
+    mapped_file&& other
+)
+noexcept
+{
+    if (this != &other) {
+        close();
+        basic_mapped_file::operator = (std::move(other));
+        m_file_handle = std::exchange(
+            other.m_file_handle,
+            INVALID_HANDLE_VALUE
+        );
+        m_mapping_handle = std::exchange(other.m_mapping_handle, nullptr);
+    }
+    return *this;
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+bool
+mapped_file::is_open ()
+const noexcept
+{
+    return m_file_handle != INVALID_HANDLE_VALUE;
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+bool
+mapped_file::open (
+    const std::filesystem::path& file_path
+)
+noexcept
+{
+    if (is_open()) {
+        close();
+    }
+
+    /*
+        Windows has no way of advising the system of how the pages of a
+        view will be accessed, so the access pattern is given as a hint
+        when the file is opened instead.
+    */
+    DWORD flags_and_attributes{FILE_ATTRIBUTE_NORMAL};
+    switch (m_access_pattern) {
+        case access_pattern::normal:
+            break;
+        case access_pattern::sequential:
+            flags_and_attributes |= FILE_FLAG_SEQUENTIAL_SCAN;
+            break;
+        case access_pattern::random:
+            flags_and_attributes |= FILE_FLAG_RANDOM_ACCESS;
+            break;
+    }
+    std::wstring file_path_wstring{file_path.wstring()};
+    m_file_handle = CreateFileW(
+        file_path_wstring.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        flags_and_attributes,
+        nullptr
+    );
+    if (!is_open()) {
+        return false;
+    }
+
+    LARGE_INTEGER size_structure;
+    if (!GetFileSizeEx(m_file_handle, &size_structure)) {
+        close();
+        return false;
+    }
+
+    /*
+        Mapping zero bytes fails, so an empty file stays open
+        without a mapping and simply reads as being at its end.
+    */
+    if (size_structure.QuadPart > 0) {
+        m_mapping_handle = CreateFileMappingW(
+            m_file_handle,
+            nullptr,
+            PAGE_READONLY,
+            0,
+            0,
+            nullptr
+        );
+        if (m_mapping_handle == nullptr) {
+            close();
+            return false;
+        }
+        void* view{MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0)};
+        if (view == nullptr) {
+            close();
+            return false;
+        }
+        m_data = static_cast<const std::byte*>(view);
+        m_size = size_structure.QuadPart;
+    }
+    return true;
+} // function -----------------------------------------------------------------
+
+void
+mapped_file::close ()
+noexcept
+{
+    if (m_data != nullptr) {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping_handle != nullptr) {
+        CloseHandle(m_mapping_handle);
+    }
+    if (is_open()) {
+        CloseHandle(m_file_handle);
+    }
+    m_file_handle = INVALID_HANDLE_VALUE;
+    m_mapping_handle = nullptr;
+    m_data = nullptr;
+    m_size = 0;
+    m_position = 0;
+} // function -----------------------------------------------------------------
+
+// Protected Functions --------------------------------------------------------
+
+void
+mapped_file::apply_access_pattern ()
+noexcept
+{
+    /*
+        The access pattern is only taken into account when the file is
+        opened, so a new one takes effect the next time a file is opened.
+    */
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
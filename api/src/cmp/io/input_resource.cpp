@@ -1,6 +1,10 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
 #include <cmp/io/input_resource.hpp>
 
 namespace cmp {
@@ -13,8 +17,28 @@ input_resource::input_resource (
     std::size_t buffer_capacity
 )
     : transfer_resource{buffer_capacity}
+    , m_read_ahead{}
     , m_tied_resource{nullptr}
+    , m_tie_flush{tie_flush::on_refill}
+{
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+tie_flush
+input_resource::get_tie_flush ()
+const noexcept
+{
+    return m_tie_flush;
+} // function -----------------------------------------------------------------
+
+void
+input_resource::set_tie_flush (
+    tie_flush new_tie_flush
+)
+noexcept
 {
+    m_tie_flush = new_tie_flush;
 } // function -----------------------------------------------------------------
 
 // Core -----------------------------------------------------------------------
@@ -24,16 +48,77 @@ input_resource::read (
     std::byte* data,
     std::size_t byte_count
 ) {
-    if (m_tied_resource) {
-        m_tied_resource->flush();
-    }
+    /*
+        Reads that the buffer serves don't go to the resource, so the
+        tied resource is only flushed for them if it's always flushed.
+        Every other read flushes it right before going to the resource.
+    */
     if (m_buffer.get_capacity() > 0) {
+        if (m_tie_flush == tie_flush::always) {
+            flush_tied_resource();
+        }
         return read_buffered(data, byte_count);
     } else {
+        flush_tied_resource();
         return read_raw(data, byte_count, read_request::lean_retrieval);
     }
 } // function -----------------------------------------------------------------
 
+std::span<const std::byte>
+input_resource::peek_view (
+    std::size_t min_bytes
+) {
+    if (m_tie_flush == tie_flush::always) {
+        flush_tied_resource();
+    }
+
+    /*
+        We only go to the resource when the buffer doesn't already hold
+        the bytes we were asked for, and filling the buffer flushes the
+        tied resource when it has to be.
+    */
+    if (
+        m_buffer.is_read_dirty()
+            || m_buffer.get_size() - m_buffer.get_position() < min_bytes
+    ) {
+        if (m_buffer.get_capacity() < min_bytes) {
+            m_buffer.set_capacity(min_bytes);
+        }
+
+        /*
+            A single fill may come back short of what we asked for
+            without the resource being at its end, as is the case with
+            pipes and terminals, so we keep filling until we either
+            have enough bytes or the resource has nothing more to give.
+        */
+        std::size_t bytes_filled;
+        do {
+            bytes_filled = fill();
+        } while (
+            bytes_filled > 0
+                && m_buffer.get_size() - m_buffer.get_position() < min_bytes
+        );
+    }
+
+    return {
+        m_buffer.get_data_ptr() + m_buffer.get_position(),
+        m_buffer.get_size() - m_buffer.get_position()
+    };
+} // function -----------------------------------------------------------------
+
+void
+input_resource::consume (
+    std::size_t byte_count
+) {
+    std::size_t available_byte_count{
+        m_buffer.get_size() - m_buffer.get_position()
+    };
+    if (byte_count > available_byte_count) {
+        byte_count = available_byte_count;
+    }
+    m_buffer.set_position(m_buffer.get_position() + byte_count);
+} // function -----------------------------------------------------------------
+
 void
 input_resource::tie (
     output_resource& resource
@@ -48,18 +133,44 @@ noexcept
 std::size_t
 input_resource::fill ()
 {
+    flush_tied_resource();
+
+    /*
+        If the buffer is read-dirty then nothing in it is worth keeping.
+        Otherwise, we keep the bytes that haven't been read yet by moving
+        them to the beginning of the buffer.
+    */
+    std::size_t kept_byte_count;
+    if (m_buffer.is_read_dirty()) {
+        m_buffer.set_read_dirty(false);
+        m_buffer.set_size(0);
+        kept_byte_count = 0;
+    } else {
+        kept_byte_count = m_buffer.compact();
+    }
+    if (m_read_ahead.is_enabled()) {
+        return fill_from_read_ahead(kept_byte_count);
+    }
+
     std::size_t bytes_read{
         read_raw(
-            m_buffer.get_data_ptr(),
-            m_buffer.get_capacity(),
+            m_buffer.get_data_ptr() + kept_byte_count,
+            m_buffer.get_capacity() - kept_byte_count,
             read_request::fill_buffer
         )
     };
-    m_buffer.set_read_dirty(false);
-    m_buffer.set_size(bytes_read);
+    m_buffer.set_size(kept_byte_count + bytes_read);
     return bytes_read;
 } // function -----------------------------------------------------------------
 
+void
+input_resource::flush_tied_resource ()
+{
+    if (m_tied_resource && m_tie_flush != tie_flush::never) {
+        m_tied_resource->flush();
+    }
+} // function -----------------------------------------------------------------
+
 // Private Functions ----------------------------------------------------------
 
 std::size_t
@@ -67,8 +178,16 @@ input_resource::read_buffered (
     std::byte* data,
     std::size_t byte_count
 ) {
+    /*
+        A miss is recorded for every trip to the resource, and a hit for
+        every request that the buffer serves without one. The buffer is
+        only resized while it holds no bytes left to read.
+    */
+    bool went_to_resource{false};
     if (m_buffer.is_read_dirty()) {
-        fill();
+        adapt_buffer_capacity();
+        record_buffer_miss(fill());
+        went_to_resource = true;
     }
 
     /*
@@ -113,6 +232,29 @@ input_resource::read_buffered (
             byte_count -= bytes_read;
         }
 
+        /*
+            When reading ahead, going around the buffer would skip the
+            bytes that were read ahead, so we keep refilling the buffer
+            and reading from it until we have all the bytes we want or
+            the resource has nothing more to give.
+        */
+        if (m_read_ahead.is_enabled()) {
+            while (byte_count > 0) {
+                adapt_buffer_capacity();
+                std::size_t bytes_filled{fill()};
+                record_buffer_miss(bytes_filled);
+                if (bytes_filled == 0) {
+                    break;
+                }
+                std::size_t last_bytes_read{
+                    m_buffer.read(data + bytes_read, byte_count)
+                };
+                bytes_read += last_bytes_read;
+                byte_count -= last_bytes_read;
+            }
+            return bytes_read;
+        }
+
         /*
             If the number of bytes left to read is greater
             than what would fit in the buffer then we don't
@@ -120,18 +262,28 @@ input_resource::read_buffered (
             all the remaining data directly.
         */
         if (byte_count > m_buffer.get_capacity()) {
+            record_buffer_miss(0);
+            flush_tied_resource();
             bytes_read += read_raw(
                 data + bytes_read,
                 byte_count,
                 read_request::lean_retrieval
             );
+
+            /*
+                The bytes in the buffer no longer sit right before the
+                resource's position, so they can't be seeked back into.
+            */
+            m_buffer.set_read_dirty(true);
             return bytes_read;
         } else {
             /*
                 We now try to fill up the buffer
                 by reading data from the resource.
             */
+            adapt_buffer_capacity();
             std::size_t bytes_filled{fill()};
+            record_buffer_miss(bytes_filled);
 
             std::size_t last_byte_count;
             if (bytes_filled < byte_count) {
@@ -161,8 +313,67 @@ input_resource::read_buffered (
             The buffer had all the data we wanted to
             begin with, so we just read from the buffer.
         */
+        if (!went_to_resource) {
+            record_buffer_hit();
+        }
         return m_buffer.read(data, byte_count);
     }
 } // function -----------------------------------------------------------------
 
+std::size_t
+input_resource::fill_from_read_ahead (
+    std::size_t kept_byte_count
+) {
+    m_read_ahead.wait();
+    const std::size_t capacity{m_buffer.get_capacity()};
+    std::size_t pending_byte_count{m_read_ahead.get_pending_count()};
+    io_buffer& spare{m_read_ahead.get_buffer()};
+    std::size_t bytes_read;
+    if (pending_byte_count == 0) {
+        /*
+            Nothing was read ahead, either because this is the first fill
+            or because the last one reached the end, so we read directly.
+        */
+        bytes_read = read_raw(
+            m_buffer.get_data_ptr() + kept_byte_count,
+            capacity - kept_byte_count,
+            read_request::fill_buffer
+        );
+        m_buffer.set_size(kept_byte_count + bytes_read);
+    } else if (
+        kept_byte_count == 0 && spare.get_capacity() >= capacity
+    ) {
+        /*
+            The buffer has nothing worth keeping, so it simply trades
+            places with the spare buffer and the bytes aren't copied. An
+            earlier peek may have copied some of the spare buffer's bytes
+            already, so its position is carried over.
+        */
+        std::swap(m_buffer, spare);
+        const std::size_t consumed_byte_count{m_buffer.get_position()};
+        m_buffer.set_read_dirty(false);
+        m_buffer.set_position(consumed_byte_count);
+        bytes_read = pending_byte_count;
+    } else {
+        bytes_read = std::min(pending_byte_count, capacity - kept_byte_count);
+        std::memcpy(
+            m_buffer.get_data_ptr() + kept_byte_count,
+            spare.get_data_ptr() + spare.get_position(),
+            bytes_read
+        );
+        spare.set_position(spare.get_position() + bytes_read);
+        m_buffer.set_size(kept_byte_count + bytes_read);
+    }
+
+    if (bytes_read > 0 && m_read_ahead.get_pending_count() == 0) {
+        m_read_ahead.start(
+            capacity,
+            [this] (std::byte* data, std::size_t byte_count) {
+                return read_raw(data, byte_count, read_request::fill_buffer);
+            }
+        );
+    }
+    return bytes_read;
+} // function -----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
@@ -30,6 +30,24 @@ const noexcept
     return m_data.capacity();
 } // function -----------------------------------------------------------------
 
+void
+io_buffer::set_capacity (
+    std::size_t new_capacity
+) {
+    /*
+        We build a new vector rather than resizing the existing one
+        because resizing is allowed to leave a larger capacity than
+        the one we asked for, and the capacity of the vector is the
+        capacity of the buffer.
+    */
+    std::vector<std::byte> new_data(new_capacity);
+    std::size_t kept_byte_count{std::min(m_size, new_capacity)};
+    std::memcpy(new_data.data(), m_data.data(), kept_byte_count);
+    m_data = std::move(new_data);
+    m_size = kept_byte_count;
+    m_position = std::min(m_position, kept_byte_count);
+} // function -----------------------------------------------------------------
+
 std::size_t
 io_buffer::get_size ()
 const noexcept
@@ -133,4 +151,21 @@ io_buffer::write (
     return byte_count;
 } // function -----------------------------------------------------------------
 
+std::size_t
+io_buffer::compact ()
+noexcept
+{
+    std::size_t kept_byte_count{m_size - m_position};
+    if (m_position > 0 && kept_byte_count > 0) {
+        std::memmove(
+            m_data.data(),
+            m_data.data() + m_position,
+            kept_byte_count
+        );
+    }
+    m_size = kept_byte_count;
+    m_position = 0;
+    return kept_byte_count;
+} // function -----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
@@ -0,0 +1,516 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cmp/io/io_ring.hpp>
+
+#if defined(CMP_OS_LINUX_BASED)
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <limits>
+#include <system_error>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace cmp {
+
+// ---------------------------------------------------- cmp::io_ring::awaitable
+
+// Constructors and Destructor ------------------------------------------------
+
+io_ring::awaitable::awaitable (
+    io_ring& ring,
+    const impl::submission_fields& fields,
+    std::size_t slot
+)
+noexcept
+    : m_ring{&ring}
+    , m_fields{fields}
+    , m_slot{slot}
+    , m_handle{}
+    , m_result{0}
+{
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+bool
+io_ring::awaitable::await_ready ()
+const noexcept
+{
+    return false;
+} // function -----------------------------------------------------------------
+
+void
+io_ring::awaitable::await_suspend (
+    std::coroutine_handle<> handle
+) {
+    m_handle = handle;
+    m_ring->queue(m_fields, m_slot, {}, this);
+} // function -----------------------------------------------------------------
+
+std::size_t
+io_ring::awaitable::await_resume ()
+const
+{
+    if (m_result < 0) {
+        throw std::system_error{
+            static_cast<int>(-m_result),
+            std::generic_category()
+        };
+    }
+    return static_cast<std::size_t>(m_result);
+} // function -----------------------------------------------------------------
+
+// -------------------------------------------------------------- cmp::io_ring
+
+// Constructors and Destructor ------------------------------------------------
+
+io_ring::io_ring (
+    unsigned queue_depth,
+    std::size_t slot_count,
+    std::size_t slot_capacity
+)
+    : m_ring_descriptor{-1}
+    , m_entry_count{0}
+    , m_submission_ring{MAP_FAILED}
+    , m_submission_ring_size{0}
+    , m_submission_head{nullptr}
+    , m_submission_tail{nullptr}
+    , m_submission_mask{0}
+    , m_submission_array{nullptr}
+    , m_submission_entries{static_cast<io_uring_sqe*>(MAP_FAILED)}
+    , m_unsubmitted_count{0}
+    , m_completion_ring{MAP_FAILED}
+    , m_completion_ring_size{0}
+    , m_completion_head{nullptr}
+    , m_completion_tail{nullptr}
+    , m_completion_mask{0}
+    , m_completion_entries{nullptr}
+    , m_requests{}
+    , m_free_requests{}
+    , m_slots{}
+    , m_slots_registered{false}
+{
+    io_uring_params parameters{};
+    m_ring_descriptor = static_cast<int>(
+        ::syscall(__NR_io_uring_setup, queue_depth, &parameters)
+    );
+    if (m_ring_descriptor < 0) {
+        throw std::system_error{errno, std::generic_category()};
+    }
+    m_entry_count = parameters.sq_entries;
+
+    /*
+        The operating system shares three regions with us: the submission
+        ring, which holds indices into the array of submission entries,
+        the array of submission entries itself, and the completion ring.
+        Newer kernels let the two rings share a single mapping.
+    */
+    m_submission_ring_size = parameters.sq_off.array
+        + parameters.sq_entries * sizeof (unsigned);
+    m_completion_ring_size = parameters.cq_off.cqes
+        + parameters.cq_entries * sizeof (io_uring_cqe);
+    const bool single_mapping{
+        (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0
+    };
+    if (single_mapping) {
+        m_submission_ring_size = m_completion_ring_size = std::max(
+            m_submission_ring_size,
+            m_completion_ring_size
+        );
+    }
+
+    m_submission_ring = ::mmap(
+        nullptr,
+        m_submission_ring_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        m_ring_descriptor,
+        IORING_OFF_SQ_RING
+    );
+    if (single_mapping) {
+        m_completion_ring = m_submission_ring;
+    } else if (m_submission_ring != MAP_FAILED) {
+        m_completion_ring = ::mmap(
+            nullptr,
+            m_completion_ring_size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            m_ring_descriptor,
+            IORING_OFF_CQ_RING
+        );
+    }
+    if (m_completion_ring != MAP_FAILED) {
+        m_submission_entries = static_cast<io_uring_sqe*>(::mmap(
+            nullptr,
+            parameters.sq_entries * sizeof (io_uring_sqe),
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            m_ring_descriptor,
+            IORING_OFF_SQES
+        ));
+    }
+    if (m_submission_entries == MAP_FAILED) {
+        int error{errno};
+        tear_down();
+        throw std::system_error{error, std::generic_category()};
+    }
+
+    auto* submission_bytes{static_cast<std::byte*>(m_submission_ring)};
+    m_submission_head = reinterpret_cast<unsigned*>(
+        submission_bytes + parameters.sq_off.head
+    );
+    m_submission_tail = reinterpret_cast<unsigned*>(
+        submission_bytes + parameters.sq_off.tail
+    );
+    m_submission_mask = *reinterpret_cast<unsigned*>(
+        submission_bytes + parameters.sq_off.ring_mask
+    );
+    m_submission_array = reinterpret_cast<unsigned*>(
+        submission_bytes + parameters.sq_off.array
+    );
+
+    auto* completion_bytes{static_cast<std::byte*>(m_completion_ring)};
+    m_completion_head = reinterpret_cast<unsigned*>(
+        completion_bytes + parameters.cq_off.head
+    );
+    m_completion_tail = reinterpret_cast<unsigned*>(
+        completion_bytes + parameters.cq_off.tail
+    );
+    m_completion_mask = *reinterpret_cast<unsigned*>(
+        completion_bytes + parameters.cq_off.ring_mask
+    );
+    m_completion_entries = reinterpret_cast<io_uring_cqe*>(
+        completion_bytes + parameters.cq_off.cqes
+    );
+
+    /*
+        There is one request record per submission entry, so as long as
+        we never have more requests in flight than there are records,
+        neither ring can overflow.
+    */
+    m_requests.resize(m_entry_count);
+    m_free_requests.reserve(m_entry_count);
+    for (std::uint32_t i{m_entry_count}; i > 0; --i) {
+        m_free_requests.push_back(i - 1);
+    }
+
+    m_slots.reserve(slot_count);
+    std::vector<iovec> vectors;
+    vectors.reserve(slot_count);
+    for (std::size_t i{0}; i < slot_count; ++i) {
+        m_slots.emplace_back(slot_capacity);
+        vectors.push_back({m_slots.back().get_data_ptr(), slot_capacity});
+    }
+    if (slot_count > 0) {
+        m_slots_registered = ::syscall(
+            __NR_io_uring_register,
+            m_ring_descriptor,
+            IORING_REGISTER_BUFFERS,
+            vectors.data(),
+            static_cast<unsigned>(vectors.size())
+        ) == 0;
+    }
+} // function -----------------------------------------------------------------
+
+io_ring::~io_ring ()
+{
+    /*
+        Requests in flight may still be using memory that's about to be
+        released, so we wait for them to complete, dropping their
+        completions without running their handlers, since the objects
+        that the handlers refer to may already be gone.
+    */
+    while (get_outstanding_count() > 0) {
+        int submitted{enter(m_unsubmitted_count, 1)};
+        if (submitted < 0) {
+            if (errno != EINTR) {
+                break;
+            }
+        } else {
+            m_unsubmitted_count -= static_cast<unsigned>(submitted);
+        }
+
+        unsigned head{*m_completion_head};
+        const unsigned tail{
+            std::atomic_ref{*m_completion_tail}.load(
+                std::memory_order_acquire
+            )
+        };
+        for (; head != tail; ++head) {
+            m_free_requests.push_back(static_cast<std::uint32_t>(
+                m_completion_entries[head & m_completion_mask].user_data
+            ));
+        }
+        std::atomic_ref{*m_completion_head}.store(
+            head,
+            std::memory_order_release
+        );
+    }
+    tear_down();
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+std::size_t
+io_ring::get_outstanding_count ()
+const noexcept
+{
+    return m_requests.size() - m_free_requests.size();
+} // function -----------------------------------------------------------------
+
+std::size_t
+io_ring::get_slot_count ()
+const noexcept
+{
+    return m_slots.size();
+} // function -----------------------------------------------------------------
+
+bool
+io_ring::are_slots_registered ()
+const noexcept
+{
+    return m_slots_registered;
+} // function -----------------------------------------------------------------
+
+std::span<const std::byte>
+io_ring::get_slot_view (
+    std::size_t slot
+)
+noexcept
+{
+    return {m_slots[slot].get_data_ptr(), m_slots[slot].get_size()};
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+std::size_t
+io_ring::submit ()
+{
+    if (m_unsubmitted_count == 0) {
+        return 0;
+    }
+    int submitted{enter(m_unsubmitted_count, 0)};
+    if (submitted < 0) {
+        if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+            return 0;
+        }
+        throw std::system_error{errno, std::generic_category()};
+    }
+    m_unsubmitted_count -= static_cast<unsigned>(submitted);
+    return static_cast<std::size_t>(submitted);
+} // function -----------------------------------------------------------------
+
+std::size_t
+io_ring::poll ()
+{
+    submit();
+    return process_completions();
+} // function -----------------------------------------------------------------
+
+std::size_t
+io_ring::wait (
+    std::size_t min_completions
+) {
+    min_completions = std::min(min_completions, get_outstanding_count());
+    if (min_completions > 0) {
+        int submitted{enter(
+            m_unsubmitted_count,
+            static_cast<unsigned>(min_completions)
+        )};
+        if (submitted < 0) {
+            if (errno != EINTR) {
+                throw std::system_error{errno, std::generic_category()};
+            }
+        } else {
+            m_unsubmitted_count -= static_cast<unsigned>(submitted);
+        }
+    }
+    return process_completions();
+} // function -----------------------------------------------------------------
+
+void
+io_ring::drain ()
+{
+    while (get_outstanding_count() > 0) {
+        wait();
+    }
+} // function -----------------------------------------------------------------
+
+// Private Functions ----------------------------------------------------------
+
+void
+io_ring::queue (
+    const impl::submission_fields& fields,
+    std::size_t slot,
+    completion_handler handler,
+    awaitable* awaiter
+) {
+    while (m_free_requests.empty()) {
+        wait();
+    }
+    std::uint32_t request_index{m_free_requests.back()};
+    m_free_requests.pop_back();
+    request& r{m_requests[request_index]};
+    r.handler = std::move(handler);
+    r.awaiter = awaiter;
+    r.slot = slot;
+
+    /*
+        We own the tail of the submission ring, so we can read it plainly,
+        but the entry has to be fully written before the operating system
+        can see the new tail.
+    */
+    const unsigned tail{*m_submission_tail};
+    const unsigned index{tail & m_submission_mask};
+    io_uring_sqe& entry{m_submission_entries[index]};
+    entry = io_uring_sqe{};
+    entry.opcode = fields.opcode;
+    entry.fd = fields.file_descriptor;
+    entry.off = fields.offset;
+    entry.addr = fields.address;
+    entry.len = fields.length;
+    entry.buf_index = fields.buffer_index;
+    entry.user_data = request_index;
+    m_submission_array[index] = index;
+    std::atomic_ref{*m_submission_tail}.store(
+        tail + 1,
+        std::memory_order_release
+    );
+    ++m_unsubmitted_count;
+} // function -----------------------------------------------------------------
+
+impl::submission_fields
+io_ring::make_slot_read_fields (
+    int file_descriptor,
+    std::int64_t offset,
+    std::size_t slot
+)
+noexcept
+{
+    impl::submission_fields fields{};
+    fields.opcode = m_slots_registered
+        ? IORING_OP_READ_FIXED
+        : IORING_OP_READ;
+    fields.file_descriptor = file_descriptor;
+    fields.offset = static_cast<std::uint64_t>(offset);
+    fields.address = reinterpret_cast<std::uint64_t>(
+        m_slots[slot].get_data_ptr()
+    );
+    fields.length = static_cast<std::uint32_t>(
+        m_slots[slot].get_capacity()
+    );
+    if (m_slots_registered) {
+        fields.buffer_index = static_cast<std::uint16_t>(slot);
+    }
+    return fields;
+} // function -----------------------------------------------------------------
+
+int
+io_ring::enter (
+    unsigned submit_count,
+    unsigned min_completions
+)
+noexcept
+{
+    return static_cast<int>(::syscall(
+        __NR_io_uring_enter,
+        m_ring_descriptor,
+        submit_count,
+        min_completions,
+        min_completions > 0 ? IORING_ENTER_GETEVENTS : 0u,
+        nullptr,
+        0
+    ));
+} // function -----------------------------------------------------------------
+
+std::size_t
+io_ring::process_completions ()
+{
+    std::size_t processed_count{0};
+    while (true) {
+        unsigned head{*m_completion_head};
+        const unsigned tail{
+            std::atomic_ref{*m_completion_tail}.load(
+                std::memory_order_acquire
+            )
+        };
+        if (head == tail) {
+            return processed_count;
+        }
+
+        /*
+            We copy what we need out of the completion entry and release
+            both the entry and the request record before running the
+            handler, since the handler may well queue new requests.
+        */
+        const io_uring_cqe& completion{
+            m_completion_entries[head & m_completion_mask]
+        };
+        const auto request_index{
+            static_cast<std::uint32_t>(completion.user_data)
+        };
+        const std::int64_t result{completion.res};
+        std::atomic_ref{*m_completion_head}.store(
+            head + 1,
+            std::memory_order_release
+        );
+
+        request& r{m_requests[request_index]};
+        completion_handler handler{std::move(r.handler)};
+        awaitable* awaiter{r.awaiter};
+        if (r.slot < m_slots.size()) {
+            m_slots[r.slot].set_size(
+                result > 0 ? static_cast<std::size_t>(result) : 0
+            );
+        }
+        r.handler = nullptr;
+        r.awaiter = nullptr;
+        m_free_requests.push_back(request_index);
+        ++processed_count;
+
+        if (awaiter != nullptr) {
+            awaiter->m_result = result;
+            awaiter->m_handle.resume();
+        } else if (handler) {
+            handler(result);
+        }
+    }
+} // function -----------------------------------------------------------------
+
+void
+io_ring::tear_down ()
+noexcept
+{
+    if (
+        m_submission_entries != MAP_FAILED
+            && m_submission_entries != nullptr
+    ) {
+        ::munmap(m_submission_entries, m_entry_count * sizeof (io_uring_sqe));
+    }
+    if (
+        m_completion_ring != MAP_FAILED
+            && m_completion_ring != m_submission_ring
+    ) {
+        ::munmap(m_completion_ring, m_completion_ring_size);
+    }
+    if (m_submission_ring != MAP_FAILED) {
+        ::munmap(m_submission_ring, m_submission_ring_size);
+    }
+    if (m_ring_descriptor >= 0) {
+        ::close(m_ring_descriptor);
+    }
+    m_submission_entries = nullptr;
+    m_completion_ring = MAP_FAILED;
+    m_submission_ring = MAP_FAILED;
+    m_ring_descriptor = -1;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#endif // CMP_OS_LINUX_BASED
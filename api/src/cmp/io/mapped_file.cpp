@@ -0,0 +1,191 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include <cmp/io/mapped_file.hpp>
+
+namespace cmp {
+
+// ---------------------------------------------------- cmp::basic_mapped_file
+
+// Constructors and Destructor ------------------------------------------------
+
+basic_mapped_file::basic_mapped_file (
+    access_pattern pattern
+)
+noexcept
+    : transfer_resource{0}
+    , seekable_input_resource{0}
+    , m_data{nullptr}
+    , m_size{0}
+    , m_position{0}
+    , m_access_pattern{pattern}
+{
+} // function -----------------------------------------------------------------
+
+// Move Operations ------------------------------------------------------------
+
+basic_mapped_file::basic_mapped_file (
+    basic_mapped_file&& other
+)
+noexcept
+    : transfer_resource{std::move(other)}
+    , seekable_input_resource{std::move(other)}
+    , m_data{std::exchange(other.m_data, nullptr)}
+    , m_size{std::exchange(other.m_size, 0)}
+    , m_position{std::exchange(other.m_position, 0)}
+    , m_access_pattern{other.m_access_pattern}
+{
+} // function -----------------------------------------------------------------
+
+basic_mapped_file&
+basic_mapped_file::operator = (
+    basic_mapped_file&& other
+)
+noexcept
+{
+    seekable_input_resource::operator = (std::move(other));
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+    m_position = std::exchange(other.m_position, 0);
+    m_access_pattern = other.m_access_pattern;
+    return *this;
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+bool
+basic_mapped_file::is_at_end ()
+const noexcept
+{
+    return m_position >= m_size;
+} // function -----------------------------------------------------------------
+
+std::int64_t
+basic_mapped_file::get_position ()
+const noexcept
+{
+    return m_position;
+} // function -----------------------------------------------------------------
+
+std::int64_t
+basic_mapped_file::get_size ()
+const noexcept
+{
+    return m_size;
+} // function -----------------------------------------------------------------
+
+std::span<const std::byte>
+basic_mapped_file::get_view ()
+const noexcept
+{
+    return {m_data, static_cast<std::size_t>(m_size)};
+} // function -----------------------------------------------------------------
+
+access_pattern
+basic_mapped_file::get_access_pattern ()
+const noexcept
+{
+    return m_access_pattern;
+} // function -----------------------------------------------------------------
+
+void
+basic_mapped_file::set_access_pattern (
+    access_pattern new_access_pattern
+)
+noexcept
+{
+    m_access_pattern = new_access_pattern;
+    if (is_open()) {
+        apply_access_pattern();
+    }
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+std::size_t
+basic_mapped_file::read (
+    std::byte* data,
+    std::size_t byte_count
+) {
+    flush_tied_resource();
+    return read_raw(data, byte_count, read_request::lean_retrieval);
+} // function -----------------------------------------------------------------
+
+std::span<const std::byte>
+basic_mapped_file::peek_view (
+    std::size_t
+) {
+    flush_tied_resource();
+    if (m_position >= m_size) {
+        return {};
+    }
+    return {
+        m_data + m_position,
+        static_cast<std::size_t>(m_size - m_position)
+    };
+} // function -----------------------------------------------------------------
+
+void
+basic_mapped_file::consume (
+    std::size_t byte_count
+) {
+    if (m_position >= m_size) {
+        return;
+    }
+    m_position += static_cast<std::int64_t>(std::min(
+        byte_count,
+        static_cast<std::size_t>(m_size - m_position)
+    ));
+} // function -----------------------------------------------------------------
+
+// Protected Functions --------------------------------------------------------
+
+void
+basic_mapped_file::set_position_raw (
+    std::int64_t new_position,
+    position_reference pr
+)
+noexcept
+{
+    switch (pr) {
+        case position_reference::begin:
+            break;
+        case position_reference::current:
+            new_position += m_position;
+            break;
+        case position_reference::end:
+            new_position += m_size;
+            break;
+    }
+
+    /*
+        Just like with a file, the position may go past the end, in
+        which case reads simply return no bytes, but not before the
+        beginning.
+    */
+    m_position = std::max<std::int64_t>(new_position, 0);
+} // function -----------------------------------------------------------------
+
+std::size_t
+basic_mapped_file::read_raw (
+    std::byte* data,
+    std::size_t byte_count,
+    read_request
+) {
+    if (m_position >= m_size) {
+        return 0;
+    }
+    byte_count = std::min(
+        byte_count,
+        static_cast<std::size_t>(m_size - m_position)
+    );
+    std::memcpy(data, m_data + m_position, byte_count);
+    m_position += static_cast<std::int64_t>(byte_count);
+    return byte_count;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -88,6 +88,41 @@ const noexcept
     return m_content;
 } // function -----------------------------------------------------------------
 
+// Core -----------------------------------------------------------------------
+
+template <
+    typename Container
+>
+std::size_t
+opaque_container_input_resource<Container>::read (
+    std::byte* data,
+    std::size_t byte_count
+) {
+    flush_tied_resource();
+    return essence_type::read(data, byte_count);
+} // function -----------------------------------------------------------------
+
+template <
+    typename Container
+>
+std::span<const std::byte>
+opaque_container_input_resource<Container>::peek_view (
+    std::size_t
+) {
+    flush_tied_resource();
+    return essence_type::peek_view();
+} // function -----------------------------------------------------------------
+
+template <
+    typename Container
+>
+void
+opaque_container_input_resource<Container>::consume (
+    std::size_t byte_count
+) {
+    essence_type::consume(byte_count);
+} // function -----------------------------------------------------------------
+
 // Protected Functions --------------------------------------------------------
 
 template <
@@ -119,7 +154,7 @@ opaque_container_input_resource<Container>::read_raw (
         data,
         byte_count,
         rr,
-        *this
+        m_buffer
     );
 } // function -----------------------------------------------------------------
 
@@ -30,6 +30,46 @@ output_resource::write (
     }
 } // function -----------------------------------------------------------------
 
+std::size_t
+output_resource::write_gather (
+    std::span<const std::span<const std::byte>> pieces
+) {
+    std::size_t byte_count{0};
+    for (const auto& piece : pieces) {
+        byte_count += piece.size();
+    }
+
+    /*
+        If everything fits in what's left of the buffer, we just copy
+        the pieces into it, just like write would.
+    */
+    if (
+        m_buffer.get_capacity() > 0
+            && m_buffer.get_position() + byte_count
+                   <= m_buffer.get_capacity()
+    ) {
+        for (const auto& piece : pieces) {
+            m_buffer.write(piece.data(), piece.size());
+        }
+        return byte_count;
+    }
+
+    /*
+        Otherwise, instead of flushing the buffer and then writing the
+        pieces separately, we hand both to the resource in one go.
+    */
+    std::span<const std::byte> pending{};
+    if (m_buffer.is_write_dirty()) {
+        pending = {m_buffer.get_data_ptr(), m_buffer.get_position()};
+    }
+    std::size_t bytes_written{write_gather_raw(pending, pieces)};
+    m_buffer.set_write_dirty(false);
+    if (bytes_written < pending.size()) {
+        return 0;
+    }
+    return bytes_written - pending.size();
+} // function -----------------------------------------------------------------
+
 void
 output_resource::flush ()
 {
@@ -39,6 +79,25 @@ output_resource::flush ()
     }
 } // function -----------------------------------------------------------------
 
+// Protected Functions --------------------------------------------------------
+
+std::size_t
+output_resource::write_gather_raw (
+    std::span<const std::byte> pending,
+    std::span<const std::span<const std::byte>> pieces
+) {
+    std::size_t bytes_written{0};
+    if (!pending.empty()) {
+        bytes_written += write_raw(pending.data(), pending.size());
+    }
+    for (const auto& piece : pieces) {
+        if (!piece.empty()) {
+            bytes_written += write_raw(piece.data(), piece.size());
+        }
+    }
+    return bytes_written;
+} // function -----------------------------------------------------------------
+
 // Private Functions ----------------------------------------------------------
 
 std::size_t
@@ -52,7 +111,19 @@ output_resource::write_buffered (
         it and then write the data to the buffer.
     */
     if (m_buffer.get_position() + byte_count > m_buffer.get_capacity()) {
+        std::size_t pending_byte_count{
+            m_buffer.is_write_dirty() ? m_buffer.get_position() : 0
+        };
         this->flush();
+        if (pending_byte_count > 0) {
+            record_buffer_miss(pending_byte_count);
+        }
+
+        /*
+            The buffer is empty at this point, so this is where it may
+            be resized when its capacity is adaptive.
+        */
+        adapt_buffer_capacity();
 
         /*
             If the number of bytes to write is greater than
@@ -61,8 +132,11 @@ output_resource::write_buffered (
             the remaining data directly to the resource.
         */
         if (byte_count > m_buffer.get_capacity()) {
+            record_buffer_miss(0);
             return write_raw(data, byte_count);
         }
+    } else {
+        record_buffer_hit();
     }
 
     /*
@@ -73,13 +73,16 @@ void
 text_input_stream<InputResource>::append_line (
     TargetString& target
 ) {
-    char32_t code_point;
-    while (!this->is_at_end()) {
-        code_point = read_filtered_code_point();
-        if (code_point == '\n') {
+    switch (m_source_encoding_form) {
+        case utf8:
+            append_text<char8_t>(target, true);
+            break;
+        case utf16:
+            append_text<char16_t>(target, true);
+            break;
+        case utf32:
+            append_text<char32_t>(target, true);
             break;
-        }
-        append_code_point(target, code_point);
     }
 } // function -----------------------------------------------------------------
 
@@ -97,6 +100,181 @@ text_input_stream<InputResource>::read_line (
     append_line(target);
 } // function -----------------------------------------------------------------
 
+template <
+    typename InputResource
+>
+std::u8string_view
+text_input_stream<InputResource>::read_line ()
+{
+    /*
+        The line can be handed out where it is when there is nothing to
+        filter out of it other than a carriage return right before the
+        line feed.
+    */
+    if (m_source_encoding_form == utf8) {
+        auto& resource{this->grab_resource()};
+        std::span<const std::byte> view{resource.peek_view()};
+        const auto* data{reinterpret_cast<const char8_t*>(view.data())};
+        const char8_t* line_feed{nullptr};
+        if (!view.empty()) {
+            line_feed = static_cast<const char8_t*>(
+                std::memchr(data, '\n', view.size())
+            );
+        }
+        if (line_feed != nullptr) {
+            auto line_size{static_cast<std::size_t>(line_feed - data)};
+            std::size_t content_size{line_size};
+            if (content_size > 0 && data[content_size - 1] == '\r') {
+                --content_size;
+            }
+            if (
+                std::memchr(data, '\r', content_size) == nullptr
+                    && impl::find_invalid_utf8(data, content_size)
+                        == content_size
+                    && impl::find_encoded_surrogate(data, content_size)
+                        == content_size
+            ) {
+                resource.consume(line_size + 1);
+                return std::u8string_view{data, content_size};
+            }
+        }
+    }
+
+    read_line(m_line_storage);
+    return m_line_storage;
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+std::u8string_view
+text_input_stream<InputResource>::read_token (
+    std::u8string_view delimiters
+) {
+    bool is_delimiter[0x80]{};
+    for (char8_t delimiter : delimiters) {
+        if (delimiter >= 0x80) {
+            throw std::invalid_argument{
+                "The delimiters have to be ASCII characters."
+            };
+        }
+        is_delimiter[delimiter] = true;
+    }
+
+    /*
+        The token can be handed out where it is when it's followed by a
+        delimiter in the buffered window and there are no carriage
+        returns to filter out of it or of the delimiters before it. The
+        delimiters that are skipped are read either way.
+    */
+    if (m_source_encoding_form == utf8) {
+        auto& resource{this->grab_resource()};
+        std::span<const std::byte> view{resource.peek_view()};
+        const auto* data{reinterpret_cast<const char8_t*>(view.data())};
+        std::size_t size{view.size()};
+        auto stops_token = [&is_delimiter] (char8_t code_unit) {
+            return code_unit < 0x80
+                && (is_delimiter[code_unit] || code_unit == '\r');
+        };
+        std::size_t skipped_size{0};
+        while (
+            skipped_size < size
+                && stops_token(data[skipped_size])
+                && data[skipped_size] != '\r'
+        ) {
+            ++skipped_size;
+        }
+        resource.consume(skipped_size);
+        data += skipped_size;
+        size -= skipped_size;
+        std::size_t token_size{0};
+        while (token_size < size && !stops_token(data[token_size])) {
+            ++token_size;
+        }
+        if (
+            token_size > 0
+                && token_size < size
+                && data[token_size] != '\r'
+                && impl::find_invalid_utf8(data, token_size) == token_size
+                && impl::find_encoded_surrogate(data, token_size)
+                    == token_size
+        ) {
+            resource.consume(token_size + 1);
+            return std::u8string_view{data, token_size};
+        }
+    }
+
+    m_line_storage.clear();
+    char32_t code_point;
+    while (!this->is_at_end()) {
+        code_point = read_filtered_code_point();
+        if (code_point >= 0x80 || !is_delimiter[code_point]) {
+            append_code_point(m_line_storage, code_point);
+            break;
+        }
+    }
+    while (!this->is_at_end()) {
+        code_point = read_filtered_code_point();
+        if (code_point < 0x80 && is_delimiter[code_point]) {
+            break;
+        }
+        append_code_point(m_line_storage, code_point);
+    }
+    return m_line_storage;
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+std::u8string_view
+text_input_stream<InputResource>::read_word ()
+{
+    /*
+        Only ASCII words are handed out where they are, so that the
+        whitespace outside of ASCII is left to the operator that reads
+        strings, which also takes care of carriage returns and of words
+        that aren't all in the buffered window.
+    */
+    if (m_source_encoding_form == utf8) {
+        auto& resource{this->grab_resource()};
+        std::span<const std::byte> view{resource.peek_view()};
+        const auto* data{reinterpret_cast<const char8_t*>(view.data())};
+        std::size_t size{view.size()};
+        std::size_t skipped_size{0};
+        while (
+            skipped_size < size
+                && data[skipped_size] != '\r'
+                && data[skipped_size] < 0x80
+                && is_whitespace(data[skipped_size])
+        ) {
+            ++skipped_size;
+        }
+        resource.consume(skipped_size);
+        data += skipped_size;
+        size -= skipped_size;
+        std::size_t word_size{0};
+        while (
+            word_size < size
+                && data[word_size] < 0x80
+                && !is_whitespace(data[word_size])
+        ) {
+            ++word_size;
+        }
+        if (
+            word_size > 0
+                && word_size < size
+                && data[word_size] != '\r'
+                && is_whitespace(data[word_size])
+        ) {
+            resource.consume(word_size + 1);
+            return std::u8string_view{data, word_size};
+        }
+    }
+
+    *this >> m_line_storage;
+    return m_line_storage;
+} // function -----------------------------------------------------------------
+
 template <
     typename InputResource
 >
@@ -107,8 +285,16 @@ void
 text_input_stream<InputResource>::append_all (
     TargetString& target
 ) {
-    while (!this->is_at_end()) {
-        append_code_point(target, read_filtered_code_point());
+    switch (m_source_encoding_form) {
+        case utf8:
+            append_text<char8_t>(target, false);
+            break;
+        case utf16:
+            append_text<char16_t>(target, false);
+            break;
+        case utf32:
+            append_text<char32_t>(target, false);
+            break;
     }
 } // function -----------------------------------------------------------------
 
@@ -223,6 +409,38 @@ template <
 >
 char32_t
 text_input_stream<InputResource>::read_utf8_code_point ()
+{
+    /*
+        A code point that lies whole in the buffered window is decoded
+        right there. Otherwise, be it because the sequence is split
+        across refills or because it's invalid, we go byte by byte,
+        which also throws the right exception when there is one.
+    */
+    std::span<const std::byte> view{this->grab_resource().peek_view()};
+    if (!view.empty()) {
+        const auto* data{reinterpret_cast<const unsigned char*>(view.data())};
+        char32_t code_point{data[0]};
+        std::size_t sequence_length{1};
+        if (code_point >= 0x80) {
+            sequence_length = decode_utf8_sequence(
+                data,
+                view.size(),
+                code_point
+            );
+        }
+        if (sequence_length > 0) {
+            this->grab_resource().consume(sequence_length);
+            return code_point;
+        }
+    }
+    return read_utf8_code_point_by_code_unit();
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+char32_t
+text_input_stream<InputResource>::read_utf8_code_point_by_code_unit ()
 {
     char8_t code_unit;
     if (!read_utf8_code_unit(code_unit)) {
@@ -395,6 +613,259 @@ text_input_stream<InputResource>::read_utf32_bom ()
     }
 } // function -----------------------------------------------------------------
 
+template <
+    typename InputResource
+>
+template <
+    typename CodeUnit,
+    writable_raii_text_object TargetString
+>
+void
+text_input_stream<InputResource>::append_text (
+    TargetString& target,
+    bool stops_at_line_feed
+) {
+    auto& resource{this->grab_resource()};
+    bool is_after_carriage_return{false};
+    [[maybe_unused]] CodeUnit block[
+        std::is_same_v<CodeUnit, char8_t> ? 1 : text_block_size
+    ];
+    while (true) {
+        std::span<const std::byte> view{resource.peek_view()};
+        if (view.empty()) {
+            break;
+        }
+
+        /*
+            UTF-8 text is looked at where it is, but wider code units may
+            not be aligned in the window, and they may have to have their
+            bytes reversed, so they're copied out first.
+        */
+        const CodeUnit* data;
+        std::size_t size;
+        if constexpr (std::is_same_v<CodeUnit, char8_t>) {
+            data = reinterpret_cast<const char8_t*>(view.data());
+            size = view.size();
+        } else {
+            size = std::min(view.size() / sizeof (CodeUnit), text_block_size);
+            std::memcpy(block, view.data(), size * sizeof (CodeUnit));
+            if (this->get_endianness() != std::endian::native) {
+                invert_endianness_of_elements(
+                    reinterpret_cast<std::byte*>(block),
+                    sizeof (CodeUnit),
+                    size
+                );
+            }
+            data = block;
+        }
+
+        /*
+            A line feed can't be part of a longer sequence, so the text up
+            to the first one is looked at as a whole: it's validated in
+            bulk and appended in slices between carriage returns. UTF-32
+            isn't validated here, the same as when it's read by code point.
+        */
+        const CodeUnit* line_feed{nullptr};
+        std::size_t segment_size{size};
+        if (stops_at_line_feed) {
+            if constexpr (std::is_same_v<CodeUnit, char8_t>) {
+                line_feed = static_cast<const char8_t*>(
+                    std::memchr(data, '\n', size)
+                );
+            } else {
+                line_feed = std::find(data, data + size, CodeUnit{'\n'});
+                if (line_feed == data + size) {
+                    line_feed = nullptr;
+                }
+            }
+            if (line_feed != nullptr) {
+                segment_size = static_cast<std::size_t>(line_feed - data);
+            }
+        }
+        std::size_t valid_size{segment_size};
+        if constexpr (std::is_same_v<CodeUnit, char8_t>) {
+            valid_size = impl::find_invalid_utf8(data, segment_size);
+        } else if constexpr (std::is_same_v<CodeUnit, char16_t>) {
+            valid_size = impl::find_invalid_utf16(data, segment_size);
+        }
+        append_segment(target, data, valid_size, is_after_carriage_return);
+        if (valid_size == segment_size && size > 0) {
+            if (line_feed != nullptr) {
+                resource.consume((segment_size + 1) * sizeof (CodeUnit));
+                return;
+            }
+            resource.consume(segment_size * sizeof (CodeUnit));
+            continue;
+        }
+
+        /*
+            The sequence after the valid ones is split across refills or
+            it's invalid, so we let the code unit by code unit path deal
+            with it and look at the buffered window again afterwards.
+        */
+        resource.consume(valid_size * sizeof (CodeUnit));
+        char32_t code_point;
+        if constexpr (std::is_same_v<CodeUnit, char8_t>) {
+            code_point = read_utf8_code_point_by_code_unit();
+        } else {
+            code_point = read_code_point();
+        }
+
+        /*
+            A carriage return is dropped unless it's the last code point,
+            and the code point after it is taken as it is.
+        */
+        if (code_point == '\r' && !is_after_carriage_return) {
+            is_after_carriage_return = true;
+        } else {
+            is_after_carriage_return = false;
+            if (code_point == '\n' && stops_at_line_feed) {
+                return;
+            }
+            append_code_point(target, code_point);
+        }
+    }
+    if (is_after_carriage_return) {
+        append_code_point(target, U'\r');
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+template <
+    typename CodeUnit,
+    writable_raii_text_object TargetString
+>
+void
+text_input_stream<InputResource>::append_segment (
+    TargetString& target,
+    const CodeUnit* data,
+    std::size_t size,
+    bool& is_after_carriage_return
+) {
+    const CodeUnit* slice_begin{data};
+    const CodeUnit* end{data + size};
+    while (slice_begin != end) {
+        const CodeUnit* carriage_return;
+        if constexpr (std::is_same_v<CodeUnit, char8_t>) {
+            carriage_return = static_cast<const char8_t*>(
+                std::memchr(
+                    slice_begin,
+                    '\r',
+                    static_cast<std::size_t>(end - slice_begin)
+                )
+            );
+        } else {
+            carriage_return = std::find(slice_begin, end, CodeUnit{'\r'});
+            if (carriage_return == end) {
+                carriage_return = nullptr;
+            }
+        }
+        const CodeUnit* slice_end{
+            carriage_return != nullptr ? carriage_return : end
+        };
+        if (slice_end != slice_begin) {
+            append_slice(
+                target,
+                slice_begin,
+                static_cast<std::size_t>(slice_end - slice_begin)
+            );
+            is_after_carriage_return = false;
+        }
+        if (carriage_return == nullptr) {
+            break;
+        }
+        if (is_after_carriage_return) {
+            append_code_point(target, U'\r');
+            is_after_carriage_return = false;
+        } else {
+            is_after_carriage_return = true;
+        }
+        slice_begin = carriage_return + 1;
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+template <
+    typename CodeUnit,
+    writable_raii_text_object TargetString
+>
+void
+text_input_stream<InputResource>::append_slice (
+    TargetString& target,
+    const CodeUnit* data,
+    std::size_t size
+) {
+    using target_code_unit_type = impl::encoding_form_unit_t<
+        typename TargetString::value_type
+    >;
+    if constexpr (std::is_same_v<CodeUnit, char8_t>) {
+        if constexpr (std::is_same_v<target_code_unit_type, char8_t>) {
+            if (impl::find_encoded_surrogate(data, size) != size) {
+                throw invalid_code_point{};
+            }
+        }
+    }
+    if constexpr (std::is_same_v<target_code_unit_type, CodeUnit>) {
+        target.append(data, data + size);
+    } else if constexpr (
+        impl::is_transcodable_unit_v<typename TargetString::value_type>
+    ) {
+        using value_type = typename TargetString::value_type;
+        std::size_t old_size{target.size()};
+        target.resize(
+            old_size + impl::measure_transcoding<value_type>(data, size)
+        );
+        impl::transcode_unchecked(data, size, target.data() + old_size);
+    } else {
+        for (char32_t code_point : by_code_point{
+            std::basic_string_view<CodeUnit>{data, size}
+        }) {
+            append_code_point(target, code_point);
+        }
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+std::size_t
+text_input_stream<InputResource>::decode_utf8_sequence (
+    const unsigned char* data,
+    std::size_t byte_count,
+    char32_t& code_point
+)
+noexcept
+{
+    std::size_t sequence_length;
+    if ((data[0] >> 5) == 0b110) {
+        sequence_length = 2;
+        code_point = data[0] & 0b0001'1111;
+    } else if ((data[0] >> 4) == 0b1110) {
+        sequence_length = 3;
+        code_point = data[0] & 0b0000'1111;
+    } else if ((data[0] >> 3) == 0b11110) {
+        sequence_length = 4;
+        code_point = data[0] & 0b0000'0111;
+    } else {
+        return 0;
+    }
+    if (sequence_length > byte_count) {
+        return 0;
+    }
+    for (std::size_t i{1}; i < sequence_length; ++i) {
+        if ((data[i] & 0b1100'0000) != 0b1000'0000) {
+            return 0;
+        }
+        code_point <<= 6;
+        code_point |= data[i] & 0b0011'1111;
+    }
+    return sequence_length;
+} // function -----------------------------------------------------------------
+
 // Free Functions -------------------------------------------------------------
 
 template <
@@ -475,9 +946,7 @@ operator >> (
     text_input_stream<InputResource>& stream,
     bool& target
 ) {
-    std::u8string input;
-    stream >> input;
-    target = parse_bool(input, bool_format{});
+    target = parse_bool(stream.read_word(), bool_format{});
     return stream;
 } // function -----------------------------------------------------------------
 
@@ -490,9 +959,7 @@ operator >> (
     text_input_stream<InputResource>& stream,
     T& target
 ) {
-    std::u8string input;
-    stream >> input;
-    target = parse_integer<T>(input, integer_format{});
+    target = parse_integer<T>(stream.read_word(), integer_format{});
     return stream;
 } // function -----------------------------------------------------------------
 
@@ -505,9 +972,10 @@ operator >> (
     text_input_stream<InputResource>& stream,
     T& target
 ) {
-    std::u8string input;
-    stream >> input;
-    target = parse_floating_point<T>(input, floating_point_format{});
+    target = parse_floating_point<T>(
+        stream.read_word(),
+        floating_point_format{}
+    );
     return stream;
 } // function -----------------------------------------------------------------
 
@@ -65,12 +65,9 @@ void
 text_output_stream<OutputResource>::write_code_point_in_utf8 (
     char32_t code_point
 ) {
-    std::u8string data;
-    append_code_point(data, code_point);
-    this->write(
-        reinterpret_cast<const std::byte*>(data.data()),
-        data.size()
-    );
+    char8_t data[4];
+    std::size_t size{encode_in_utf8(code_point, data)};
+    this->write(reinterpret_cast<const std::byte*>(data), size);
 } // function -----------------------------------------------------------------
 
 template <
@@ -80,25 +77,8 @@ void
 text_output_stream<OutputResource>::write_code_point_in_utf16 (
     char32_t code_point
 ) {
-    std::u16string data;
-    append_code_point(data, code_point);
-    if (this->get_endianness() == std::endian::native) {
-        this->write(
-            reinterpret_cast<const std::byte*>(data.data()),
-            data.size() * sizeof (char16_t)
-        );
-    } else {
-        this->reverse_write(
-            reinterpret_cast<std::byte*>(data.data()),
-            sizeof (char16_t)
-        );
-        if (data.size() > 1) {
-            this->reverse_write(
-                reinterpret_cast<std::byte*>(data.data() + 1),
-                sizeof (char16_t)
-            );
-        }
-    }
+    char16_t data[2];
+    write_code_units(data, encode_in_utf16(code_point, data));
 } // function -----------------------------------------------------------------
 
 template <
@@ -108,17 +88,7 @@ void
 text_output_stream<OutputResource>::write_code_point_in_utf32 (
     char32_t code_point
 ) {
-    if (this->get_endianness() == std::endian::native) {
-        this->write(
-            reinterpret_cast<const std::byte*>(&code_point),
-            sizeof (char32_t)
-        );
-    } else {
-        this->reverse_write(
-            reinterpret_cast<std::byte*>(&code_point),
-            sizeof (char32_t)
-        );
-    }
+    write_code_units(&code_point, 1);
 } // function -----------------------------------------------------------------
 
 template <
@@ -141,6 +111,230 @@ text_output_stream<OutputResource>::write_code_point (
     }
 } // function -----------------------------------------------------------------
 
+template <
+    typename OutputResource
+>
+template <
+    typename CodeUnit
+>
+void
+text_output_stream<OutputResource>::write_code_units (
+    CodeUnit* data,
+    std::size_t count
+) {
+    if constexpr (sizeof (CodeUnit) > 1) {
+        if (this->get_endianness() != std::endian::native) {
+            invert_endianness_of_elements(
+                reinterpret_cast<std::byte*>(data),
+                sizeof (CodeUnit),
+                count
+            );
+        }
+    }
+    this->write(
+        reinterpret_cast<const std::byte*>(data),
+        count * sizeof (CodeUnit)
+    );
+} // function -----------------------------------------------------------------
+
+template <
+    typename OutputResource
+>
+template <
+    typename CodeUnit
+>
+void
+text_output_stream<OutputResource>::write_text (
+    const CodeUnit* data,
+    std::size_t size
+) {
+    switch (m_target_encoding_form) {
+        case utf8:
+            write_text_as<char8_t>(data, size);
+            break;
+        case utf16:
+            write_text_as<char16_t>(data, size);
+            break;
+        case utf32:
+            write_text_as<char32_t>(data, size);
+            break;
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    typename OutputResource
+>
+template <
+    typename OutputCodeUnit,
+    typename InputCodeUnit
+>
+void
+text_output_stream<OutputResource>::write_text_as (
+    const InputCodeUnit* data,
+    std::size_t size
+) {
+    using input_form = impl::encoding_form_unit_t<InputCodeUnit>;
+
+    /*
+        Text that is already in the target encoding form and endianness is
+        written as it is.
+    */
+    if constexpr (std::is_same_v<input_form, OutputCodeUnit>) {
+        if (
+            sizeof (OutputCodeUnit) == 1
+                || this->get_endianness() == std::endian::native
+        ) {
+            this->write(
+                reinterpret_cast<const std::byte*>(data),
+                size * sizeof (InputCodeUnit)
+            );
+            return;
+        }
+    }
+
+    /*
+        A block of input code units can take up to four times as many output
+        code units, which is the case when going from UTF-32 to UTF-8.
+    */
+    OutputCodeUnit block[text_block_size * 4];
+    std::size_t position{0};
+    while (position < size) {
+        std::size_t block_end{std::min(size, position + text_block_size)};
+        if (block_end < size) {
+            /*
+                The block can't end in the middle of a code point.
+            */
+            if constexpr (std::is_same_v<input_form, char8_t>) {
+                for (
+                    int i{0};
+                    i < 3 && is_trailing_byte(data[block_end]);
+                    ++i
+                ) {
+                    --block_end;
+                }
+            } else if constexpr (std::is_same_v<input_form, char16_t>) {
+                if (
+                    is_leading_surrogate(
+                        static_cast<char16_t>(data[block_end - 1])
+                    )
+                ) {
+                    --block_end;
+                }
+            }
+        }
+
+        std::size_t block_size{block_end - position};
+        std::size_t output_size{
+            impl::measure_transcoding<OutputCodeUnit>(
+                data + position,
+                block_size
+            )
+        };
+        impl::transcode_unchecked(data + position, block_size, block);
+        write_code_units(block, output_size);
+        position = block_end;
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    typename OutputResource
+>
+template <
+    typename OutputCodeUnit
+>
+void
+text_output_stream<OutputResource>::write_chars_as (
+    std::string_view source
+) {
+    OutputCodeUnit block[text_block_size * 2];
+    std::size_t block_size{0};
+    for (char current_code_point : source) {
+        if (block_size > text_block_size * 2 - 2) {
+            write_code_units(block, block_size);
+            block_size = 0;
+        }
+        if constexpr (std::is_same_v<OutputCodeUnit, char16_t>) {
+            block_size += encode_in_utf16(
+                current_code_point,
+                block + block_size
+            );
+        } else {
+            block[block_size++] = current_code_point;
+        }
+    }
+    write_code_units(block, block_size);
+} // function -----------------------------------------------------------------
+
+template <
+    typename OutputResource
+>
+std::size_t
+text_output_stream<OutputResource>::encode_in_utf8 (
+    char32_t code_point,
+    char8_t* output
+) {
+    if (!is_code_point_valid(code_point)) {
+        throw invalid_code_point{};
+    }
+    if (code_point < 0x80) {
+        output[0] = static_cast<char8_t>(code_point);
+        return 1;
+    } else if (code_point < 0x800) {
+        output[0] = static_cast<char8_t>((code_point >> 6) | 0b1100'0000);
+        output[1] = static_cast<char8_t>(
+            (code_point & 0b0011'1111) | 0b1000'0000
+        );
+        return 2;
+    } else if (code_point < 0x10000) {
+        output[0] = static_cast<char8_t>((code_point >> 12) | 0b1110'0000);
+        output[1] = static_cast<char8_t>(
+            ((code_point >> 6) & 0b0011'1111) | 0b1000'0000
+        );
+        output[2] = static_cast<char8_t>(
+            (code_point & 0b0011'1111) | 0b1000'0000
+        );
+        return 3;
+    } else {
+        output[0] = static_cast<char8_t>((code_point >> 18) | 0b1111'0000);
+        output[1] = static_cast<char8_t>(
+            ((code_point >> 12) & 0b0011'1111) | 0b1000'0000
+        );
+        output[2] = static_cast<char8_t>(
+            ((code_point >> 6) & 0b0011'1111) | 0b1000'0000
+        );
+        output[3] = static_cast<char8_t>(
+            (code_point & 0b0011'1111) | 0b1000'0000
+        );
+        return 4;
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    typename OutputResource
+>
+std::size_t
+text_output_stream<OutputResource>::encode_in_utf16 (
+    char32_t code_point,
+    char16_t* output
+)
+noexcept
+{
+    if (!is_surrogate(code_point) && code_point <= maximum_bmp_code_point) {
+        output[0] = static_cast<char16_t>(code_point);
+        return 1;
+    }
+    code_point -= 0x10000;
+    output[0] = static_cast<char16_t>(
+        ((0b1111'1111'1100'0000'0000 & code_point) >> 10)
+            + leading_surrogate_minimum_value
+    );
+    output[1] = static_cast<char16_t>(
+        (0b0000'0000'0011'1111'1111 & code_point)
+            + trailing_surrogate_minimum_value
+    );
+    return 2;
+} // function -----------------------------------------------------------------
+
 // Free Functions -------------------------------------------------------------
 
 template <
@@ -194,14 +388,10 @@ operator << (
             );
             break;
         case utf16:
-            for (char current_code_point : source) {
-                stream.write_code_point_in_utf16(current_code_point);
-            }
+            stream.template write_chars_as<char16_t>(source);
             break;
         case utf32:
-            for (char current_code_point : source) {
-                stream.write_code_point_in_utf32(current_code_point);
-            }
+            stream.template write_chars_as<char32_t>(source);
             break;
     }
     return stream;
@@ -226,24 +416,7 @@ operator << (
     text_output_stream<OutputResource>& stream,
     const std::u8string_view& source
 ) {
-    switch (stream.get_encoding_form()) {
-        case utf8:
-            stream.write(
-                reinterpret_cast<const std::byte*>(std::data(source)),
-                std::size(source)
-            );
-            break;
-        case utf16:
-            for (char32_t current_code_point : by_code_point{source}) {
-                stream.write_code_point_in_utf16(current_code_point);
-            }
-            break;
-        case utf32:
-            for (char32_t current_code_point : by_code_point{source}) {
-                stream.write_code_point_in_utf32(current_code_point);
-            }
-            break;
-    }
+    stream.write_text(std::data(source), std::size(source));
     return stream;
 } // function -----------------------------------------------------------------
 
@@ -266,30 +439,7 @@ operator << (
     text_output_stream<OutputResource>& stream,
     const std::u16string_view& source
 ) {
-    switch (stream.get_encoding_form()) {
-        case utf8:
-            for (char32_t current_code_point : by_code_point{source}) {
-                stream.write_code_point_in_utf8(current_code_point);
-            }
-            break;
-        case utf16:
-            if (stream.get_endianness() == std::endian::native) {
-                stream.write(
-                    reinterpret_cast<const std::byte*>(std::data(source)),
-                    std::size(source) * sizeof (char16_t)
-                );
-            } else {
-                for (char32_t current_code_point : by_code_point{source}) {
-                    stream.write_code_point_in_utf16(current_code_point);
-                }
-            }
-            break;
-        case utf32:
-            for (char32_t current_code_point : by_code_point{source}) {
-                stream.write_code_point_in_utf32(current_code_point);
-            }
-            break;
-    }
+    stream.write_text(std::data(source), std::size(source));
     return stream;
 } // function -----------------------------------------------------------------
 
@@ -312,30 +462,7 @@ operator << (
     text_output_stream<OutputResource>& stream,
     const std::u32string_view& source
 ) {
-    switch (stream.get_encoding_form()) {
-        case utf8:
-            for (char32_t current_code_point : by_code_point{source}) {
-                stream.write_code_point_in_utf8(current_code_point);
-            }
-            break;
-        case utf16:
-            for (char32_t current_code_point : by_code_point{source}) {
-                stream.write_code_point_in_utf16(current_code_point);
-            }
-            break;
-        case utf32:
-            if (stream.get_endianness() == std::endian::native) {
-                stream.write(
-                    reinterpret_cast<const std::byte*>(std::data(source)),
-                    std::size(source) * sizeof (char32_t)
-                );
-            } else {
-                for (char32_t current_code_point : by_code_point{source}) {
-                    stream.write_code_point_in_utf32(current_code_point);
-                }
-            }
-            break;
-    }
+    stream.write_text(std::data(source), std::size(source));
     return stream;
 } // function -----------------------------------------------------------------
 
@@ -358,49 +485,7 @@ operator << (
     text_output_stream<OutputResource>& stream,
     const std::wstring_view& source
 ) {
-    switch (stream.get_encoding_form()) {
-        case utf8:
-            for (char32_t current_code_point : by_code_point{source}) {
-                stream.write_code_point_in_utf8(current_code_point);
-            }
-            break;
-        case utf16:
-            if constexpr (sizeof (wchar_t) == 2) {
-                if (stream.get_endianness() == std::endian::native) {
-                    stream.write(
-                        reinterpret_cast<const std::byte*>(std::data(source)),
-                        std::size(source) * sizeof (wchar_t)
-                    );
-                } else {
-                    for (char32_t current_code_point : by_code_point{source}) {
-                        stream.write_code_point_in_utf16(current_code_point);
-                    }
-                }
-            } else {
-                for (char32_t current_code_point : by_code_point{source}) {
-                    stream.write_code_point_in_utf16(current_code_point);
-                }
-            }
-            break;
-        case utf32:
-            if constexpr (sizeof (wchar_t) == 2) {
-                for (char32_t current_code_point : by_code_point{source}) {
-                    stream.write_code_point_in_utf32(current_code_point);
-                }
-            } else {
-                if (stream.get_endianness() == std::endian::native) {
-                    stream.write(
-                        reinterpret_cast<const std::byte*>(std::data(source)),
-                        std::size(source) * sizeof (wchar_t)
-                    );
-                } else {
-                    for (char32_t current_code_point : by_code_point{source}) {
-                        stream.write_code_point_in_utf32(current_code_point);
-                    }
-                }
-            }
-            break;
-    }
+    stream.write_text(std::data(source), std::size(source));
     return stream;
 } // function -----------------------------------------------------------------
 
@@ -435,17 +520,9 @@ operator << (
     text_output_stream<OutputResource>& stream,
     T source
 ) {
-    switch (stream.get_encoding_form()) {
-        case utf8:
-            stream << format_integer<std::u8string>(source, integer_format{});
-            break;
-        case utf16:
-            stream << format_integer<std::u16string>(source, integer_format{});
-            break;
-        case utf32:
-            stream << format_integer<std::u32string>(source, integer_format{});
-            break;
-    }
+    char8_t buffer[max_formatted_integer_size_v<T>];
+    std::size_t size{format_integer_to(source, buffer, integer_format{})};
+    stream << std::u8string_view{buffer, size};
     return stream;
 } // function -----------------------------------------------------------------
 
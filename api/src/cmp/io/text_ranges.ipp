@@ -0,0 +1,268 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cmp/io/text_ranges.hpp>
+
+namespace cmp {
+
+// ---------------------------------- cmp::line_range<InputResource>::iterator
+
+// Constructors and Destructor ------------------------------------------------
+
+template <
+    typename InputResource
+>
+line_range<InputResource>::iterator::iterator (
+    line_range& range
+)
+noexcept
+    : m_range{&range}
+{
+} // function -----------------------------------------------------------------
+
+// Operator Overloads ---------------------------------------------------------
+
+template <
+    typename InputResource
+>
+typename line_range<InputResource>::iterator::reference
+line_range<InputResource>::iterator::operator * ()
+const noexcept
+{
+    return m_range->m_current_line;
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+typename line_range<InputResource>::iterator&
+line_range<InputResource>::iterator::operator ++ ()
+{
+    m_range->advance();
+    return *this;
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+void
+line_range<InputResource>::iterator::operator ++ (
+    int
+) {
+    m_range->advance();
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+bool
+line_range<InputResource>::iterator::operator == (
+    std::default_sentinel_t
+)
+const noexcept
+{
+    return m_range == nullptr || m_range->m_is_done;
+} // function -----------------------------------------------------------------
+
+// -------------------------------------------- cmp::line_range<InputResource>
+
+// Constructors and Destructor ------------------------------------------------
+
+template <
+    typename InputResource
+>
+line_range<InputResource>::line_range (
+    text_input_stream<InputResource>& stream
+)
+noexcept
+    : m_stream{&stream}
+    , m_current_line{}
+    , m_is_done{false}
+{
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+typename line_range<InputResource>::iterator
+line_range<InputResource>::begin ()
+{
+    advance();
+    return iterator{*this};
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+std::default_sentinel_t
+line_range<InputResource>::end ()
+const noexcept
+{
+    return std::default_sentinel;
+} // function -----------------------------------------------------------------
+
+// Private Functions ----------------------------------------------------------
+
+template <
+    typename InputResource
+>
+void
+line_range<InputResource>::advance ()
+{
+    if (m_stream->is_at_end()) {
+        m_is_done = true;
+        return;
+    }
+    m_current_line = m_stream->read_line();
+} // function -----------------------------------------------------------------
+
+// --------------------------------- cmp::token_range<InputResource>::iterator
+
+// Constructors and Destructor ------------------------------------------------
+
+template <
+    typename InputResource
+>
+token_range<InputResource>::iterator::iterator (
+    token_range& range
+)
+noexcept
+    : m_range{&range}
+{
+} // function -----------------------------------------------------------------
+
+// Operator Overloads ---------------------------------------------------------
+
+template <
+    typename InputResource
+>
+typename token_range<InputResource>::iterator::reference
+token_range<InputResource>::iterator::operator * ()
+const noexcept
+{
+    return m_range->m_current_token;
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+typename token_range<InputResource>::iterator&
+token_range<InputResource>::iterator::operator ++ ()
+{
+    m_range->advance();
+    return *this;
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+void
+token_range<InputResource>::iterator::operator ++ (
+    int
+) {
+    m_range->advance();
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+bool
+token_range<InputResource>::iterator::operator == (
+    std::default_sentinel_t
+)
+const noexcept
+{
+    return m_range == nullptr || m_range->m_is_done;
+} // function -----------------------------------------------------------------
+
+// ------------------------------------------- cmp::token_range<InputResource>
+
+// Constructors and Destructor ------------------------------------------------
+
+template <
+    typename InputResource
+>
+token_range<InputResource>::token_range (
+    text_input_stream<InputResource>& stream,
+    std::u8string_view delimiters
+)
+noexcept
+    : m_stream{&stream}
+    , m_delimiters{delimiters}
+    , m_current_token{}
+    , m_is_done{false}
+{
+} // function -----------------------------------------------------------------
+
+// Core -----------------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+typename token_range<InputResource>::iterator
+token_range<InputResource>::begin ()
+{
+    advance();
+    return iterator{*this};
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+std::default_sentinel_t
+token_range<InputResource>::end ()
+const noexcept
+{
+    return std::default_sentinel;
+} // function -----------------------------------------------------------------
+
+// Private Functions ----------------------------------------------------------
+
+template <
+    typename InputResource
+>
+void
+token_range<InputResource>::advance ()
+{
+    /*
+        A token is only ever empty when nothing but delimiters was left.
+    */
+    if (!m_stream->is_at_end()) {
+        m_current_token = m_stream->read_token(m_delimiters);
+        if (!m_current_token.empty()) {
+            return;
+        }
+    }
+    m_is_done = true;
+} // function -----------------------------------------------------------------
+
+// Free Functions -------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+line_range<InputResource>
+lines (
+    text_input_stream<InputResource>& stream
+)
+noexcept
+{
+    return line_range<InputResource>{stream};
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputResource
+>
+token_range<InputResource>
+tokens (
+    text_input_stream<InputResource>& stream,
+    std::u8string_view delimiters
+)
+noexcept
+{
+    return token_range<InputResource>{stream, delimiters};
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -0,0 +1,314 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+
+#include <cmp/io/transcoding_input_resource.hpp>
+
+namespace cmp {
+
+// ----------------------------------- cmp::transcoding_input_resource<Source>
+
+// Constructors and Destructor ------------------------------------------------
+
+template <
+    typename Source
+>
+transcoding_input_resource<Source>::transcoding_input_resource (
+    referenced_resource_type& source,
+    std::size_t buffer_capacity
+)
+    : transcoding_input_resource{
+          source,
+          utf8,
+          std::endian::big,
+          buffer_capacity
+      }
+{
+    skip_bom();
+} // function -----------------------------------------------------------------
+
+template <
+    typename Source
+>
+transcoding_input_resource<Source>::transcoding_input_resource (
+    referenced_resource_type& source,
+    encoding_form source_encoding_form,
+    std::endian source_endianness,
+    std::size_t buffer_capacity
+)
+    : transfer_resource{buffer_capacity}
+    , input_resource{buffer_capacity}
+    , m_source{&source}
+    , m_source_encoding_form{source_encoding_form}
+    , m_source_endianness{source_endianness}
+    , m_pending_bytes{}
+    , m_pending_position{0}
+    , m_pending_size{0}
+{
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+template <
+    typename Source
+>
+bool
+transcoding_input_resource<Source>::is_at_end ()
+const noexcept
+{
+    if (
+        !m_buffer.is_read_dirty()
+            && m_buffer.get_position() < m_buffer.get_size()
+    ) {
+        return false;
+    }
+    if (m_pending_position < m_pending_size) {
+        return false;
+    }
+    return m_source->is_at_end();
+} // function -----------------------------------------------------------------
+
+template <
+    typename Source
+>
+encoding_form
+transcoding_input_resource<Source>::get_source_encoding_form ()
+const noexcept
+{
+    return m_source_encoding_form;
+} // function -----------------------------------------------------------------
+
+template <
+    typename Source
+>
+std::endian
+transcoding_input_resource<Source>::get_source_endianness ()
+const noexcept
+{
+    return m_source_endianness;
+} // function -----------------------------------------------------------------
+
+template <
+    typename Source
+>
+typename transcoding_input_resource<Source>::referenced_resource_type&
+transcoding_input_resource<Source>::grab_source ()
+noexcept
+{
+    return *m_source;
+} // function -----------------------------------------------------------------
+
+template <
+    typename Source
+>
+const typename transcoding_input_resource<Source>::referenced_resource_type&
+transcoding_input_resource<Source>::grab_source ()
+const noexcept
+{
+    return *m_source;
+} // function -----------------------------------------------------------------
+
+// Protected Functions --------------------------------------------------------
+
+template <
+    typename Source
+>
+std::size_t
+transcoding_input_resource<Source>::read_raw (
+    std::byte* data,
+    std::size_t byte_count,
+    read_request rr
+) {
+    std::size_t bytes_read{0};
+    while (bytes_read < byte_count) {
+        /*
+            The rest of a code point that didn't fit last time goes first.
+            When there is less room left than the longest UTF-8 sequence,
+            the next code points are transcoded to the side and copied.
+        */
+        if (m_pending_position == m_pending_size) {
+            if (byte_count - bytes_read >= std::size(m_pending_bytes)) {
+                std::size_t block_size{
+                    transcode_block(data + bytes_read, byte_count - bytes_read)
+                };
+                if (block_size == 0) {
+                    break;
+                }
+                bytes_read += block_size;
+                if (rr == read_request::fill_buffer) {
+                    break;
+                }
+                continue;
+            }
+            m_pending_position = 0;
+            m_pending_size = transcode_block(
+                m_pending_bytes,
+                std::size(m_pending_bytes)
+            );
+            if (m_pending_size == 0) {
+                break;
+            }
+        }
+        std::size_t pending_count{std::min(
+            m_pending_size - m_pending_position,
+            byte_count - bytes_read
+        )};
+        std::memcpy(
+            data + bytes_read,
+            m_pending_bytes + m_pending_position,
+            pending_count
+        );
+        m_pending_position += pending_count;
+        bytes_read += pending_count;
+    }
+    return bytes_read;
+} // function -----------------------------------------------------------------
+
+// Private Functions ----------------------------------------------------------
+
+template <
+    typename Source
+>
+void
+transcoding_input_resource<Source>::skip_bom ()
+{
+    std::span<const std::byte> view{m_source->peek_view(4)};
+    const auto* data{reinterpret_cast<const unsigned char*>(view.data())};
+    auto starts_with = [&] (std::initializer_list<unsigned char> bytes) {
+        return view.size() >= bytes.size()
+            && std::equal(bytes.begin(), bytes.end(), data);
+    };
+
+    /*
+        The UTF-32 BOMs are looked for first, since the little-endian one
+        starts with the little-endian UTF-16 one.
+    */
+    std::size_t bom_size{0};
+    if (starts_with({0x00, 0x00, 0xFE, 0xFF})) {
+        m_source_encoding_form = utf32;
+        m_source_endianness = std::endian::big;
+        bom_size = 4;
+    } else if (starts_with({0xFF, 0xFE, 0x00, 0x00})) {
+        m_source_encoding_form = utf32;
+        m_source_endianness = std::endian::little;
+        bom_size = 4;
+    } else if (starts_with({0xFE, 0xFF})) {
+        m_source_encoding_form = utf16;
+        m_source_endianness = std::endian::big;
+        bom_size = 2;
+    } else if (starts_with({0xFF, 0xFE})) {
+        m_source_encoding_form = utf16;
+        m_source_endianness = std::endian::little;
+        bom_size = 2;
+    } else if (starts_with({0xEF, 0xBB, 0xBF})) {
+        bom_size = 3;
+    }
+    m_source->consume(bom_size);
+} // function -----------------------------------------------------------------
+
+template <
+    typename Source
+>
+std::size_t
+transcoding_input_resource<Source>::transcode_block (
+    std::byte* output,
+    std::size_t output_size
+) {
+    switch (m_source_encoding_form) {
+        case utf8:
+            break;
+        case utf16:
+            return transcode_wide_block<char16_t>(output, output_size);
+        case utf32:
+            return transcode_wide_block<char32_t>(output, output_size);
+    }
+
+    /*
+        UTF-8 only has to be copied, and it doesn't matter where the
+        copies split the sequences.
+    */
+    std::span<const std::byte> view{m_source->peek_view()};
+    std::size_t byte_count{std::min(view.size(), output_size)};
+    if (byte_count > 0) {
+        std::memcpy(output, view.data(), byte_count);
+        m_source->consume(byte_count);
+    }
+    return byte_count;
+} // function -----------------------------------------------------------------
+
+template <
+    typename Source
+>
+template <
+    typename CodeUnit
+>
+std::size_t
+transcoding_input_resource<Source>::transcode_wide_block (
+    std::byte* output,
+    std::size_t output_size
+) {
+    /*
+        A surrogate pair takes up four bytes in UTF-8 and every other
+        UTF-16 code unit takes up three at most, while a UTF-32 code unit
+        takes up four at most, so that many code units always fit.
+    */
+    constexpr std::size_t max_bytes_per_code_unit{
+        sizeof (CodeUnit) == 2 ? 3 : 4
+    };
+    std::span<const std::byte> view{
+        m_source->peek_view(2 * sizeof (CodeUnit))
+    };
+    std::size_t available_count{view.size() / sizeof (CodeUnit)};
+    if (available_count == 0) {
+        if (!view.empty()) {
+            throw read_past_end{};
+        }
+        return 0;
+    }
+    std::size_t count{std::min({
+        available_count,
+        text_block_size,
+        output_size / max_bytes_per_code_unit
+    })};
+
+    /*
+        A surrogate pair split by the end of the block is left for the
+        next block, unless it's all there is room for.
+    */
+    CodeUnit block[text_block_size];
+    auto load = [&] (std::size_t load_count) {
+        std::memcpy(block, view.data(), load_count * sizeof (CodeUnit));
+        if (m_source_endianness != std::endian::native) {
+            invert_endianness_of_elements(
+                reinterpret_cast<std::byte*>(block),
+                sizeof (CodeUnit),
+                load_count
+            );
+        }
+    };
+    load(count);
+    if constexpr (sizeof (CodeUnit) == 2) {
+        if (is_leading_surrogate(block[count - 1])) {
+            if (count > 1) {
+                --count;
+            } else if (available_count > 1) {
+                load(++count);
+            } else {
+                throw read_past_end{};
+            }
+        }
+    }
+
+    auto* code_units{reinterpret_cast<char8_t*>(output)};
+    std::size_t output_count{
+        impl::measure_transcoding<char8_t>(block, count)
+    };
+    impl::transcode_unchecked(block, count, code_units);
+    m_source->consume(count * sizeof (CodeUnit));
+    return output_count;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -1,6 +1,8 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <algorithm>
+
 #include <cmp/io/transfer_resource.hpp>
 
 namespace cmp {
@@ -13,7 +15,150 @@ transfer_resource::transfer_resource (
     std::size_t buffer_capacity
 )
     : m_buffer{buffer_capacity}
+    , m_buffer_sizing{buffer_sizing::fixed}
+    , m_min_buffer_capacity{buffer_capacity}
+    , m_buffer_hit_count{0}
+    , m_buffer_miss_count{0}
+    , m_buffer_whole_count{0}
+{
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+std::size_t
+transfer_resource::get_buffer_capacity ()
+const noexcept
+{
+    return m_buffer.get_capacity();
+} // function -----------------------------------------------------------------
+
+buffer_sizing
+transfer_resource::get_buffer_sizing ()
+const noexcept
 {
+    return m_buffer_sizing;
+} // function -----------------------------------------------------------------
+
+void
+transfer_resource::set_buffer_sizing (
+    buffer_sizing new_buffer_sizing
+) {
+    m_buffer_sizing = new_buffer_sizing;
+    m_min_buffer_capacity = m_buffer.get_capacity();
+    m_buffer_hit_count = 0;
+    m_buffer_miss_count = 0;
+    m_buffer_whole_count = 0;
+    apply_preferred_buffer_capacity();
+} // function -----------------------------------------------------------------
+
+// Protected Functions --------------------------------------------------------
+
+std::size_t
+transfer_resource::query_preferred_buffer_capacity ()
+const noexcept
+{
+    return 0;
+} // function -----------------------------------------------------------------
+
+void
+transfer_resource::apply_preferred_buffer_capacity ()
+{
+    if (
+        m_buffer_sizing != buffer_sizing::adaptive
+            || m_buffer.get_capacity() == 0
+    ) {
+        return;
+    }
+
+    /*
+        We only ever grow the buffer here, since it may be holding bytes
+        that the resource mirrors, and we don't go past the limit even
+        if the resource would prefer more, as pipes sometimes do.
+    */
+    std::size_t preferred_capacity{std::min(
+        query_preferred_buffer_capacity(),
+        max_adaptive_buffer_capacity
+    )};
+    if (preferred_capacity > m_buffer.get_capacity()) {
+        m_buffer.set_capacity(preferred_capacity);
+    }
+    m_min_buffer_capacity = std::max(
+        m_min_buffer_capacity,
+        m_buffer.get_capacity()
+    );
+} // function -----------------------------------------------------------------
+
+void
+transfer_resource::record_buffer_hit ()
+noexcept
+{
+    if (m_buffer_sizing == buffer_sizing::adaptive) {
+        ++m_buffer_hit_count;
+    }
+} // function -----------------------------------------------------------------
+
+void
+transfer_resource::record_buffer_miss (
+    std::size_t byte_count
+)
+noexcept
+{
+    if (m_buffer_sizing != buffer_sizing::adaptive) {
+        return;
+    }
+
+    /*
+        A fill or flush counts as whole when it transferred at least
+        three quarters of the buffer, which tells us that the resource
+        has bytes to spare, or room for them, and that a bigger buffer
+        would save it trips.
+    */
+    ++m_buffer_miss_count;
+    if (byte_count * 4 >= m_buffer.get_capacity() * 3) {
+        ++m_buffer_whole_count;
+    }
+} // function -----------------------------------------------------------------
+
+void
+transfer_resource::adapt_buffer_capacity ()
+{
+    if (
+        m_buffer_sizing != buffer_sizing::adaptive
+            || m_buffer_miss_count < buffer_adaptation_period
+    ) {
+        return;
+    }
+
+    /*
+        The buffer grows while it serves at least as many requests as it
+        misses and is mostly filled or flushed whole. It shrinks when it
+        serves fewer than a quarter of the requests, since then the bytes
+        it moves ahead of time are mostly wasted.
+    */
+    std::size_t request_count{m_buffer_hit_count + m_buffer_miss_count};
+    std::size_t capacity{m_buffer.get_capacity()};
+    std::size_t new_capacity{capacity};
+    if (
+        m_buffer_hit_count >= m_buffer_miss_count
+            && m_buffer_whole_count * 2 >= m_buffer_miss_count
+    ) {
+        new_capacity = std::max(
+            capacity,
+            std::min(capacity * 2, max_adaptive_buffer_capacity)
+        );
+    } else if (m_buffer_hit_count * 4 < request_count) {
+        new_capacity = std::min(
+            capacity,
+            std::max(capacity / 2, m_min_buffer_capacity)
+        );
+    }
+    if (new_capacity != capacity && capacity > 0) {
+        m_buffer.set_capacity(new_capacity);
+    }
+
+    m_buffer_hit_count = 0;
+    m_buffer_miss_count = 0;
+    m_buffer_whole_count = 0;
 } // function -----------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -215,12 +215,68 @@ OutputString
 convert_string (
     const InputString& s
 ) {
-    OutputString result;
-    result.reserve(string_size(s));
-    for (char32_t current_code_point : by_code_point{s}) {
-        append_code_point(result, current_code_point);
+    using input_code_unit_type = std::remove_cv_t<value_type_t<InputString>>;
+    using output_code_unit_type = typename OutputString::value_type;
+    if constexpr (
+        impl::is_transcodable_unit_v<input_code_unit_type>
+            && impl::is_transcodable_unit_v<output_code_unit_type>
+    ) {
+        std::basic_string_view<input_code_unit_type> view{s};
+        OutputString result(
+            impl::measure_transcoding<output_code_unit_type>(
+                view.data(),
+                view.size()
+            ),
+            output_code_unit_type{}
+        );
+        impl::transcode_unchecked(view.data(), view.size(), result.data());
+        return result;
+    } else {
+        OutputString result;
+        result.reserve(string_size(s));
+        for (char32_t current_code_point : by_code_point{s}) {
+            append_code_point(result, current_code_point);
+        }
+        return result;
     }
-    return result;
+} // function -----------------------------------------------------------------
+
+template <
+    typename OutputCodeUnit,
+    unicode_text_object InputString
+>
+std::size_t
+transcoded_size (
+    const InputString& s
+) {
+    std::basic_string_view<std::remove_cv_t<value_type_t<InputString>>> view{
+        s
+    };
+    return impl::measure_transcoding<OutputCodeUnit>(view.data(), view.size());
+} // function -----------------------------------------------------------------
+
+template <
+    unicode_text_object InputString,
+    typename OutputCodeUnit
+>
+std::size_t
+transcode_into (
+    const InputString& s,
+    std::span<OutputCodeUnit> target
+) {
+    std::basic_string_view<std::remove_cv_t<value_type_t<InputString>>> view{
+        s
+    };
+    std::size_t output_size{
+        impl::measure_transcoding<OutputCodeUnit>(view.data(), view.size())
+    };
+    if (output_size > target.size()) {
+        throw std::length_error{
+            "The target can't hold the transcoded string."
+        };
+    }
+    impl::transcode_unchecked(view.data(), view.size(), target.data());
+    return output_size;
 } // function -----------------------------------------------------------------
 
 template <
@@ -282,20 +338,42 @@ validate_string (
 )
 noexcept
 {
-    auto bcp_range{by_code_point(s)};
-    auto bcp_range_end{std::cend(bcp_range)};
-    auto bcp_iterator{std::cbegin(bcp_range)};
-    try {
-        while (bcp_iterator != bcp_range_end) {
-            if (*bcp_iterator > maximum_code_point) {
-                return bcp_iterator;
+    using code_unit_type = value_type_t<InputString>;
+    if constexpr (
+        std::is_same_v<code_unit_type, char8_t>
+        || std::is_same_v<code_unit_type, char16_t>
+    ) {
+        /*
+            The kernels accept exactly what by_code_point does, so the
+            iterator can be built straight at the offset that they return.
+        */
+        std::basic_string_view<code_unit_type> view{s};
+        std::size_t offset;
+        if constexpr (std::is_same_v<code_unit_type, char8_t>) {
+            offset = impl::find_invalid_utf8(view.data(), view.size());
+        } else {
+            offset = impl::find_invalid_utf16(view.data(), view.size());
+        }
+        return typename by_code_point<code_unit_type>::const_iterator{
+            view.cbegin() + offset,
+            view.cend()
+        };
+    } else {
+        auto bcp_range{by_code_point(s)};
+        auto bcp_range_end{std::cend(bcp_range)};
+        auto bcp_iterator{std::cbegin(bcp_range)};
+        try {
+            while (bcp_iterator != bcp_range_end) {
+                if (*bcp_iterator > maximum_code_point) {
+                    return bcp_iterator;
+                }
+                ++bcp_iterator;
             }
-            ++bcp_iterator;
+        } catch (const invalid_unicode_encoding& ex) {
+        } catch (const iterated_past_end& ex) {
         }
-    } catch (const invalid_unicode_encoding& ex) {
-    } catch (const iterated_past_end& ex) {
+        return bcp_iterator;
     }
-    return bcp_iterator;
 } // function -----------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -4,10 +4,14 @@
 #include <cmp/core/config.hpp>
 
 #if CMP_CONFIG_HEADER_ONLY == false
+#   include <cmp/unicode/impl/floating_point.cpp>
 #   include <cmp/unicode/impl/impl.cpp>
+#   include <cmp/unicode/impl/transcoding.cpp>
+#   include <cmp/unicode/impl/validation.cpp>
 #   include <cmp/unicode/algorithms.cpp>
 #   include <cmp/unicode/by_code_point.cpp>
 #   include <cmp/unicode/exceptions.cpp>
 #   include <cmp/unicode/formats.cpp>
+#   include <cmp/unicode/formatters.cpp>
 #   include <cmp/unicode/parsers.cpp>
 #endif // CMP_CONFIG_HEADER_ONLY
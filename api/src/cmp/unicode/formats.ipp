@@ -0,0 +1,382 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cmp/unicode/formats.hpp>
+
+namespace cmp {
+
+// ------------------------------------------------------- cmp::integer_format
+
+// Constructors and Destructor ------------------------------------------------
+
+constexpr
+integer_format::integer_format ()
+noexcept
+    : m_radix{10}
+    , m_sign_status{sign_status::only_when_negative}
+    , m_thousands_separator{thousands_separator::none}
+{
+} // function -----------------------------------------------------------------
+
+constexpr
+integer_format::integer_format (
+    unsigned int initial_radix,
+    sign_status initial_sign_status,
+    thousands_separator initial_thousands_separator
+)
+    : m_radix{initial_radix}
+    , m_sign_status{initial_sign_status}
+    , m_thousands_separator{initial_thousands_separator}
+{
+    if (m_radix < 2 || m_radix > 36) {
+        throw invalid_radix{};
+    }
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+constexpr
+unsigned int
+integer_format::get_radix ()
+const noexcept
+{
+    return m_radix;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+integer_format::set_radix (
+    unsigned int new_radix
+)
+noexcept
+{
+    m_radix = new_radix;
+} // function -----------------------------------------------------------------
+
+constexpr
+sign_status
+integer_format::get_sign_status ()
+const noexcept
+{
+    return m_sign_status;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+integer_format::set_sign_status (
+    sign_status new_sign_status
+)
+noexcept
+{
+    m_sign_status = new_sign_status;
+} // function -----------------------------------------------------------------
+
+constexpr
+thousands_separator
+integer_format::get_thousands_separator ()
+const noexcept
+{
+    return m_thousands_separator;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+integer_format::set_thousands_separator (
+    thousands_separator new_thousands_separator
+)
+noexcept
+{
+    m_thousands_separator = new_thousands_separator;
+} // function -----------------------------------------------------------------
+
+// ------------------------------------------------ cmp::floating_point_format
+
+// Constructors and Destructor ------------------------------------------------
+
+constexpr
+floating_point_format::floating_point_format ()
+noexcept
+    : m_radix{10}
+    , m_sign_status{sign_status::only_when_negative}
+    , m_thousands_separator{thousands_separator::none}
+    , m_radix_character{radix_character::period}
+    , m_radix_place_limit{radix_place_limit::none}
+    , m_radix_place_count{0}
+    , m_notation{floating_point_notation::fixed}
+{
+} // function -----------------------------------------------------------------
+
+constexpr
+floating_point_format::floating_point_format (
+    unsigned int initial_radix,
+    sign_status initial_sign_status,
+    thousands_separator initial_thousands_separator,
+    radix_character initial_radix_character,
+    radix_place_limit initial_radix_place_limit,
+    unsigned int initial_radix_place_count,
+    floating_point_notation initial_notation
+)
+    : m_radix{initial_radix}
+    , m_sign_status{initial_sign_status}
+    , m_thousands_separator{initial_thousands_separator}
+    , m_radix_character{initial_radix_character}
+    , m_radix_place_limit{initial_radix_place_limit}
+    , m_radix_place_count{initial_radix_place_count}
+    , m_notation{initial_notation}
+{
+    if (m_radix < 2 || m_radix > 36) {
+        throw invalid_radix{};
+    }
+} // function -----------------------------------------------------------------
+
+// Accessors ------------------------------------------------------------------
+
+constexpr
+unsigned int
+floating_point_format::get_radix ()
+const noexcept
+{
+    return m_radix;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+floating_point_format::set_radix (
+    unsigned int new_radix
+)
+noexcept
+{
+    m_radix = new_radix;
+} // function -----------------------------------------------------------------
+
+constexpr
+sign_status
+floating_point_format::get_sign_status ()
+const noexcept
+{
+    return m_sign_status;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+floating_point_format::set_sign_status (
+    sign_status new_sign_status
+)
+noexcept
+{
+    m_sign_status = new_sign_status;
+} // function -----------------------------------------------------------------
+
+constexpr
+thousands_separator
+floating_point_format::get_thousands_separator ()
+const noexcept
+{
+    return m_thousands_separator;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+floating_point_format::set_thousands_separator (
+    thousands_separator new_thousands_separator
+)
+noexcept
+{
+    m_thousands_separator = new_thousands_separator;
+} // function -----------------------------------------------------------------
+
+constexpr
+radix_character
+floating_point_format::get_radix_character ()
+const noexcept
+{
+    return m_radix_character;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+floating_point_format::set_radix_character (
+    radix_character new_radix_character
+)
+noexcept
+{
+    m_radix_character = new_radix_character;
+} // function -----------------------------------------------------------------
+
+constexpr
+radix_place_limit
+floating_point_format::get_radix_place_limit ()
+const noexcept
+{
+    return m_radix_place_limit;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+floating_point_format::set_radix_place_limit (
+    radix_place_limit new_radix_place_limit
+)
+noexcept
+{
+    m_radix_place_limit = new_radix_place_limit;
+} // function -----------------------------------------------------------------
+
+constexpr
+unsigned int
+floating_point_format::get_radix_place_count ()
+const noexcept
+{
+    return m_radix_place_count;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+floating_point_format::set_radix_place_count (
+    unsigned int new_radix_place_count
+)
+noexcept
+{
+    m_radix_place_count = new_radix_place_count;
+} // function -----------------------------------------------------------------
+
+constexpr
+floating_point_notation
+floating_point_format::get_notation ()
+const noexcept
+{
+    return m_notation;
+} // function -----------------------------------------------------------------
+
+constexpr
+void
+floating_point_format::set_notation (
+    floating_point_notation new_notation
+)
+noexcept
+{
+    m_notation = new_notation;
+} // function -----------------------------------------------------------------
+
+namespace impl {
+
+// ---------------------------------------- cmp::impl::constant_integer_format
+
+// Core -----------------------------------------------------------------------
+
+template <
+    integer_format Format
+>
+constexpr
+unsigned int
+constant_integer_format<Format>::get_radix ()
+noexcept
+{
+    return Format.get_radix();
+} // function -----------------------------------------------------------------
+
+template <
+    integer_format Format
+>
+constexpr
+sign_status
+constant_integer_format<Format>::get_sign_status ()
+noexcept
+{
+    return Format.get_sign_status();
+} // function -----------------------------------------------------------------
+
+template <
+    integer_format Format
+>
+constexpr
+thousands_separator
+constant_integer_format<Format>::get_thousands_separator ()
+noexcept
+{
+    return Format.get_thousands_separator();
+} // function -----------------------------------------------------------------
+
+// --------------------------------- cmp::impl::constant_floating_point_format
+
+// Core -----------------------------------------------------------------------
+
+template <
+    floating_point_format Format
+>
+constexpr
+unsigned int
+constant_floating_point_format<Format>::get_radix ()
+noexcept
+{
+    return Format.get_radix();
+} // function -----------------------------------------------------------------
+
+template <
+    floating_point_format Format
+>
+constexpr
+sign_status
+constant_floating_point_format<Format>::get_sign_status ()
+noexcept
+{
+    return Format.get_sign_status();
+} // function -----------------------------------------------------------------
+
+template <
+    floating_point_format Format
+>
+constexpr
+thousands_separator
+constant_floating_point_format<Format>::get_thousands_separator ()
+noexcept
+{
+    return Format.get_thousands_separator();
+} // function -----------------------------------------------------------------
+
+template <
+    floating_point_format Format
+>
+constexpr
+radix_character
+constant_floating_point_format<Format>::get_radix_character ()
+noexcept
+{
+    return Format.get_radix_character();
+} // function -----------------------------------------------------------------
+
+template <
+    floating_point_format Format
+>
+constexpr
+radix_place_limit
+constant_floating_point_format<Format>::get_radix_place_limit ()
+noexcept
+{
+    return Format.get_radix_place_limit();
+} // function -----------------------------------------------------------------
+
+template <
+    floating_point_format Format
+>
+constexpr
+unsigned int
+constant_floating_point_format<Format>::get_radix_place_count ()
+noexcept
+{
+    return Format.get_radix_place_count();
+} // function -----------------------------------------------------------------
+
+template <
+    floating_point_format Format
+>
+constexpr
+floating_point_notation
+constant_floating_point_format<Format>::get_notation ()
+noexcept
+{
+    return Format.get_notation();
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -0,0 +1,63 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cmp/unicode/formatters.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+// ----------------------------------------------- cmp::impl::number_formatter
+
+// Private Functions ----------------------------------------------------------
+
+number_formatter::decimal_digits
+number_formatter::read_digits (
+    std::string_view text
+)
+noexcept
+{
+    decimal_digits result{{}, 0, 0};
+    bool is_after_radix_character{false};
+    std::size_t i{0};
+    for (; i < text.size() && text[i] != 'e'; ++i) {
+        if (text[i] == '.') {
+            is_after_radix_character = true;
+            continue;
+        }
+        if (!is_after_radix_character) {
+            ++result.point_position;
+        }
+        if (result.digit_count == 0 && text[i] == '0') {
+            --result.point_position;
+        } else if (
+            result.digit_count < static_cast<int>(std::size(result.digits))
+        ) {
+            result.digits[result.digit_count++] =
+                static_cast<char8_t>(text[i]);
+        }
+    }
+    if (i < text.size()) {
+        int exponent{0};
+        std::from_chars(
+            text.data() + i + (text[i + 1] == '+' ? 2 : 1),
+            text.data() + text.size(),
+            exponent
+        );
+        result.point_position += exponent;
+    }
+    while (
+        result.digit_count != 0
+            && result.digits[result.digit_count - 1] == '0'
+    ) {
+        --result.digit_count;
+    }
+    if (result.digit_count == 0) {
+        result.point_position = 1;
+    }
+    return result;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -13,70 +13,389 @@ namespace impl {
 
 template <
     writable_raii_text_object Output,
-    std::integral Input
+    std::integral Input,
+    typename Format
 >
 Output
 number_formatter::format_integer (
     Input input,
-    const integer_format& format
+    const Format& format
 ) {
-    Output output;
-    if (input == 0) {
-        append_code_point(output, '0');
-        return output;
+    char8_t buffer[max_formatted_integer_size_v<Input>];
+    std::size_t size{format_integer_to(input, buffer, format)};
+    return convert_string<Output>(std::u8string_view{buffer, size});
+} // function -----------------------------------------------------------------
+
+template <
+    std::integral Input,
+    typename Format
+>
+std::size_t
+number_formatter::format_integer_to (
+    Input input,
+    std::span<char8_t> target,
+    const Format& format
+) {
+    /*
+        The magnitude is worked out in the unsigned counterpart of the
+        promoted type, so that the most negative value has one too.
+    */
+    auto promoted_input{+input};
+    using magnitude_type = std::make_unsigned_t<decltype(promoted_input)>;
+    auto magnitude{static_cast<magnitude_type>(promoted_input)};
+    char8_t sign_character{0};
+    if constexpr (std::is_signed_v<decltype(promoted_input)>) {
+        if (promoted_input < 0) {
+            sign_character = '-';
+            magnitude = static_cast<magnitude_type>(0 - magnitude);
+        }
     }
-    unsigned int format_radix{format.get_radix()};
-    unsigned int digits_counted{0};
-    char sign_character{' '};
+    if (
+        sign_character == 0
+            && promoted_input != 0
+            && format.get_sign_status() == sign_status::always_show
+    ) {
+        sign_character = '+';
+    }
+
+    /*
+        The digits are written right to left into a buffer on the stack
+        and then copied into the target left to right, with the thousands
+        separators put in between them on the way.
+    */
+    char8_t digits[max_formatted_integer_size_v<Input>];
+    char8_t* digits_end{digits + std::size(digits)};
+    const char8_t* digit{
+        write_digits(magnitude, format.get_radix(), digits_end)
+    };
+    auto digit_count{static_cast<std::size_t>(digits_end - digit)};
+    const auto format_thousands_separator{format.get_thousands_separator()};
+    std::size_t separator_count{
+        format_thousands_separator == thousands_separator::none
+            ? 0
+            : (digit_count - 1) / 3
+    };
+    std::size_t size{
+        (sign_character != 0 ? 1 : 0) + digit_count + separator_count
+    };
+    if (size > target.size()) {
+        throw std::length_error{
+            "The target can't hold the formatted integer."
+        };
+    }
+    char8_t* output{target.data()};
+    if (sign_character != 0) {
+        *output++ = sign_character;
+    }
+    std::size_t group_size{digit_count - 3 * separator_count};
+    std::memcpy(output, digit, group_size);
+    output += group_size;
+    digit += group_size;
+    char8_t separator_character{
+        format_thousands_separator == thousands_separator::comma
+            ? u8','
+            : u8'.'
+    };
+    for (std::size_t i{0}; i < separator_count; ++i) {
+        *output++ = separator_character;
+        std::memcpy(output, digit, 3);
+        output += 3;
+        digit += 3;
+    }
+    return size;
+} // function -----------------------------------------------------------------
+
+template <
+    writable_raii_text_object Output,
+    std::floating_point Input,
+    typename Format
+>
+Output
+number_formatter::format_floating_point (
+    Input input,
+    const Format& format
+) {
+    if (format.get_radix() != 10) {
+        return format_floating_point_in_radix<Output>(input, format);
+    }
+    using code_unit_type = typename Output::value_type;
+
+    char8_t sign_character{0};
     if (input < 0) {
         sign_character = '-';
-    } else if (format.get_sign_status() == sign_status::always_show) {
+    } else if (
+        input > 0 && format.get_sign_status() == sign_status::always_show
+    ) {
         sign_character = '+';
     }
-    if constexpr (std::is_signed_v<Input>) {
-        input = std::abs(input);
+    if (!std::isfinite(input)) {
+        std::u8string_view name{std::isnan(input) ? u8"nan" : u8"inf"};
+        Output output;
+        if (sign_character != 0) {
+            append_code_point(output, sign_character);
+        }
+        for (char8_t character : name) {
+            append_code_point(output, character);
+        }
+        return output;
     }
-    while (input != 0) {
-        char character{static_cast<char>(input % format_radix)};
-        if (character <= 9) {
-            character += '0';
-        } else {
-            character += 'A' - 10;
+
+    Input magnitude{std::abs(input)};
+    decimal_digits digits{find_shortest_digits(magnitude)};
+    bool is_scientific{
+        format.get_notation() == floating_point_notation::scientific
+    };
+    if (
+        format.get_notation() == floating_point_notation::shortest
+            && digits.digit_count != 0
+    ) {
+        /*
+            Like std::to_chars, this goes by the length of either notation
+            without separators or a radix place limit, and picks fixed
+            notation when they are just as long.
+        */
+        int fraction_digit_count{
+            std::max(digits.digit_count - digits.point_position, 0)
+        };
+        int fixed_size{
+            std::max(digits.point_position, 1)
+                + fraction_digit_count
+                + (fraction_digit_count != 0 ? 1 : 0)
+        };
+        int exponent_magnitude{std::abs(digits.point_position - 1)};
+        int scientific_size{
+            digits.digit_count
+                + (digits.digit_count != 1 ? 1 : 0)
+                + 2
+                + (exponent_magnitude >= 1000
+                    ? 4
+                    : exponent_magnitude >= 100 ? 3 : 2)
+        };
+        is_scientific = scientific_size < fixed_size;
+    }
+
+    /*
+        The radix place count is kept well away from the largest int, so
+        that the place counts worked out from it can't overflow.
+    */
+    const auto place_limit{format.get_radix_place_limit()};
+    const auto place_count{
+        static_cast<int>(
+            std::min(
+                format.get_radix_place_count(),
+                static_cast<unsigned int>(
+                    std::numeric_limits<int>::max() / 4
+                )
+            )
+        )
+    };
+    if (place_limit != radix_place_limit::none) {
+        /*
+            Rounding the shortest digits would round twice, so the digits
+            are rounded from the exact value instead.
+        */
+        digits = find_rounded_digits(
+            magnitude,
+            is_scientific
+                ? std::chars_format::scientific
+                : std::chars_format::fixed,
+            place_count
+        );
+    }
+
+    int exponent{0};
+    int point_position{digits.point_position};
+    if (is_scientific) {
+        if (digits.digit_count != 0) {
+            exponent = point_position - 1;
         }
-        prepend_code_point(output, character);
-        input /= format_radix;
-        ++digits_counted;
-        if (digits_counted == 3) {
-            digits_counted = 0;
-            if (input != 0) {
-                switch (format.get_thousands_separator()) {
-                    case thousands_separator::comma:
-                        prepend_code_point(output, ',');
-                        break;
-                    case thousands_separator::period:
-                        prepend_code_point(output, '.');
-                        break;
-                    case thousands_separator::none:
-                        continue;
-                }
+        point_position = 1;
+    }
+    int integral_digit_count{std::max(point_position, 1)};
+    int fraction_digit_count{
+        place_limit == radix_place_limit::exactly_equal
+            ? place_count
+            : std::max(digits.digit_count - point_position, 0)
+    };
+    const auto format_thousands_separator{format.get_thousands_separator()};
+    bool has_separators{
+        format_thousands_separator != thousands_separator::none
+    };
+    char8_t exponent_digits[max_formatted_integer_size_v<int>];
+    char8_t* exponent_digits_end{
+        exponent_digits + std::size(exponent_digits)
+    };
+    char8_t* exponent_digit{exponent_digits_end};
+    if (is_scientific) {
+        exponent_digit = write_decimal_digits(
+            static_cast<unsigned int>(std::abs(exponent)),
+            exponent_digits_end
+        );
+        if (exponent_digits_end - exponent_digit < 2) {
+            *--exponent_digit = '0';
+        }
+    }
+    std::size_t size{
+        (sign_character != 0 ? 1u : 0u)
+            + static_cast<std::size_t>(integral_digit_count)
+            + (has_separators
+                ? static_cast<std::size_t>(integral_digit_count - 1) / 3
+                : 0)
+            + (fraction_digit_count != 0
+                ? 1 + static_cast<std::size_t>(fraction_digit_count)
+                    + (has_separators
+                        ? static_cast<std::size_t>(
+                            fraction_digit_count - 1
+                        ) / 3
+                        : 0)
+                : 0)
+            + (is_scientific
+                ? 2 + static_cast<std::size_t>(
+                    exponent_digits_end - exponent_digit
+                )
+                : 0)
+    };
+
+    /*
+        The digits at positions outside of the significant ones are the
+        zeros between them and the radix character.
+    */
+    Output output(size, code_unit_type{});
+    code_unit_type* cursor{output.data()};
+    auto write = [&cursor] (char8_t character) {
+        *cursor++ = static_cast<code_unit_type>(character);
+    };
+    auto digit_at = [&digits] (int position) {
+        return position >= 0 && position < digits.digit_count
+            ? digits.digits[position]
+            : u8'0';
+    };
+    char8_t separator_character{
+        format_thousands_separator == thousands_separator::comma
+            ? u8','
+            : u8'.'
+    };
+    if (sign_character != 0) {
+        write(sign_character);
+    }
+    for (int i{0}; i < integral_digit_count; ++i) {
+        if (has_separators && i != 0 && (integral_digit_count - i) % 3 == 0) {
+            write(separator_character);
+        }
+        write(digit_at(point_position - integral_digit_count + i));
+    }
+    if (fraction_digit_count != 0) {
+        write(
+            format.get_radix_character() == radix_character::period
+                ? u8'.'
+                : u8','
+        );
+        for (int i{0}; i < fraction_digit_count; ++i) {
+            if (has_separators && i != 0 && i % 3 == 0) {
+                write(separator_character);
             }
+            write(digit_at(point_position + i));
         }
     }
-    if (sign_character != ' ') {
-        prepend_code_point(output, sign_character);
+    if (is_scientific) {
+        write(u8'e');
+        write(exponent < 0 ? u8'-' : u8'+');
+        while (exponent_digit != exponent_digits_end) {
+            write(*exponent_digit++);
+        }
     }
-
     return output;
 } // function -----------------------------------------------------------------
 
+// Private Functions ----------------------------------------------------------
+
+template <
+    std::unsigned_integral Magnitude
+>
+char8_t*
+number_formatter::write_digits (
+    Magnitude magnitude,
+    unsigned int radix,
+    char8_t* end
+)
+noexcept
+{
+    if (radix == 10) {
+        return write_decimal_digits(magnitude, end);
+    }
+    if (std::has_single_bit(radix)) {
+        return write_power_of_two_digits(
+            magnitude,
+            std::countr_zero(radix),
+            end
+        );
+    }
+    do {
+        *--end = digit_characters[magnitude % radix];
+        magnitude /= radix;
+    } while (magnitude != 0);
+    return end;
+} // function -----------------------------------------------------------------
+
+template <
+    std::unsigned_integral Magnitude
+>
+char8_t*
+number_formatter::write_decimal_digits (
+    Magnitude magnitude,
+    char8_t* end
+)
+noexcept
+{
+    while (magnitude >= 100) {
+        auto pair_index{static_cast<std::size_t>(magnitude % 100)};
+        magnitude /= 100;
+        end -= 2;
+        std::memcpy(end, decimal_digit_pairs + 2 * pair_index, 2);
+    }
+    if (magnitude >= 10) {
+        end -= 2;
+        std::memcpy(
+            end,
+            decimal_digit_pairs + 2 * static_cast<std::size_t>(magnitude),
+            2
+        );
+    } else {
+        *--end = static_cast<char8_t>(u8'0' + magnitude);
+    }
+    return end;
+} // function -----------------------------------------------------------------
+
+template <
+    std::unsigned_integral Magnitude
+>
+char8_t*
+number_formatter::write_power_of_two_digits (
+    Magnitude magnitude,
+    int bits_per_digit,
+    char8_t* end
+)
+noexcept
+{
+    const Magnitude digit_mask{
+        static_cast<Magnitude>((Magnitude{1} << bits_per_digit) - 1)
+    };
+    do {
+        *--end = digit_characters[magnitude & digit_mask];
+        magnitude >>= bits_per_digit;
+    } while (magnitude != 0);
+    return end;
+} // function -----------------------------------------------------------------
+
 template <
     writable_raii_text_object Output,
-    std::floating_point Input
+    std::floating_point Input,
+    typename Format
 >
 Output
-number_formatter::format_floating_point (
+number_formatter::format_floating_point_in_radix (
     Input input,
-    const floating_point_format& format
+    const Format& format
 ) {
     integer_format equivalent_format{
         format.get_radix(),
@@ -144,6 +463,88 @@ number_formatter::format_floating_point (
     return output;
 } // function -----------------------------------------------------------------
 
+template <
+    std::floating_point Input
+>
+number_formatter::decimal_digits
+number_formatter::find_shortest_digits (
+    Input magnitude
+) {
+    decimal_digits result{{}, 0, 1};
+    if (magnitude == 0) {
+        return result;
+    }
+    if constexpr (
+        std::numeric_limits<Input>::is_iec559
+            && std::numeric_limits<Input>::digits
+                <= std::numeric_limits<double>::digits
+    ) {
+        decimal_floating_point decimal;
+        if constexpr (
+            std::numeric_limits<Input>::digits
+                <= std::numeric_limits<float>::digits
+        ) {
+            decimal = to_shortest_decimal(static_cast<float>(magnitude));
+        } else {
+            decimal = to_shortest_decimal(static_cast<double>(magnitude));
+        }
+        char8_t* end{result.digits + std::size(result.digits)};
+        char8_t* begin{write_decimal_digits(decimal.significand, end)};
+        result.digit_count = static_cast<int>(end - begin);
+        std::memmove(result.digits, begin, end - begin);
+        result.point_position = result.digit_count + decimal.exponent;
+        while (result.digits[result.digit_count - 1] == '0') {
+            --result.digit_count;
+        }
+        return result;
+    } else {
+        /*
+            Wider types, like the long double of x87, are left to
+            std::to_chars.
+        */
+        char text[64];
+        auto [end, error]{
+            std::to_chars(
+                text,
+                std::end(text),
+                magnitude,
+                std::chars_format::scientific
+            )
+        };
+        return read_digits({text, end});
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    std::floating_point Input
+>
+number_formatter::decimal_digits
+number_formatter::find_rounded_digits (
+    Input magnitude,
+    std::chars_format notation,
+    int place_count
+) {
+    std::string text(
+        static_cast<std::size_t>(
+            std::numeric_limits<Input>::max_exponent10
+                + std::numeric_limits<Input>::max_digits10
+                + place_count
+                + 8
+        ),
+        '\0'
+    );
+    auto [end, error]{
+        std::to_chars(
+            text.data(),
+            text.data() + text.size(),
+            magnitude,
+            notation,
+            place_count
+        )
+    };
+    return read_digits({text.data(), end});
+} // function -----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
 
 // Free Functions -------------------------------------------------------------
@@ -173,6 +574,49 @@ format_integer (
     return impl::number_formatter::format_integer<Output>(input, format);
 } // function -----------------------------------------------------------------
 
+template <
+    writable_raii_text_object Output,
+    integer_format Format,
+    std::integral Input
+>
+Output
+format_integer (
+    Input input
+) {
+    return impl::number_formatter::format_integer<Output>(
+        input,
+        impl::constant_integer_format<Format>{}
+    );
+} // function -----------------------------------------------------------------
+
+template <
+    std::integral Input
+>
+std::size_t
+format_integer_to (
+    Input input,
+    std::span<char8_t> target,
+    const integer_format& format
+) {
+    return impl::number_formatter::format_integer_to(input, target, format);
+} // function -----------------------------------------------------------------
+
+template <
+    integer_format Format,
+    std::integral Input
+>
+std::size_t
+format_integer_to (
+    Input input,
+    std::span<char8_t> target
+) {
+    return impl::number_formatter::format_integer_to(
+        input,
+        target,
+        impl::constant_integer_format<Format>{}
+    );
+} // function -----------------------------------------------------------------
+
 template <
     writable_raii_text_object Output,
     std::floating_point Input
@@ -188,4 +632,19 @@ format_floating_point (
     );
 } // function -----------------------------------------------------------------
 
+template <
+    writable_raii_text_object Output,
+    floating_point_format Format,
+    std::floating_point Input
+>
+Output
+format_floating_point (
+    Input input
+) {
+    return impl::number_formatter::format_floating_point<Output>(
+        input,
+        impl::constant_floating_point_format<Format>{}
+    );
+} // function -----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
@@ -0,0 +1,662 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cstring>
+
+#include <cmp/unicode/impl/transcoding.hpp>
+
+#if defined(CMP_ARCHITECTURE_X86)
+#   include <immintrin.h>
+#endif // CMP_ARCHITECTURE_X86
+
+namespace cmp {
+
+namespace impl {
+
+// Free Functions -------------------------------------------------------------
+
+std::size_t
+find_encoded_surrogate (
+    const char8_t* input,
+    std::size_t input_size
+)
+noexcept {
+    /*
+        Surrogates are the only code points whose sequences start with 0xED
+        followed by a byte that is at least 0xA0.
+    */
+    const char8_t* i{input};
+    const char8_t* end{input + input_size};
+    while (
+        (
+            i = static_cast<const char8_t*>(
+                std::memchr(i, 0xED, static_cast<std::size_t>(end - i))
+            )
+        ) != nullptr
+    ) {
+        if (i[1] >= 0xA0) {
+            return static_cast<std::size_t>(i - input);
+        }
+        ++i;
+    }
+    return input_size;
+} // function -----------------------------------------------------------------
+
+std::size_t
+transcode_fast_run (
+    const char8_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept {
+#if defined(CMP_ARCHITECTURE_X86)
+    using kernel_type = std::size_t (*)(
+        const char8_t*,
+        std::size_t,
+        char16_t*
+    ) noexcept;
+    static const kernel_type kernel{[] () noexcept -> kernel_type {
+        if (is_avx2_supported()) {
+            return &transcode_fast_run_avx2;
+        } else if (is_sse4_supported()) {
+            return &transcode_fast_run_sse4;
+        }
+        return nullptr;
+    }()};
+    if (kernel != nullptr) {
+        return kernel(input, input_size, output);
+    }
+#endif // CMP_ARCHITECTURE_X86
+    static_cast<void>(input);
+    static_cast<void>(input_size);
+    static_cast<void>(output);
+    return 0;
+} // function -----------------------------------------------------------------
+
+std::size_t
+transcode_fast_run (
+    const char8_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept {
+#if defined(CMP_ARCHITECTURE_X86)
+    using kernel_type = std::size_t (*)(
+        const char8_t*,
+        std::size_t,
+        char32_t*
+    ) noexcept;
+    static const kernel_type kernel{[] () noexcept -> kernel_type {
+        if (is_avx2_supported()) {
+            return &transcode_fast_run_avx2;
+        } else if (is_sse4_supported()) {
+            return &transcode_fast_run_sse4;
+        }
+        return nullptr;
+    }()};
+    if (kernel != nullptr) {
+        return kernel(input, input_size, output);
+    }
+#endif // CMP_ARCHITECTURE_X86
+    static_cast<void>(input);
+    static_cast<void>(input_size);
+    static_cast<void>(output);
+    return 0;
+} // function -----------------------------------------------------------------
+
+std::size_t
+transcode_fast_run (
+    const char16_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept {
+#if defined(CMP_ARCHITECTURE_X86)
+    using kernel_type = std::size_t (*)(
+        const char16_t*,
+        std::size_t,
+        char8_t*
+    ) noexcept;
+    static const kernel_type kernel{[] () noexcept -> kernel_type {
+        if (is_avx2_supported()) {
+            return &transcode_fast_run_avx2;
+        } else if (is_sse4_supported()) {
+            return &transcode_fast_run_sse4;
+        }
+        return nullptr;
+    }()};
+    if (kernel != nullptr) {
+        return kernel(input, input_size, output);
+    }
+#endif // CMP_ARCHITECTURE_X86
+    static_cast<void>(input);
+    static_cast<void>(input_size);
+    static_cast<void>(output);
+    return 0;
+} // function -----------------------------------------------------------------
+
+std::size_t
+transcode_fast_run (
+    const char16_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept {
+#if defined(CMP_ARCHITECTURE_X86)
+    using kernel_type = std::size_t (*)(
+        const char16_t*,
+        std::size_t,
+        char32_t*
+    ) noexcept;
+    static const kernel_type kernel{[] () noexcept -> kernel_type {
+        if (is_avx2_supported()) {
+            return &transcode_fast_run_avx2;
+        } else if (is_sse4_supported()) {
+            return &transcode_fast_run_sse4;
+        }
+        return nullptr;
+    }()};
+    if (kernel != nullptr) {
+        return kernel(input, input_size, output);
+    }
+#endif // CMP_ARCHITECTURE_X86
+    static_cast<void>(input);
+    static_cast<void>(input_size);
+    static_cast<void>(output);
+    return 0;
+} // function -----------------------------------------------------------------
+
+std::size_t
+transcode_fast_run (
+    const char32_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept {
+#if defined(CMP_ARCHITECTURE_X86)
+    using kernel_type = std::size_t (*)(
+        const char32_t*,
+        std::size_t,
+        char8_t*
+    ) noexcept;
+    static const kernel_type kernel{[] () noexcept -> kernel_type {
+        if (is_avx2_supported()) {
+            return &transcode_fast_run_avx2;
+        } else if (is_sse4_supported()) {
+            return &transcode_fast_run_sse4;
+        }
+        return nullptr;
+    }()};
+    if (kernel != nullptr) {
+        return kernel(input, input_size, output);
+    }
+#endif // CMP_ARCHITECTURE_X86
+    static_cast<void>(input);
+    static_cast<void>(input_size);
+    static_cast<void>(output);
+    return 0;
+} // function -----------------------------------------------------------------
+
+std::size_t
+transcode_fast_run (
+    const char32_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept {
+#if defined(CMP_ARCHITECTURE_X86)
+    using kernel_type = std::size_t (*)(
+        const char32_t*,
+        std::size_t,
+        char16_t*
+    ) noexcept;
+    static const kernel_type kernel{[] () noexcept -> kernel_type {
+        if (is_avx2_supported()) {
+            return &transcode_fast_run_avx2;
+        } else if (is_sse4_supported()) {
+            return &transcode_fast_run_sse4;
+        }
+        return nullptr;
+    }()};
+    if (kernel != nullptr) {
+        return kernel(input, input_size, output);
+    }
+#endif // CMP_ARCHITECTURE_X86
+    static_cast<void>(input);
+    static_cast<void>(input_size);
+    static_cast<void>(output);
+    return 0;
+} // function -----------------------------------------------------------------
+
+#if defined(CMP_ARCHITECTURE_X86)
+
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char8_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept {
+    std::size_t position{0};
+    for (; input_size - position >= 16; position += 16) {
+        __m128i bytes{_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(input + position)
+        )};
+        if (_mm_movemask_epi8(bytes) != 0) {
+            break;
+        }
+        __m128i* destination{reinterpret_cast<__m128i*>(output + position)};
+        _mm_storeu_si128(destination, _mm_cvtepu8_epi16(bytes));
+        _mm_storeu_si128(
+            destination + 1,
+            _mm_cvtepu8_epi16(_mm_srli_si128(bytes, 8))
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char8_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept {
+    std::size_t position{0};
+    for (; input_size - position >= 16; position += 16) {
+        __m128i bytes{_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(input + position)
+        )};
+        if (_mm_movemask_epi8(bytes) != 0) {
+            break;
+        }
+        __m128i* destination{reinterpret_cast<__m128i*>(output + position)};
+        _mm_storeu_si128(destination, _mm_cvtepu8_epi32(bytes));
+        _mm_storeu_si128(
+            destination + 1,
+            _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4))
+        );
+        _mm_storeu_si128(
+            destination + 2,
+            _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 8))
+        );
+        _mm_storeu_si128(
+            destination + 3,
+            _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 12))
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char16_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept {
+    const __m128i non_ascii_mask{_mm_set1_epi16(static_cast<short>(0xFF80))};
+
+    std::size_t position{0};
+    for (; input_size - position >= 16; position += 16) {
+        const __m128i* source{
+            reinterpret_cast<const __m128i*>(input + position)
+        };
+        __m128i low_units{_mm_loadu_si128(source)};
+        __m128i high_units{_mm_loadu_si128(source + 1)};
+        if (
+            !_mm_testz_si128(
+                _mm_or_si128(low_units, high_units),
+                non_ascii_mask
+            )
+        ) {
+            break;
+        }
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + position),
+            _mm_packus_epi16(low_units, high_units)
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char16_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept {
+    const __m128i surrogate_mask{_mm_set1_epi16(static_cast<short>(0xF800))};
+    const __m128i surrogate{_mm_set1_epi16(static_cast<short>(0xD800))};
+
+    std::size_t position{0};
+    for (; input_size - position >= 8; position += 8) {
+        __m128i units{_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(input + position)
+        )};
+        __m128i is_surrogate{_mm_cmpeq_epi16(
+            _mm_and_si128(units, surrogate_mask),
+            surrogate
+        )};
+        if (!_mm_testz_si128(is_surrogate, is_surrogate)) {
+            break;
+        }
+        __m128i* destination{reinterpret_cast<__m128i*>(output + position)};
+        _mm_storeu_si128(destination, _mm_cvtepu16_epi32(units));
+        _mm_storeu_si128(
+            destination + 1,
+            _mm_cvtepu16_epi32(_mm_srli_si128(units, 8))
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char32_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept {
+    const __m128i non_ascii_mask{_mm_set1_epi32(static_cast<int>(0xFFFFFF80))};
+
+    std::size_t position{0};
+    for (; input_size - position >= 16; position += 16) {
+        const __m128i* source{
+            reinterpret_cast<const __m128i*>(input + position)
+        };
+        __m128i code_points_0{_mm_loadu_si128(source)};
+        __m128i code_points_1{_mm_loadu_si128(source + 1)};
+        __m128i code_points_2{_mm_loadu_si128(source + 2)};
+        __m128i code_points_3{_mm_loadu_si128(source + 3)};
+        __m128i all_code_points{_mm_or_si128(
+            _mm_or_si128(code_points_0, code_points_1),
+            _mm_or_si128(code_points_2, code_points_3)
+        )};
+        if (!_mm_testz_si128(all_code_points, non_ascii_mask)) {
+            break;
+        }
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + position),
+            _mm_packus_epi16(
+                _mm_packus_epi32(code_points_0, code_points_1),
+                _mm_packus_epi32(code_points_2, code_points_3)
+            )
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+transcode_fast_run_sse4 (
+    const char32_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept {
+    const __m128i non_bmp_mask{_mm_set1_epi32(static_cast<int>(0xFFFF0000))};
+
+    std::size_t position{0};
+    for (; input_size - position >= 8; position += 8) {
+        const __m128i* source{
+            reinterpret_cast<const __m128i*>(input + position)
+        };
+        __m128i low_code_points{_mm_loadu_si128(source)};
+        __m128i high_code_points{_mm_loadu_si128(source + 1)};
+        if (
+            !_mm_testz_si128(
+                _mm_or_si128(low_code_points, high_code_points),
+                non_bmp_mask
+            )
+        ) {
+            break;
+        }
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + position),
+            _mm_packus_epi32(low_code_points, high_code_points)
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char8_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept {
+    std::size_t position{0};
+    for (; input_size - position >= 32; position += 32) {
+        __m256i bytes{_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(input + position)
+        )};
+        if (_mm256_movemask_epi8(bytes) != 0) {
+            break;
+        }
+        __m256i* destination{reinterpret_cast<__m256i*>(output + position)};
+        _mm256_storeu_si256(
+            destination,
+            _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes))
+        );
+        _mm256_storeu_si256(
+            destination + 1,
+            _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1))
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char8_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept {
+    std::size_t position{0};
+    for (; input_size - position >= 32; position += 32) {
+        __m256i bytes{_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(input + position)
+        )};
+        if (_mm256_movemask_epi8(bytes) != 0) {
+            break;
+        }
+        __m128i low_bytes{_mm256_castsi256_si128(bytes)};
+        __m128i high_bytes{_mm256_extracti128_si256(bytes, 1)};
+        __m256i* destination{reinterpret_cast<__m256i*>(output + position)};
+        _mm256_storeu_si256(destination, _mm256_cvtepu8_epi32(low_bytes));
+        _mm256_storeu_si256(
+            destination + 1,
+            _mm256_cvtepu8_epi32(_mm_srli_si128(low_bytes, 8))
+        );
+        _mm256_storeu_si256(
+            destination + 2,
+            _mm256_cvtepu8_epi32(high_bytes)
+        );
+        _mm256_storeu_si256(
+            destination + 3,
+            _mm256_cvtepu8_epi32(_mm_srli_si128(high_bytes, 8))
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char16_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept {
+    const __m256i non_ascii_mask{
+        _mm256_set1_epi16(static_cast<short>(0xFF80))
+    };
+
+    std::size_t position{0};
+    for (; input_size - position >= 32; position += 32) {
+        const __m256i* source{
+            reinterpret_cast<const __m256i*>(input + position)
+        };
+        __m256i low_units{_mm256_loadu_si256(source)};
+        __m256i high_units{_mm256_loadu_si256(source + 1)};
+        if (
+            !_mm256_testz_si256(
+                _mm256_or_si256(low_units, high_units),
+                non_ascii_mask
+            )
+        ) {
+            break;
+        }
+        /*
+            Packing works within each 128-bit lane, so the 64-bit pieces
+            have to be put back in order.
+        */
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + position),
+            _mm256_permute4x64_epi64(
+                _mm256_packus_epi16(low_units, high_units),
+                0b11'01'10'00
+            )
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char16_t* input,
+    std::size_t input_size,
+    char32_t* output
+)
+noexcept {
+    const __m256i surrogate_mask{
+        _mm256_set1_epi16(static_cast<short>(0xF800))
+    };
+    const __m256i surrogate{_mm256_set1_epi16(static_cast<short>(0xD800))};
+
+    std::size_t position{0};
+    for (; input_size - position >= 16; position += 16) {
+        __m256i units{_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(input + position)
+        )};
+        __m256i is_surrogate{_mm256_cmpeq_epi16(
+            _mm256_and_si256(units, surrogate_mask),
+            surrogate
+        )};
+        if (!_mm256_testz_si256(is_surrogate, is_surrogate)) {
+            break;
+        }
+        __m256i* destination{reinterpret_cast<__m256i*>(output + position)};
+        _mm256_storeu_si256(
+            destination,
+            _mm256_cvtepu16_epi32(_mm256_castsi256_si128(units))
+        );
+        _mm256_storeu_si256(
+            destination + 1,
+            _mm256_cvtepu16_epi32(_mm256_extracti128_si256(units, 1))
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char32_t* input,
+    std::size_t input_size,
+    char8_t* output
+)
+noexcept {
+    const __m256i non_ascii_mask{
+        _mm256_set1_epi32(static_cast<int>(0xFFFFFF80))
+    };
+    const __m256i lane_order{_mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)};
+
+    std::size_t position{0};
+    for (; input_size - position >= 32; position += 32) {
+        const __m256i* source{
+            reinterpret_cast<const __m256i*>(input + position)
+        };
+        __m256i code_points_0{_mm256_loadu_si256(source)};
+        __m256i code_points_1{_mm256_loadu_si256(source + 1)};
+        __m256i code_points_2{_mm256_loadu_si256(source + 2)};
+        __m256i code_points_3{_mm256_loadu_si256(source + 3)};
+        __m256i all_code_points{_mm256_or_si256(
+            _mm256_or_si256(code_points_0, code_points_1),
+            _mm256_or_si256(code_points_2, code_points_3)
+        )};
+        if (!_mm256_testz_si256(all_code_points, non_ascii_mask)) {
+            break;
+        }
+        /*
+            After packing within each 128-bit lane, each 32-bit piece holds
+            four bytes from one of the inputs, in an order that the lane
+            order puts right.
+        */
+        __m256i bytes{_mm256_packus_epi16(
+            _mm256_packus_epi32(code_points_0, code_points_1),
+            _mm256_packus_epi32(code_points_2, code_points_3)
+        )};
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + position),
+            _mm256_permutevar8x32_epi32(bytes, lane_order)
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+transcode_fast_run_avx2 (
+    const char32_t* input,
+    std::size_t input_size,
+    char16_t* output
+)
+noexcept {
+    const __m256i non_bmp_mask{
+        _mm256_set1_epi32(static_cast<int>(0xFFFF0000))
+    };
+
+    std::size_t position{0};
+    for (; input_size - position >= 16; position += 16) {
+        const __m256i* source{
+            reinterpret_cast<const __m256i*>(input + position)
+        };
+        __m256i low_code_points{_mm256_loadu_si256(source)};
+        __m256i high_code_points{_mm256_loadu_si256(source + 1)};
+        if (
+            !_mm256_testz_si256(
+                _mm256_or_si256(low_code_points, high_code_points),
+                non_bmp_mask
+            )
+        ) {
+            break;
+        }
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + position),
+            _mm256_permute4x64_epi64(
+                _mm256_packus_epi32(low_code_points, high_code_points),
+                0b11'01'10'00
+            )
+        );
+    }
+    return position;
+} // function -----------------------------------------------------------------
+
+#endif // CMP_ARCHITECTURE_X86
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -0,0 +1,326 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <cmp/unicode/impl/transcoding.hpp>
+
+namespace cmp {
+
+namespace impl {
+
+// Private Functions ----------------------------------------------------------
+
+/*
+    Throws what by_code_point throws for the code point at the beginning
+    of the given code units, which have been found to be invalid, or
+    invalid_code_point if by_code_point decodes it without complaint.
+*/
+template <
+    typename InputCodeUnit
+>
+[[noreturn]]
+void
+throw_transcoding_error (
+    const InputCodeUnit* input,
+    std::size_t input_size
+) {
+    by_code_point<InputCodeUnit> bcp_range{
+        std::basic_string_view<InputCodeUnit>{input, input_size}
+    };
+    static_cast<void>(static_cast<char32_t>(*bcp_range.cbegin()));
+    throw invalid_code_point{};
+} // function -----------------------------------------------------------------
+
+// Free Functions -------------------------------------------------------------
+
+template <
+    typename OutputCodeUnit,
+    typename InputCodeUnit
+>
+std::size_t
+measure_transcoding (
+    const InputCodeUnit* input,
+    std::size_t input_size
+) {
+    static_assert(
+        is_transcodable_unit_v<InputCodeUnit>
+            && is_transcodable_unit_v<OutputCodeUnit>
+    );
+
+    using input_form = encoding_form_unit_t<InputCodeUnit>;
+    using output_form = encoding_form_unit_t<OutputCodeUnit>;
+
+    std::size_t output_size{0};
+    if constexpr (std::is_same_v<input_form, char8_t>) {
+        std::size_t offset{find_invalid_utf8(input, input_size)};
+        if (offset != input_size) {
+            throw_transcoding_error(input + offset, input_size - offset);
+        }
+
+        if constexpr (std::is_same_v<output_form, char8_t>) {
+            if (find_encoded_surrogate(input, input_size) != input_size) {
+                throw invalid_code_point{};
+            }
+            output_size = input_size;
+        } else {
+            /*
+                This goes eight bytes at a time, where a byte is a trailing
+                byte when its top two bits are 10 and leads a sequence that
+                takes two UTF-16 code units when its top four bits are set.
+            */
+            constexpr std::uint64_t top_bits{0x8080'8080'8080'8080};
+
+            std::size_t trailing_count{0};
+            std::size_t pair_count{0};
+            std::size_t i{0};
+            for (; i + sizeof (std::uint64_t) <= input_size;
+                   i += sizeof (std::uint64_t)) {
+                std::uint64_t word;
+                std::memcpy(&word, input + i, sizeof word);
+                if ((word & top_bits) == 0) {
+                    continue;
+                }
+                trailing_count += static_cast<std::size_t>(
+                    std::popcount(word & ~(word << 1) & top_bits)
+                );
+                if constexpr (std::is_same_v<output_form, char16_t>) {
+                    pair_count += static_cast<std::size_t>(std::popcount(
+                        word & (word << 1) & (word << 2) & (word << 3)
+                            & top_bits
+                    ));
+                }
+            }
+            for (; i < input_size; ++i) {
+                char8_t code_unit{input[i]};
+                trailing_count += is_trailing_byte(code_unit);
+                if constexpr (std::is_same_v<output_form, char16_t>) {
+                    pair_count += code_unit >= 0b1111'0000;
+                }
+            }
+            output_size = input_size - trailing_count + pair_count;
+        }
+    } else if constexpr (std::is_same_v<input_form, char16_t>) {
+        std::size_t offset;
+        if constexpr (std::is_same_v<InputCodeUnit, char16_t>) {
+            offset = find_invalid_utf16(input, input_size);
+        } else {
+            offset = 0;
+            while (offset < input_size) {
+                auto code_unit{static_cast<char16_t>(input[offset])};
+                if (is_leading_surrogate(code_unit)) {
+                    if (
+                        offset + 1 == input_size
+                            || !is_trailing_surrogate(
+                                   static_cast<char16_t>(input[offset + 1])
+                               )
+                    ) {
+                        break;
+                    }
+                    offset += 2;
+                } else if (is_trailing_surrogate(code_unit)) {
+                    break;
+                } else {
+                    ++offset;
+                }
+            }
+        }
+        if (offset != input_size) {
+            throw_transcoding_error(input + offset, input_size - offset);
+        }
+
+        if constexpr (std::is_same_v<output_form, char8_t>) {
+            /*
+                A surrogate pair takes up four bytes, two for each half.
+                This is written without branches so that it vectorizes.
+            */
+            for (std::size_t i{0}; i < input_size; ++i) {
+                auto code_unit{static_cast<char16_t>(input[i])};
+                output_size += 1u
+                    + (code_unit >= 0x80)
+                    + (code_unit >= 0x800 && (code_unit & 0xF800) != 0xD800);
+            }
+        } else if constexpr (std::is_same_v<output_form, char16_t>) {
+            output_size = input_size;
+        } else {
+            for (std::size_t i{0}; i < input_size; ++i) {
+                output_size += !is_trailing_surrogate(
+                    static_cast<char16_t>(input[i])
+                );
+            }
+        }
+    } else {
+        if constexpr (std::is_same_v<output_form, char8_t>) {
+            for (std::size_t i{0}; i < input_size; ++i) {
+                auto code_point{static_cast<char32_t>(input[i])};
+                if (!is_code_point_valid(code_point)) {
+                    throw invalid_code_point{};
+                }
+                output_size += code_point < 0x80 ? 1
+                    : code_point < 0x800 ? 2
+                    : code_point < 0x10000 ? 3
+                    : 4;
+            }
+        } else if constexpr (std::is_same_v<output_form, char16_t>) {
+            for (std::size_t i{0}; i < input_size; ++i) {
+                auto code_point{static_cast<char32_t>(input[i])};
+                if (code_point > maximum_code_point) {
+                    throw invalid_code_point{};
+                }
+                output_size += code_point < 0x10000 ? 1 : 2;
+            }
+        } else {
+            output_size = input_size;
+        }
+    }
+    return output_size;
+} // function -----------------------------------------------------------------
+
+template <
+    typename OutputCodeUnit,
+    typename InputCodeUnit
+>
+void
+transcode_unchecked (
+    const InputCodeUnit* input,
+    std::size_t input_size,
+    OutputCodeUnit* output
+)
+noexcept {
+    using input_form = encoding_form_unit_t<InputCodeUnit>;
+    using output_form = encoding_form_unit_t<OutputCodeUnit>;
+
+    if constexpr (std::is_same_v<input_form, output_form>) {
+        if (input_size > 0) {
+            std::memcpy(output, input, input_size * sizeof (InputCodeUnit));
+        }
+    } else {
+        /*
+            The code units that are transcoded one at a time after each call
+            to the vector kernels, so that text with few runs that they can
+            take doesn't keep calling them for nothing.
+        */
+        constexpr std::size_t scalar_stretch{32};
+
+        std::size_t position{0};
+        while (position < input_size) {
+            if (input_size - position >= scalar_stretch) {
+                std::size_t run_size{transcode_fast_run(
+                    reinterpret_cast<const input_form*>(input + position),
+                    input_size - position,
+                    reinterpret_cast<output_form*>(output)
+                )};
+                position += run_size;
+                output += run_size;
+            }
+
+            std::size_t stretch_end{
+                std::min(input_size, position + scalar_stretch)
+            };
+            while (position < stretch_end) {
+                char32_t code_point;
+                if constexpr (std::is_same_v<input_form, char8_t>) {
+                    char32_t leading_code_unit{input[position]};
+                    if (leading_code_unit < 0b1000'0000) {
+                        code_point = leading_code_unit;
+                        position += 1;
+                    } else if (leading_code_unit < 0b1110'0000) {
+                        code_point = (leading_code_unit & 0b0001'1111) << 6
+                            | (input[position + 1] & 0b0011'1111);
+                        position += 2;
+                    } else if (leading_code_unit < 0b1111'0000) {
+                        code_point = (leading_code_unit & 0b0000'1111) << 12
+                            | (input[position + 1] & 0b0011'1111) << 6
+                            | (input[position + 2] & 0b0011'1111);
+                        position += 3;
+                    } else {
+                        code_point = (leading_code_unit & 0b0000'0111) << 18
+                            | (input[position + 1] & 0b0011'1111) << 12
+                            | (input[position + 2] & 0b0011'1111) << 6
+                            | (input[position + 3] & 0b0011'1111);
+                        position += 4;
+                    }
+                } else if constexpr (std::is_same_v<input_form, char16_t>) {
+                    auto code_unit{static_cast<char16_t>(input[position])};
+                    if (is_leading_surrogate(code_unit)) {
+                        auto trailing_code_unit{
+                            static_cast<char16_t>(input[position + 1])
+                        };
+                        code_point = (
+                                (char32_t{code_unit} - 0xD800) << 10
+                            )
+                            + (char32_t{trailing_code_unit} - 0xDC00)
+                            + 0x10000;
+                        position += 2;
+                    } else {
+                        code_point = code_unit;
+                        position += 1;
+                    }
+                } else {
+                    code_point = static_cast<char32_t>(input[position]);
+                    position += 1;
+                }
+
+                if constexpr (std::is_same_v<output_form, char8_t>) {
+                    if (code_point < 0x80) {
+                        *output++ = static_cast<OutputCodeUnit>(code_point);
+                    } else if (code_point < 0x800) {
+                        *output++ = static_cast<OutputCodeUnit>(
+                            (code_point >> 6) | 0b1100'0000
+                        );
+                        *output++ = static_cast<OutputCodeUnit>(
+                            (code_point & 0b0011'1111) | 0b1000'0000
+                        );
+                    } else if (code_point < 0x10000) {
+                        *output++ = static_cast<OutputCodeUnit>(
+                            (code_point >> 12) | 0b1110'0000
+                        );
+                        *output++ = static_cast<OutputCodeUnit>(
+                            ((code_point >> 6) & 0b0011'1111) | 0b1000'0000
+                        );
+                        *output++ = static_cast<OutputCodeUnit>(
+                            (code_point & 0b0011'1111) | 0b1000'0000
+                        );
+                    } else {
+                        *output++ = static_cast<OutputCodeUnit>(
+                            (code_point >> 18) | 0b1111'0000
+                        );
+                        *output++ = static_cast<OutputCodeUnit>(
+                            ((code_point >> 12) & 0b0011'1111) | 0b1000'0000
+                        );
+                        *output++ = static_cast<OutputCodeUnit>(
+                            ((code_point >> 6) & 0b0011'1111) | 0b1000'0000
+                        );
+                        *output++ = static_cast<OutputCodeUnit>(
+                            (code_point & 0b0011'1111) | 0b1000'0000
+                        );
+                    }
+                } else if constexpr (std::is_same_v<output_form, char16_t>) {
+                    if (code_point < 0x10000) {
+                        *output++ = static_cast<OutputCodeUnit>(code_point);
+                    } else {
+                        code_point -= 0x10000;
+                        *output++ = static_cast<OutputCodeUnit>(
+                            (code_point >> 10)
+                                + leading_surrogate_minimum_value
+                        );
+                        *output++ = static_cast<OutputCodeUnit>(
+                            (code_point & 0b0011'1111'1111)
+                                + trailing_surrogate_minimum_value
+                        );
+                    }
+                } else {
+                    *output++ = static_cast<OutputCodeUnit>(code_point);
+                }
+            }
+        }
+    }
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
@@ -0,0 +1,557 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cstdint>
+#include <cstring>
+
+#include <cmp/unicode/examiners.hpp>
+#include <cmp/unicode/impl/validation.hpp>
+
+#if defined(CMP_ARCHITECTURE_X86)
+#   include <immintrin.h>
+#   if defined(CMP_COMPILER_MSVC)
+#       include <intrin.h>
+#   endif
+#endif // CMP_ARCHITECTURE_X86
+
+namespace cmp {
+
+namespace impl {
+
+// Private Data ---------------------------------------------------------------
+
+/*
+    The flags of the UTF-8 lookup tables, after "Validating UTF-8 In
+    Less Than One Instruction Per Byte" by Keiser and Lemire. Each table
+    is indexed by a nibble of a pair of adjacent bytes, and a pair is
+    invalid when the three looked up values share a flag. The flags for
+    overlong sequences and surrogates are left out, since by_code_point
+    accepts those.
+*/
+inline constexpr std::uint8_t utf8_too_short{1 << 0};
+inline constexpr std::uint8_t utf8_too_long{1 << 1};
+inline constexpr std::uint8_t utf8_too_large{1 << 3};
+inline constexpr std::uint8_t utf8_too_large_1000{1 << 6};
+inline constexpr std::uint8_t utf8_two_continuations{1 << 7};
+inline constexpr std::uint8_t utf8_carry{
+    utf8_too_short | utf8_too_long | utf8_two_continuations
+};
+
+inline constexpr std::uint8_t utf8_byte_1_high_table[16] = {
+    utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+    utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+    utf8_two_continuations, utf8_two_continuations,
+    utf8_two_continuations, utf8_two_continuations,
+    utf8_too_short, utf8_too_short, utf8_too_short,
+    utf8_too_short | utf8_too_large | utf8_too_large_1000
+};
+
+inline constexpr std::uint8_t utf8_byte_1_low_table[16] = {
+    utf8_carry, utf8_carry, utf8_carry, utf8_carry,
+    utf8_carry | utf8_too_large,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000
+};
+
+inline constexpr std::uint8_t utf8_byte_2_high_table[16] = {
+    utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+    utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+    utf8_too_long | utf8_two_continuations | utf8_too_large_1000,
+    utf8_too_long | utf8_two_continuations | utf8_too_large,
+    utf8_too_long | utf8_two_continuations | utf8_too_large,
+    utf8_too_long | utf8_two_continuations | utf8_too_large,
+    utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short
+};
+
+// Free Functions -------------------------------------------------------------
+
+std::size_t
+find_invalid_utf8 (
+    const char8_t* data,
+    std::size_t size
+)
+noexcept {
+    using kernel_type = std::size_t (*)(const char8_t*, std::size_t) noexcept;
+    static const kernel_type kernel{[] () noexcept -> kernel_type {
+#if defined(CMP_ARCHITECTURE_X86)
+        if (is_avx2_supported()) {
+            return &find_invalid_utf8_avx2;
+        } else if (is_sse4_supported()) {
+            return &find_invalid_utf8_sse4;
+        }
+#endif // CMP_ARCHITECTURE_X86
+        return &find_invalid_utf8_scalar;
+    }()};
+    return kernel(data, size);
+} // function -----------------------------------------------------------------
+
+std::size_t
+find_invalid_utf16 (
+    const char16_t* data,
+    std::size_t size
+)
+noexcept {
+    using kernel_type = std::size_t (*)(const char16_t*, std::size_t) noexcept;
+    static const kernel_type kernel{[] () noexcept -> kernel_type {
+#if defined(CMP_ARCHITECTURE_X86)
+        if (is_avx2_supported()) {
+            return &find_invalid_utf16_avx2;
+        } else if (is_sse4_supported()) {
+            return &find_invalid_utf16_sse4;
+        }
+#endif // CMP_ARCHITECTURE_X86
+        return &find_invalid_utf16_scalar;
+    }()};
+    return kernel(data, size);
+} // function -----------------------------------------------------------------
+
+std::size_t
+find_invalid_utf8_scalar (
+    const char8_t* data,
+    std::size_t size
+)
+noexcept {
+    /*
+        Runs of ASCII are skipped eight bytes at a time, which matters for
+        the short stretches left over by the vector kernels.
+    */
+    constexpr std::uint64_t high_bits{0x8080'8080'8080'8080};
+
+    std::size_t position{0};
+    while (position < size) {
+        if (size - position >= sizeof (std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, data + position, sizeof word);
+            if ((word & high_bits) == 0) {
+                position += sizeof (std::uint64_t);
+                continue;
+            }
+        }
+        char8_t leading_code_unit{data[position]};
+        if (leading_code_unit < 0x80) {
+            ++position;
+            continue;
+        }
+
+        std::size_t sequence_length;
+        char32_t code_point;
+        if ((leading_code_unit >> 5) == 0b110) {
+            sequence_length = 2;
+            code_point = leading_code_unit & 0b0001'1111;
+        } else if ((leading_code_unit >> 4) == 0b1110) {
+            sequence_length = 3;
+            code_point = leading_code_unit & 0b0000'1111;
+        } else if ((leading_code_unit >> 3) == 0b11110) {
+            sequence_length = 4;
+            code_point = leading_code_unit & 0b0000'0111;
+        } else {
+            return position;
+        }
+
+        if (sequence_length > size - position) {
+            return position;
+        }
+        for (std::size_t i{1}; i < sequence_length; ++i) {
+            char8_t code_unit{data[position + i]};
+            if (!is_trailing_byte(code_unit)) {
+                return position;
+            }
+            code_point = (code_point << 6) | (code_unit & 0b0011'1111);
+        }
+        if (code_point > 0x10FFFF) {
+            return position;
+        }
+        position += sequence_length;
+    }
+    return size;
+} // function -----------------------------------------------------------------
+
+std::size_t
+find_invalid_utf16_scalar (
+    const char16_t* data,
+    std::size_t size
+)
+noexcept {
+    std::size_t position{0};
+    while (position < size) {
+        char16_t code_unit{data[position]};
+        if (is_leading_surrogate(code_unit)) {
+            if (
+                position + 1 == size
+                || !is_trailing_surrogate(data[position + 1])
+            ) {
+                return position;
+            }
+            position += 2;
+        } else if (is_trailing_surrogate(code_unit)) {
+            return position;
+        } else {
+            ++position;
+        }
+    }
+    return size;
+} // function -----------------------------------------------------------------
+
+std::size_t
+find_invalid_utf8_from_block (
+    const char8_t* data,
+    std::size_t size,
+    std::size_t block_position
+)
+noexcept {
+    std::size_t position{block_position < 3 ? 0 : block_position - 3};
+    while (position < block_position && is_trailing_byte(data[position])) {
+        ++position;
+    }
+    return position
+        + find_invalid_utf8_scalar(data + position, size - position);
+} // function -----------------------------------------------------------------
+
+std::size_t
+find_invalid_utf16_from_block (
+    const char16_t* data,
+    std::size_t size,
+    std::size_t block_position
+)
+noexcept {
+    std::size_t position{block_position};
+    if (position > 0 && is_leading_surrogate(data[position - 1])) {
+        ++position;
+    }
+    return position
+        + find_invalid_utf16_scalar(data + position, size - position);
+} // function -----------------------------------------------------------------
+
+#if defined(CMP_ARCHITECTURE_X86)
+
+bool
+is_sse4_supported ()
+noexcept {
+#if defined(CMP_COMPILER_MSVC)
+    int registers[4];
+    __cpuid(registers, 1);
+    return (registers[2] & (1 << 19)) != 0;
+#else
+    return __builtin_cpu_supports("sse4.1");
+#endif // CMP_COMPILER_MSVC
+} // function -----------------------------------------------------------------
+
+bool
+is_avx2_supported ()
+noexcept {
+#if defined(CMP_COMPILER_MSVC)
+    int registers[4];
+    __cpuid(registers, 0);
+    if (registers[0] < 7) {
+        return false;
+    }
+    __cpuid(registers, 1);
+    bool saves_vector_state{(registers[2] & (1 << 27)) != 0};
+    bool has_avx{(registers[2] & (1 << 28)) != 0};
+    if (!saves_vector_state || !has_avx || (_xgetbv(0) & 0b110) != 0b110) {
+        return false;
+    }
+    __cpuidex(registers, 7, 0);
+    return (registers[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif // CMP_COMPILER_MSVC
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+find_invalid_utf8_sse4 (
+    const char8_t* data,
+    std::size_t size
+)
+noexcept {
+    const __m128i byte_1_high_table{
+        _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(utf8_byte_1_high_table)
+        )
+    };
+    const __m128i byte_1_low_table{
+        _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(utf8_byte_1_low_table)
+        )
+    };
+    const __m128i byte_2_high_table{
+        _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(utf8_byte_2_high_table)
+        )
+    };
+    const __m128i low_nibble_mask{_mm_set1_epi8(0x0F)};
+    const __m128i third_byte_threshold{_mm_set1_epi8(0xE0 - 0x80)};
+    const __m128i fourth_byte_threshold{_mm_set1_epi8(0xF0 - 0x80)};
+    const __m128i high_bit{_mm_set1_epi8(static_cast<char>(0x80))};
+    const __m128i incomplete_threshold{_mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1),
+        static_cast<char>(0xE0 - 1),
+        static_cast<char>(0xC0 - 1)
+    )};
+
+    __m128i previous_input{_mm_setzero_si128()};
+    __m128i previous_incomplete{_mm_setzero_si128()};
+    std::size_t position{0};
+    for (; size - position >= 16; position += 16) {
+        __m128i input{_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + position)
+        )};
+        if (_mm_movemask_epi8(input) == 0) {
+            if (!_mm_testz_si128(previous_incomplete, previous_incomplete)) {
+                break;
+            }
+            previous_input = input;
+            continue;
+        }
+
+        __m128i previous_1{_mm_alignr_epi8(input, previous_input, 15)};
+        __m128i special_cases{_mm_and_si128(
+            _mm_and_si128(
+                _mm_shuffle_epi8(
+                    byte_1_high_table,
+                    _mm_and_si128(
+                        _mm_srli_epi16(previous_1, 4),
+                        low_nibble_mask
+                    )
+                ),
+                _mm_shuffle_epi8(
+                    byte_1_low_table,
+                    _mm_and_si128(previous_1, low_nibble_mask)
+                )
+            ),
+            _mm_shuffle_epi8(
+                byte_2_high_table,
+                _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble_mask)
+            )
+        )};
+
+        __m128i previous_2{_mm_alignr_epi8(input, previous_input, 14)};
+        __m128i previous_3{_mm_alignr_epi8(input, previous_input, 13)};
+        __m128i must_be_continuation{_mm_and_si128(
+            _mm_or_si128(
+                _mm_subs_epu8(previous_2, third_byte_threshold),
+                _mm_subs_epu8(previous_3, fourth_byte_threshold)
+            ),
+            high_bit
+        )};
+
+        __m128i error{_mm_xor_si128(must_be_continuation, special_cases)};
+        if (!_mm_testz_si128(error, error)) {
+            break;
+        }
+        previous_incomplete = _mm_subs_epu8(input, incomplete_threshold);
+        previous_input = input;
+    }
+    return find_invalid_utf8_from_block(data, size, position);
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+find_invalid_utf8_avx2 (
+    const char8_t* data,
+    std::size_t size
+)
+noexcept {
+    const __m256i byte_1_high_table{
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(utf8_byte_1_high_table)
+            )
+        )
+    };
+    const __m256i byte_1_low_table{
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(utf8_byte_1_low_table)
+            )
+        )
+    };
+    const __m256i byte_2_high_table{
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(utf8_byte_2_high_table)
+            )
+        )
+    };
+    const __m256i low_nibble_mask{_mm256_set1_epi8(0x0F)};
+    const __m256i third_byte_threshold{_mm256_set1_epi8(0xE0 - 0x80)};
+    const __m256i fourth_byte_threshold{_mm256_set1_epi8(0xF0 - 0x80)};
+    const __m256i high_bit{_mm256_set1_epi8(static_cast<char>(0x80))};
+    const __m256i incomplete_threshold{_mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1),
+        static_cast<char>(0xE0 - 1),
+        static_cast<char>(0xC0 - 1)
+    )};
+
+    __m256i previous_input{_mm256_setzero_si256()};
+    __m256i previous_incomplete{_mm256_setzero_si256()};
+    std::size_t position{0};
+    for (; size - position >= 32; position += 32) {
+        __m256i input{_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + position)
+        )};
+        if (_mm256_movemask_epi8(input) == 0) {
+            if (
+                !_mm256_testz_si256(previous_incomplete, previous_incomplete)
+            ) {
+                break;
+            }
+            previous_input = input;
+            continue;
+        }
+
+        /*
+            The previous input's upper half next to the input's lower half,
+            so that shifting across the lanes of the input works like the
+            128-bit version.
+        */
+        __m256i shifted_input{
+            _mm256_permute2x128_si256(previous_input, input, 0x21)
+        };
+        __m256i previous_1{_mm256_alignr_epi8(input, shifted_input, 15)};
+        __m256i special_cases{_mm256_and_si256(
+            _mm256_and_si256(
+                _mm256_shuffle_epi8(
+                    byte_1_high_table,
+                    _mm256_and_si256(
+                        _mm256_srli_epi16(previous_1, 4),
+                        low_nibble_mask
+                    )
+                ),
+                _mm256_shuffle_epi8(
+                    byte_1_low_table,
+                    _mm256_and_si256(previous_1, low_nibble_mask)
+                )
+            ),
+            _mm256_shuffle_epi8(
+                byte_2_high_table,
+                _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble_mask)
+            )
+        )};
+
+        __m256i previous_2{_mm256_alignr_epi8(input, shifted_input, 14)};
+        __m256i previous_3{_mm256_alignr_epi8(input, shifted_input, 13)};
+        __m256i must_be_continuation{_mm256_and_si256(
+            _mm256_or_si256(
+                _mm256_subs_epu8(previous_2, third_byte_threshold),
+                _mm256_subs_epu8(previous_3, fourth_byte_threshold)
+            ),
+            high_bit
+        )};
+
+        __m256i error{_mm256_xor_si256(must_be_continuation, special_cases)};
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+        previous_incomplete = _mm256_subs_epu8(input, incomplete_threshold);
+        previous_input = input;
+    }
+    return find_invalid_utf8_from_block(data, size, position);
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("sse4.1")
+std::size_t
+find_invalid_utf16_sse4 (
+    const char16_t* data,
+    std::size_t size
+)
+noexcept {
+    if (size > 0 && is_trailing_surrogate(data[0])) {
+        return 0;
+    }
+
+    /*
+        Each code unit is compared with the next one: one has to be a high
+        surrogate exactly when the other is a low surrogate.
+    */
+    const __m128i surrogate_mask{_mm_set1_epi16(static_cast<short>(0xFC00))};
+    const __m128i high_surrogate{_mm_set1_epi16(static_cast<short>(0xD800))};
+    const __m128i low_surrogate{_mm_set1_epi16(static_cast<short>(0xDC00))};
+
+    std::size_t position{0};
+    for (; size - position > 8; position += 8) {
+        __m128i current{_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + position)
+        )};
+        __m128i next{_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + position + 1)
+        )};
+        __m128i is_high{_mm_cmpeq_epi16(
+            _mm_and_si128(current, surrogate_mask),
+            high_surrogate
+        )};
+        __m128i is_low{_mm_cmpeq_epi16(
+            _mm_and_si128(next, surrogate_mask),
+            low_surrogate
+        )};
+        __m128i error{_mm_xor_si128(is_high, is_low)};
+        if (!_mm_testz_si128(error, error)) {
+            break;
+        }
+    }
+    return find_invalid_utf16_from_block(data, size, position);
+} // function -----------------------------------------------------------------
+
+CMP_TARGET_ATTRIBUTE("avx2")
+std::size_t
+find_invalid_utf16_avx2 (
+    const char16_t* data,
+    std::size_t size
+)
+noexcept {
+    if (size > 0 && is_trailing_surrogate(data[0])) {
+        return 0;
+    }
+
+    const __m256i surrogate_mask{
+        _mm256_set1_epi16(static_cast<short>(0xFC00))
+    };
+    const __m256i high_surrogate{
+        _mm256_set1_epi16(static_cast<short>(0xD800))
+    };
+    const __m256i low_surrogate{
+        _mm256_set1_epi16(static_cast<short>(0xDC00))
+    };
+
+    std::size_t position{0};
+    for (; size - position > 16; position += 16) {
+        __m256i current{_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + position)
+        )};
+        __m256i next{_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + position + 1)
+        )};
+        __m256i is_high{_mm256_cmpeq_epi16(
+            _mm256_and_si256(current, surrogate_mask),
+            high_surrogate
+        )};
+        __m256i is_low{_mm256_cmpeq_epi16(
+            _mm256_and_si256(next, surrogate_mask),
+            low_surrogate
+        )};
+        __m256i error{_mm256_xor_si256(is_high, is_low)};
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+    }
+    return find_invalid_utf16_from_block(data, size, position);
+} // function -----------------------------------------------------------------
+
+#endif // CMP_ARCHITECTURE_X86
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
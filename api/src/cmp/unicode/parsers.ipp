@@ -13,12 +13,13 @@ namespace impl {
 
 template <
     std::integral Output,
-    text_object Input
+    text_object Input,
+    typename Format
 >
 Output
 number_parser::parse_integer (
     const Input& input,
-    const integer_format& format
+    const Format& format
 ) {
     std::size_t input_size{string_size(input)};
     if (input_size == 0) {
@@ -28,13 +29,55 @@ number_parser::parse_integer (
         };
     }
 
-    by_code_point bcp_range{input};
-    auto bcp_iterator{bcp_range.crbegin()};
-
     const auto format_radix{format.get_radix()};
     const auto format_thousands_separator{format.get_thousands_separator()};
     const auto format_sign_status{format.get_sign_status()};
 
+    /*
+        Plain decimal digits, which is what most input is, are parsed
+        from the code units where they are. Anything else falls through
+        to the code points below.
+    */
+    if (
+        sizeof (Output) <= sizeof (std::uint64_t)
+            && format_radix == 10
+            && format_thousands_separator == thousands_separator::none
+    ) {
+        Output output;
+        bool is_parsed{false};
+        if constexpr (
+            std::is_convertible_v<const Input&, std::u8string_view>
+        ) {
+            is_parsed = parse_decimal_integer<Output, char8_t>(
+                input,
+                format_sign_status,
+                output
+            );
+        } else if constexpr (
+            std::is_convertible_v<const Input&, std::u16string_view>
+        ) {
+            is_parsed = parse_decimal_integer<Output, char16_t>(
+                input,
+                format_sign_status,
+                output
+            );
+        } else if constexpr (
+            std::is_convertible_v<const Input&, std::u32string_view>
+        ) {
+            is_parsed = parse_decimal_integer<Output, char32_t>(
+                input,
+                format_sign_status,
+                output
+            );
+        }
+        if (is_parsed) {
+            return output;
+        }
+    }
+
+    by_code_point bcp_range{input};
+    auto bcp_iterator{bcp_range.crbegin()};
+
     int current_digit{get_next_digit(*bcp_iterator, format_radix)};
     Output output{static_cast<Output>(current_digit)};
 
@@ -109,20 +152,68 @@ number_parser::parse_integer (
 
 template <
     std::floating_point Output,
-    text_object Input
+    text_object Input,
+    typename Format
 >
 Output
 number_parser::parse_floating_point (
     const Input& input,
-    const floating_point_format& format
+    const Format& format
+) {
+    /*
+        The radix character and the digits are all ASCII, so the code
+        units of UTF-8, UTF-16 and UTF-32 text can be looked at where they
+        are.
+    */
+    if constexpr (std::is_convertible_v<const Input&, std::u8string_view>) {
+        return parse_floating_point_code_units<Output, char8_t>(
+            input,
+            format
+        );
+    } else if constexpr (
+        std::is_convertible_v<const Input&, std::u16string_view>
+    ) {
+        return parse_floating_point_code_units<Output, char16_t>(
+            input,
+            format
+        );
+    } else if constexpr (
+        std::is_convertible_v<const Input&, std::u32string_view>
+    ) {
+        return parse_floating_point_code_units<Output, char32_t>(
+            input,
+            format
+        );
+    } else {
+        const std::u32string u32_input{to_u32string(input)};
+        return parse_floating_point_code_units<Output, char32_t>(
+            u32_input,
+            format
+        );
+    }
+} // function -----------------------------------------------------------------
+
+// Private Functions ----------------------------------------------------------
+
+template <
+    std::floating_point Output,
+    typename CodeUnit,
+    typename Format
+>
+Output
+number_parser::parse_floating_point_code_units (
+    std::basic_string_view<CodeUnit> input,
+    const Format& format
 ) {
-    const std::u32string u32_input{to_u32string(input)};
-    const auto format_radix_character{format.get_radix_character()};
     const auto format_radix{format.get_radix()};
+    if (format_radix == 10) {
+        return parse_decimal_floating_point<Output>(input, format);
+    }
+    const auto format_radix_character{format.get_radix_character()};
     auto radix_character_iterator{
         std::find(
-            u32_input.cbegin(),
-            u32_input.cend(),
+            input.cbegin(),
+            input.cend(),
             format_radix_character == radix_character::period
                 ? '.'
                 : ','
@@ -133,27 +224,31 @@ number_parser::parse_floating_point (
         format.get_sign_status(),
         format.get_thousands_separator()
     };
-    if (radix_character_iterator == u32_input.cend()) {
+    if (radix_character_iterator == input.cend()) {
         return number_parser::parse_integer<long long>(
-            u32_input,
+            input,
             equivalent_format
         );
     } else {
-        const auto integral_part_start{u32_input.data()};
+        const auto integral_part_start{input.data()};
         const auto integral_part_size{
-            radix_character_iterator - u32_input.cbegin()
+            radix_character_iterator - input.cbegin()
         };
-        const std::u32string_view integral_part{
+        const std::basic_string_view<CodeUnit> integral_part{
             integral_part_start,
-            static_cast<std::u32string_view::size_type>(integral_part_size)
+            static_cast<std::size_t>(integral_part_size)
         };
         Output output{
             static_cast<Output>(
                 parse_integer<long long>(integral_part, equivalent_format)
             )
         };
+        const bool is_negative{
+            std::find(integral_part.cbegin(), integral_part.cend(), '-')
+                != integral_part.cend()
+        };
         ++radix_character_iterator;
-        if (radix_character_iterator == u32_input.cend()) {
+        if (radix_character_iterator == input.cend()) {
             if (format.get_radix_place_limit() == radix_place_limit::none) {
                 return output;
             } else if (format.get_radix_place_count() > 0) {
@@ -165,9 +260,10 @@ number_parser::parse_floating_point (
             }
         }
         Output root = 1;
-        int current_digit;;
+        Output fractional_part{0};
+        int current_digit;
         unsigned int digits_counted{0};
-        while (radix_character_iterator != u32_input.cend()) {
+        while (radix_character_iterator != input.cend()) {
             current_digit = digit_character_to_integer(
                 *radix_character_iterator,
                 format_radix
@@ -182,18 +278,594 @@ number_parser::parse_floating_point (
                 append_digit(
                     root,
                     format_radix,
-                    output,
+                    fractional_part,
                     current_digit,
                     digits_counted
                 );
             }
             ++radix_character_iterator;
         }
-        return output;
+        return is_negative
+            ? output - fractional_part
+            : output + fractional_part;
     }
 } // function -----------------------------------------------------------------
 
-// Private Functions ----------------------------------------------------------
+template <
+    std::floating_point Output,
+    typename CodeUnit,
+    typename Format
+>
+Output
+number_parser::parse_decimal_floating_point (
+    std::basic_string_view<CodeUnit> input,
+    const Format& format
+) {
+    if (input.empty()) {
+        throw parse_failed{
+            "The input string is empty, there is nothing to parse.",
+            parse_failed::type::empty_input
+        };
+    }
+    const CodeUnit* character{input.data()};
+    const CodeUnit* const end{character + input.size()};
+    bool sign_found{false};
+    bool negate{false};
+    if (*character == '-' || *character == '+') {
+        const auto format_sign_status{format.get_sign_status()};
+        if (
+            check_for_sign(*character, sign_found, negate, format_sign_status)
+        ) {
+            ++character;
+            if (character != end) {
+                check_for_sign(
+                    *character,
+                    sign_found,
+                    negate,
+                    format_sign_status
+                );
+            }
+        }
+    }
+    const CodeUnit* const digits_begin{character};
+
+    /*
+        A thousands separator that is also the radix character is taken
+        for the radix character. In the integral part, thousands
+        separators have to be there between every group of three digits,
+        while in the fractional part, they can be left out.
+    */
+    const char32_t radix_code_unit{
+        format.get_radix_character() == radix_character::period ? U'.' : U','
+    };
+    const auto format_thousands_separator{format.get_thousands_separator()};
+    char32_t separator_code_unit{
+        format_thousands_separator == thousands_separator::comma
+            ? U','
+            : format_thousands_separator == thousands_separator::period
+                ? U'.'
+                : U'\0'
+    };
+    if (separator_code_unit == radix_code_unit) {
+        separator_code_unit = U'\0';
+    }
+    auto report_missing_thousands_separator = [] {
+        throw parse_failed{
+            "The input string did not have a thousands "
+            "separator where one was expected.",
+            parse_failed::type::thousands_separator_missing
+        };
+    };
+
+    /*
+        The digits are read in runs between thousands separators and the
+        radix character. The significand keeps the first 19 significant
+        digits, which always fit in it, and the exponent is that of its
+        last digit.
+    */
+    std::uint64_t significand{0};
+    int kept_digit_count{0};
+    bool is_truncated{false};
+    int exponent{0};
+    bool has_digits{false};
+    bool is_after_radix_character{false};
+    bool has_separators{false};
+    unsigned int fractional_digit_count{0};
+    for (;;) {
+        const CodeUnit* const run_begin{character};
+        if (significand == 0) {
+            while (character != end && *character == '0') {
+                ++character;
+            }
+        }
+        const CodeUnit* const kept_digits_begin{character};
+        const CodeUnit* const kept_digits_end{
+            character + std::min<std::ptrdiff_t>(
+                end - character,
+                19 - kept_digit_count
+            )
+        };
+        for (; character != kept_digits_end; ++character) {
+            auto digit{
+                static_cast<std::uint32_t>(*character) - std::uint32_t{'0'}
+            };
+            if (digit > 9) {
+                break;
+            }
+            significand = significand * 10 + digit;
+        }
+        kept_digit_count += static_cast<int>(character - kept_digits_begin);
+        int run_dropped_digit_count{0};
+        if (character == kept_digits_end) {
+            for (; character != end; ++character) {
+                auto digit{
+                    static_cast<std::uint32_t>(*character)
+                        - std::uint32_t{'0'}
+                };
+                if (digit > 9) {
+                    break;
+                }
+                ++run_dropped_digit_count;
+                if (digit != 0) {
+                    is_truncated = true;
+                }
+            }
+        }
+        auto run_digit_count{static_cast<int>(character - run_begin)};
+        if (run_digit_count != 0) {
+            has_digits = true;
+        }
+        if (is_after_radix_character) {
+            fractional_digit_count += run_digit_count;
+            exponent -= run_digit_count - run_dropped_digit_count;
+        } else {
+            exponent += run_dropped_digit_count;
+        }
+
+        if (
+            character != end
+                && separator_code_unit != 0
+                && *character == separator_code_unit
+        ) {
+            if (
+                run_digit_count == 0
+                    || run_digit_count > 3
+                    || ((has_separators || is_after_radix_character)
+                        && run_digit_count != 3)
+            ) {
+                report_missing_thousands_separator();
+            }
+            has_separators = true;
+            ++character;
+            continue;
+        }
+        if (
+            has_separators
+                ? run_digit_count == 0
+                    || run_digit_count > 3
+                    || (!is_after_radix_character && run_digit_count != 3)
+                : !is_after_radix_character
+                    && separator_code_unit != 0
+                    && run_digit_count > 3
+        ) {
+            report_missing_thousands_separator();
+        }
+        if (
+            character != end
+                && *character == radix_code_unit
+                && !is_after_radix_character
+        ) {
+            is_after_radix_character = true;
+            has_separators = false;
+            ++character;
+            continue;
+        }
+        break;
+    }
+    const CodeUnit* const digits_end{character};
+
+    if (!has_digits) {
+        auto is_rest_of_input = [character, end] (std::string_view word) {
+            if (static_cast<std::size_t>(end - character) != word.size()) {
+                return false;
+            }
+            for (std::size_t i{0}; i < word.size(); ++i) {
+                auto code_unit{static_cast<char32_t>(character[i])};
+                if (code_unit >= 'A' && code_unit <= 'Z') {
+                    code_unit += 'a' - 'A';
+                }
+                if (code_unit != static_cast<char32_t>(word[i])) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        if (
+            character == digits_begin
+                && (is_rest_of_input("inf") || is_rest_of_input("infinity"))
+        ) {
+            return negate
+                ? -std::numeric_limits<Output>::infinity()
+                : std::numeric_limits<Output>::infinity();
+        }
+        if (character == digits_begin && is_rest_of_input("nan")) {
+            return negate
+                ? -std::numeric_limits<Output>::quiet_NaN()
+                : std::numeric_limits<Output>::quiet_NaN();
+        }
+        report_non_digit_character();
+    }
+
+    if (character != end && (*character == 'e' || *character == 'E')) {
+        ++character;
+        bool is_exponent_negative{false};
+        if (character != end && (*character == '+' || *character == '-')) {
+            is_exponent_negative = *character == '-';
+            ++character;
+        }
+        if (character == end) {
+            report_non_digit_character();
+        }
+        int written_exponent{0};
+        for (; character != end; ++character) {
+            auto digit{
+                static_cast<std::uint32_t>(*character) - std::uint32_t{'0'}
+            };
+            if (digit > 9) {
+                report_non_digit_character();
+            }
+            /*
+                Exponents this large already make any value zero or
+                infinity, so the rest of the digits don't matter.
+            */
+            if (written_exponent < 100000) {
+                written_exponent = written_exponent * 10
+                    + static_cast<int>(digit);
+            }
+        }
+        exponent += is_exponent_negative
+            ? -written_exponent
+            : written_exponent;
+    }
+    if (character != end) {
+        report_non_digit_character();
+    }
+
+    const auto format_radix_place_limit{format.get_radix_place_limit()};
+    const auto format_radix_place_count{format.get_radix_place_count()};
+    if (
+        (format_radix_place_limit == radix_place_limit::up_to
+            && fractional_digit_count > format_radix_place_count)
+        || (format_radix_place_limit == radix_place_limit::exactly_equal
+            && fractional_digit_count != format_radix_place_count)
+    ) {
+        throw parse_failed{
+            "The input string didn't have as many places after "
+            "the radix point as the radix place limit allows.",
+            parse_failed::type::wrong_place_limit
+        };
+    }
+
+    Output output{0};
+    if (significand == 0) {
+        return negate ? -output : output;
+    }
+    if constexpr (
+        std::numeric_limits<Output>::digits
+            > std::numeric_limits<double>::digits
+    ) {
+        /*
+            Wider types, like the long double of x87, are left to
+            std::from_chars, with the digits and the exponent written out
+            plainly.
+        */
+        std::string text;
+        for (
+            const CodeUnit* digit{digits_begin};
+            digit != digits_end;
+            ++digit
+        ) {
+            if (
+                *digit >= '0'
+                    && *digit <= '9'
+                    && (!text.empty() || *digit != '0')
+            ) {
+                text += static_cast<char>(*digit);
+            }
+        }
+        int last_digit_exponent{
+            exponent + kept_digit_count - static_cast<int>(text.size())
+        };
+        text += 'e';
+        text += std::to_string(last_digit_exponent);
+        auto [pointer, error]{
+            std::from_chars(text.data(), text.data() + text.size(), output)
+        };
+        if (error == std::errc::result_out_of_range) {
+            output = exponent + kept_digit_count > 0
+                ? std::numeric_limits<Output>::infinity()
+                : 0;
+        }
+    } else {
+        output = to_nearest<Output>(significand, exponent);
+        if (
+            is_truncated
+                && output != to_nearest<Output>(significand + 1, exponent)
+        ) {
+            /*
+                The digits past the significand put the value somewhere
+                between the two candidates, so all of them are compared
+                with the value halfway between the lower one and the next
+                one up, which is the higher one.
+            */
+            char digits[max_compared_digit_count];
+            bool has_nonzero_digits_after{false};
+            int digit_count{
+                collect_digits(
+                    digits_begin,
+                    digits_end,
+                    digits,
+                    has_nonzero_digits_after
+                )
+            };
+            constexpr int binary_digit_count{
+                std::numeric_limits<Output>::digits
+            };
+            constexpr int lowest_binary_exponent{
+                std::numeric_limits<Output>::min_exponent - binary_digit_count
+            };
+            int binary_exponent{lowest_binary_exponent};
+            if (output != 0) {
+                std::frexp(output, &binary_exponent);
+                binary_exponent = std::max(
+                    binary_exponent - binary_digit_count,
+                    lowest_binary_exponent
+                );
+            }
+            auto binary_significand{
+                static_cast<std::uint64_t>(
+                    std::ldexp(output, -binary_exponent)
+                )
+            };
+            int comparison{
+                compare_with_halfway(
+                    std::string_view{
+                        digits,
+                        static_cast<std::size_t>(digit_count)
+                    },
+                    has_nonzero_digits_after,
+                    exponent + kept_digit_count - digit_count,
+                    binary_significand,
+                    binary_exponent
+                )
+            };
+            if (
+                comparison > 0
+                    || (comparison == 0 && (binary_significand & 1) != 0)
+            ) {
+                output = std::nextafter(
+                    output,
+                    std::numeric_limits<Output>::infinity()
+                );
+            }
+        }
+    }
+    return negate ? -output : output;
+} // function -----------------------------------------------------------------
+
+template <
+    typename CodeUnit
+>
+int
+number_parser::collect_digits (
+    const CodeUnit* begin,
+    const CodeUnit* end,
+    char* digits,
+    bool& has_nonzero_digits_after
+)
+noexcept
+{
+    int digit_count{0};
+    for (; begin != end; ++begin) {
+        if (
+            *begin < '0'
+                || *begin > '9'
+                || (digit_count == 0 && *begin == '0')
+        ) {
+            continue;
+        }
+        if (digit_count < max_compared_digit_count) {
+            digits[digit_count++] = static_cast<char>(*begin);
+        } else if (*begin != '0') {
+            has_nonzero_digits_after = true;
+            break;
+        }
+    }
+    return digit_count;
+} // function -----------------------------------------------------------------
+
+template <
+    std::floating_point Output
+>
+Output
+number_parser::to_nearest (
+    std::uint64_t decimal_significand,
+    int decimal_exponent
+)
+noexcept
+{
+    if constexpr (
+        std::numeric_limits<Output>::digits
+            <= std::numeric_limits<float>::digits
+    ) {
+        return static_cast<Output>(
+            to_nearest_float(decimal_significand, decimal_exponent)
+        );
+    } else {
+        return static_cast<Output>(
+            to_nearest_double(decimal_significand, decimal_exponent)
+        );
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    std::integral Output,
+    typename CodeUnit
+>
+bool
+number_parser::parse_decimal_integer (
+    std::basic_string_view<CodeUnit> input,
+    sign_status format_sign_status,
+    Output& output
+) {
+    const CodeUnit* character{input.data()};
+    const CodeUnit* const end{character + input.size()};
+
+    bool negate{false};
+    if (*character == '-') {
+        negate = true;
+        ++character;
+    } else if (
+        *character == '+'
+            && format_sign_status == sign_status::always_show
+    ) {
+        ++character;
+    }
+    if (character == end) {
+        return false;
+    }
+    while (character != end && *character == '0') {
+        ++character;
+    }
+
+    /*
+        Up to 19 digits always fit in 64 bits, so only a 20th one needs
+        to be checked for overflow, and any more than that overflow.
+    */
+    std::uint64_t magnitude{0};
+    const CodeUnit* const unchecked_end{
+        character + std::min<std::ptrdiff_t>(end - character, 19)
+    };
+    if constexpr (
+        std::is_same_v<CodeUnit, char8_t>
+            && std::endian::native == std::endian::little
+    ) {
+        while (unchecked_end - character >= 8) {
+            std::uint64_t word;
+            std::memcpy(&word, character, sizeof word);
+            if (!is_made_of_eight_digits(word)) {
+                break;
+            }
+            magnitude = magnitude * 100'000'000 + parse_eight_digits(word);
+            character += 8;
+        }
+    }
+    for (; character != unchecked_end; ++character) {
+        auto digit{
+            static_cast<std::uint32_t>(*character) - std::uint32_t{'0'}
+        };
+        if (digit > 9) {
+            return false;
+        }
+        magnitude = magnitude * 10 + digit;
+    }
+
+    bool is_out_of_range{false};
+    if (character != end) {
+        for (const CodeUnit* c{character}; c != end; ++c) {
+            if (static_cast<std::uint32_t>(*c) - std::uint32_t{'0'} > 9) {
+                return false;
+            }
+        }
+        const auto digit{
+            static_cast<std::uint32_t>(*character) - std::uint32_t{'0'}
+        };
+        constexpr auto max_magnitude{
+            std::numeric_limits<std::uint64_t>::max()
+        };
+        if (end - character > 1 || magnitude > (max_magnitude - digit) / 10) {
+            is_out_of_range = true;
+        } else {
+            magnitude = magnitude * 10 + digit;
+        }
+    }
+
+    if (negate) {
+        if constexpr (std::is_signed_v<Output>) {
+            using unsigned_output = std::make_unsigned_t<Output>;
+            constexpr std::uint64_t max_negative_magnitude{
+                static_cast<unsigned_output>(
+                    std::numeric_limits<Output>::max()
+                ) + std::uint64_t{1}
+            };
+            if (is_out_of_range || magnitude > max_negative_magnitude) {
+                is_out_of_range = true;
+            } else {
+                output = static_cast<Output>(
+                    static_cast<unsigned_output>(0 - magnitude)
+                );
+            }
+        } else {
+            throw parse_failed{
+                "The input string contains a negative "
+                "sign but the output type is unsigned.",
+                parse_failed::type::negative_unsigned
+            };
+        }
+    } else if (
+        is_out_of_range
+            || magnitude > static_cast<std::uint64_t>(
+                std::numeric_limits<Output>::max()
+            )
+    ) {
+        is_out_of_range = true;
+    } else {
+        output = static_cast<Output>(magnitude);
+    }
+    if (is_out_of_range) {
+        throw parse_failed{
+            "The input string holds a value that doesn't "
+            "fit in the output type.",
+            parse_failed::type::out_of_range
+        };
+    }
+    return true;
+} // function -----------------------------------------------------------------
+
+constexpr
+bool
+number_parser::is_made_of_eight_digits (
+    std::uint64_t word
+)
+noexcept
+{
+    /*
+        A byte is a digit when its top four bits are 0011 and adding six
+        to it doesn't carry into them.
+    */
+    constexpr std::uint64_t top_halves{0xF0F0'F0F0'F0F0'F0F0};
+    return (
+        (word & top_halves)
+            | (((word + 0x0606'0606'0606'0606) & top_halves) >> 4)
+    ) == 0x3333'3333'3333'3333;
+} // function -----------------------------------------------------------------
+
+constexpr
+std::uint32_t
+number_parser::parse_eight_digits (
+    std::uint64_t word
+)
+noexcept
+{
+    constexpr std::uint64_t low_bytes_of_halves{0x0000'00FF'0000'00FF};
+    word -= 0x3030'3030'3030'3030;
+    word = word * 10 + (word >> 8);
+    word = (
+        (word & low_bytes_of_halves) * (100 + (1'000'000ULL << 32))
+            + ((word >> 16) & low_bytes_of_halves) * (1 + (10'000ULL << 32))
+    ) >> 32;
+    return static_cast<std::uint32_t>(word);
+} // function -----------------------------------------------------------------
 
 template <
     std::integral Output
@@ -285,6 +957,21 @@ parse_integer (
     return impl::number_parser::parse_integer<Output>(input, format);
 } // function -----------------------------------------------------------------
 
+template <
+    std::integral Output,
+    integer_format Format,
+    text_object Input
+>
+Output
+parse_integer (
+    const Input& input
+) {
+    return impl::number_parser::parse_integer<Output>(
+        input,
+        impl::constant_integer_format<Format>{}
+    );
+} // function -----------------------------------------------------------------
+
 template <
     std::floating_point Output,
     text_object Input
@@ -297,4 +984,19 @@ parse_floating_point (
     return impl::number_parser::parse_floating_point<Output>(input, format);
 } // function -----------------------------------------------------------------
 
+template <
+    std::floating_point Output,
+    floating_point_format Format,
+    text_object Input
+>
+Output
+parse_floating_point (
+    const Input& input
+) {
+    return impl::number_parser::parse_floating_point<Output>(
+        input,
+        impl::constant_floating_point_format<Format>{}
+    );
+} // function -----------------------------------------------------------------
+
 } // namespace ----------------------------------------------------------------
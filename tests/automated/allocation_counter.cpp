@@ -0,0 +1,43 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counter.hpp"
+
+namespace cmp {
+
+std::size_t allocation_count{0};
+
+} // namespace ----------------------------------------------------------------
+
+void*
+operator new (
+    std::size_t size
+) {
+    ++cmp::allocation_count;
+    if (void* p{std::malloc(size == 0 ? 1 : size)}) {
+        return p;
+    }
+    throw std::bad_alloc{};
+} // function -----------------------------------------------------------------
+
+void
+operator delete (
+    void* p
+)
+noexcept
+{
+    std::free(p);
+} // function -----------------------------------------------------------------
+
+void
+operator delete (
+    void* p,
+    std::size_t
+)
+noexcept
+{
+    ::operator delete(p);
+} // function -----------------------------------------------------------------
@@ -0,0 +1,21 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_TESTS_ALLOCATION_COUNTER_HPP_INCLUDED
+#define CMP_TESTS_ALLOCATION_COUNTER_HPP_INCLUDED
+
+#include <cstddef>
+
+namespace cmp {
+
+/*
+    The number of allocations made through the global operator new so far.
+    Linking allocation_counter.cpp into a test replaces the global
+    allocation functions with counting ones, so that the test can tell
+    whether an operation allocates.
+*/
+extern std::size_t allocation_count;
+
+} // namespace ----------------------------------------------------------------
+
+#endif // CMP_TESTS_ALLOCATION_COUNTER_HPP_INCLUDED
@@ -0,0 +1,342 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <coroutine>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <cmp/core/test_module.hpp>
+#include <cmp/io/async_file.hpp>
+
+#if defined(CMP_OS_LINUX_BASED)
+
+namespace cmp {
+
+/*
+    A minimal coroutine type that starts running right away and
+    destroys itself when it finishes, which is all the tests need.
+*/
+struct detached_task {
+    struct promise_type {
+        detached_task
+        get_return_object ()
+        noexcept
+        {
+            return {};
+        } // function ---------------------------------------------------------
+
+        std::suspend_never
+        initial_suspend ()
+        noexcept
+        {
+            return {};
+        } // function ---------------------------------------------------------
+
+        std::suspend_never
+        final_suspend ()
+        noexcept
+        {
+            return {};
+        } // function ---------------------------------------------------------
+
+        void
+        return_void ()
+        noexcept
+        {
+        } // function ---------------------------------------------------------
+
+        void
+        unhandled_exception ()
+        noexcept
+        {
+        } // function ---------------------------------------------------------
+    }; // struct --------------------------------------------------------------
+}; // struct ------------------------------------------------------------------
+
+class async_file_test_module
+    : public test_module<async_file_test_module>
+{
+public:
+    async_file_test_module ()
+    noexcept
+        : test_module({
+              &async_file_test_module
+                  :: test_callbacks,
+
+              &async_file_test_module
+                  :: test_coroutines,
+
+              &async_file_test_module
+                  :: test_slots,
+
+              &async_file_test_module
+                  :: test_errors
+          })
+    {
+    } // function -------------------------------------------------------------
+
+    // Test Tooling -----------------------------------------------------------
+
+    static constexpr const char* source_path{
+        "../../test_data/test_async_source.txt"
+    };
+
+    static constexpr const char* copy_path{
+        "../../test_data/test_async_copy.txt"
+    };
+
+    static constexpr std::size_t chunk_size{4096};
+    static constexpr std::size_t chunk_count{16};
+
+    static
+    std::string
+    make_content ()
+    {
+        std::string content(chunk_size * chunk_count, '\0');
+        for (std::size_t i{0}; i < content.size(); ++i) {
+            content[i] = static_cast<char>('a' + (i * 7 + i / 13) % 26);
+        }
+        return content;
+    } // function -------------------------------------------------------------
+
+    static
+    void
+    create_source ()
+    {
+        std::string content{make_content()};
+        std::ofstream ofstream{source_path, std::ios::binary};
+        ofstream.write(content.data(), content.size());
+    } // function -------------------------------------------------------------
+
+    static
+    std::string
+    read_whole_file (
+        const char* path
+    ) {
+        std::ifstream ifstream{path, std::ios::binary};
+        return {
+            std::istreambuf_iterator<char>{ifstream},
+            std::istreambuf_iterator<char>{}
+        };
+    } // function -------------------------------------------------------------
+
+    static
+    detached_task
+    copy_file (
+        async_file& source,
+        async_file& destination,
+        bool& finished
+    ) {
+        std::vector<std::byte> chunk(chunk_size - 1);
+        while (true) {
+            std::size_t bytes_read{co_await source.read_async(chunk)};
+            if (bytes_read == 0) {
+                break;
+            }
+            co_await destination.write_async(
+                std::span{chunk}.first(bytes_read)
+            );
+        }
+        finished = true;
+    } // function -------------------------------------------------------------
+
+    // Tests ------------------------------------------------------------------
+
+    bool
+    test_callbacks ()
+    {
+        start_test("test_callbacks");
+
+        create_source();
+        io_ring ring{8};
+        async_file f{ring, source_path, read_only, if_not_there::fail};
+        if (!f.is_open()) {
+            std::cout << "File test_async_source.txt could "
+                         "not be opened for reading."
+                      << std::endl;
+
+            return false;
+        }
+
+        /*
+            There are more reads than the ring can have in flight,
+            so queuing them has to process some completions.
+        */
+        std::vector<std::string> chunks(chunk_count);
+        std::size_t completed_count{0};
+        for (auto& chunk : chunks) {
+            chunk.resize(chunk_size);
+            f.read(
+                std::as_writable_bytes(std::span{chunk}),
+                [&chunk, &completed_count] (std::int64_t result) {
+                    chunk.resize(result > 0 ? result : 0);
+                    ++completed_count;
+                }
+            );
+        }
+        ring.drain();
+
+        std::string content;
+        for (const auto& chunk : chunks) {
+            content += chunk;
+        }
+        if (completed_count != chunk_count || content != make_content()) {
+            std::cout << "The chunks read do not match the file's content."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        if (ring.get_outstanding_count() != 0 || ring.poll() != 0) {
+            std::cout << "The ring should have nothing left to do."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_coroutines ()
+    {
+        start_test("test_coroutines");
+
+        std::filesystem::remove(copy_path);
+
+        io_ring ring;
+        async_file source{ring, source_path, read_only, if_not_there::fail};
+        async_file destination{
+            ring,
+            copy_path,
+            write_only,
+            if_not_there::create
+        };
+        bool finished{false};
+        copy_file(source, destination, finished);
+        ring.drain();
+        destination.close();
+
+        if (!finished || read_whole_file(copy_path) != make_content()) {
+            std::cout << "Copying the file through coroutines did not "
+                         "produce the same content."
+                      << std::endl;
+
+            return false;
+        }
+
+        std::filesystem::remove(copy_path);
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_slots ()
+    {
+        start_test("test_slots");
+
+        io_ring ring{io_ring::default_queue_depth, 4, chunk_size};
+        async_file f{ring, source_path, read_only, if_not_there::fail};
+        f.set_position(chunk_size / 2);
+        for (std::size_t slot{0}; slot < ring.get_slot_count(); ++slot) {
+            f.read_slot(slot, {});
+        }
+        ring.drain();
+
+        std::string content{make_content()};
+        for (std::size_t slot{0}; slot < ring.get_slot_count(); ++slot) {
+            auto view{ring.get_slot_view(slot)};
+            std::string expected{
+                content.substr(chunk_size / 2 + slot * chunk_size, chunk_size)
+            };
+            if (
+                std::string(
+                    reinterpret_cast<const char*>(view.data()),
+                    view.size()
+                ) != expected
+            ) {
+                std::cout << "Slot " << slot << " does not hold the "
+                             "bytes expected."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_errors ()
+    {
+        start_test("test_errors");
+
+        io_ring ring;
+        async_file f{ring, source_path, read_only, if_not_there::fail};
+        std::byte data[4]{};
+        try {
+            f.write_async(data);
+            std::cout << "Writing to a read-only file did not throw."
+                      << std::endl;
+
+            return false;
+        } catch (const invalid_access_mode&) {
+        }
+
+        end_stage();
+
+        f.close();
+        std::int64_t result{0};
+        f.read_at(0, data, [&result] (std::int64_t r) { result = r; });
+        ring.drain();
+        if (result >= 0) {
+            std::cout << "Reading from a closed file did not fail."
+                      << std::endl;
+
+            return false;
+        }
+
+        std::filesystem::remove(source_path);
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    /*
+        Some systems forbid io_uring, in which case there's nothing to test.
+    */
+    try {
+        cmp::io_ring probe{1};
+    } catch (const std::system_error& e) {
+        std::cout << "io_uring is not available: " << e.what() << std::endl;
+        return 0;
+    }
+    return cmp::async_file_test_module{}.run_tests();
+} // function -----------------------------------------------------------------
+
+#else
+
+int
+main ()
+{
+    return 0;
+} // function -----------------------------------------------------------------
+
+#endif // CMP_OS_LINUX_BASED
@@ -1,6 +1,8 @@
 // Copyright (C) 2023 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <string>
+
 #include <cmp/core/test_module.hpp>
 #include <cmp/io/transparent_container_input_resource.hpp>
 #include <cmp/io/transparent_container_output_resource.hpp>
@@ -70,7 +72,16 @@ public:
                   :: test_set_position_u32string,
 
               &container_transfer_resources_test_module
-                  :: test_set_position_wstring
+                  :: test_set_position_wstring,
+
+              &container_transfer_resources_test_module
+                  :: test_peek_view_blob,
+
+              &container_transfer_resources_test_module
+                  :: test_peek_view_u16string,
+
+              &container_transfer_resources_test_module
+                  :: test_peek_view_tie_flush
           })
     {
     } // function -------------------------------------------------------------
@@ -502,6 +513,100 @@ public:
         return true;
     } // function -------------------------------------------------------------
 
+    template <
+        typename Container
+    >
+    bool
+    test_peek_view ()
+    {
+        using Element
+            = typename Container::value_type;
+
+        Container content;
+        if constexpr (std::is_same_v<Container, std::u16string>) {
+            content = u"Hello!\n";
+        } else {
+            content = {
+                static_cast<Element>('H'),
+                static_cast<Element>('e'),
+                static_cast<Element>('l'),
+                static_cast<Element>('l'),
+                static_cast<Element>('o'),
+                static_cast<Element>('!'),
+                static_cast<Element>('\n')
+            };
+        }
+
+        opaque_container_input_resource<Container> opaque_input{
+            content,
+            2 * sizeof (Element)
+        };
+
+        auto view{opaque_input.peek_view(1)};
+        if (
+            view.size() != 7 * sizeof (Element)
+                || static_cast<char>(view[0 * sizeof (Element)]) != 'H'
+                || static_cast<char>(view[1 * sizeof (Element)]) != 'e'
+        ) {
+            std::cout << "The view does not hold the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        if (
+            view.data() != reinterpret_cast<const std::byte*>(
+                std::data(opaque_input.grab_content())
+            )
+        ) {
+            std::cout << "The view does not point into the content."
+                      << std::endl;
+
+            return false;
+        }
+
+        opaque_input.consume(1 * sizeof (Element));
+        view = opaque_input.peek_view(4 * sizeof (Element));
+        if (
+            view.size() != 6 * sizeof (Element)
+                || static_cast<char>(view[0 * sizeof (Element)]) != 'e'
+                || static_cast<char>(view[1 * sizeof (Element)]) != 'l'
+                || static_cast<char>(view[2 * sizeof (Element)]) != 'l'
+                || static_cast<char>(view[3 * sizeof (Element)]) != 'o'
+        ) {
+            std::cout << "The view after consuming does not "
+                         "hold the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        opaque_input.consume(4 * sizeof (Element));
+        std::byte data[3 * sizeof (Element)];
+        auto bytes_read{opaque_input.read(data, 3 * sizeof (Element))};
+        if (
+            bytes_read != 2 * sizeof (Element)
+                || static_cast<char>(data[0 * sizeof (Element)]) != '!'
+                || static_cast<char>(data[1 * sizeof (Element)]) != '\n'
+        ) {
+            std::cout << "Reading after consuming did not "
+                         "give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        if (!opaque_input.is_at_end() || !opaque_input.peek_view(1).empty()) {
+            std::cout << "The resource is not at its end after "
+                         "all of its bytes were consumed and read."
+                      << std::endl;
+
+            return false;
+        }
+
+        return true;
+    } // function -------------------------------------------------------------
+
     // Tests ------------------------------------------------------------------
 
     bool
@@ -827,6 +932,92 @@ public:
 
         return true;
     } // function -------------------------------------------------------------
+
+    bool
+    test_peek_view_blob ()
+    noexcept
+    {
+        start_test("test_peek_view_blob");
+
+        if (!test_peek_view<std::vector<std::byte>>()) {
+            std::cout << "test_peek_view_blob failed."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_peek_view_u16string ()
+    noexcept
+    {
+        start_test("test_peek_view_u16string");
+
+        if (!test_peek_view<std::u16string>()) {
+            std::cout << "test_peek_view_u16string failed."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_peek_view_tie_flush ()
+    noexcept
+    {
+        start_test("test_peek_view_tie_flush");
+
+        /*
+            A prompt written to a tied output has to be flushed before
+            the input is looked at, as it is before the input is read.
+        */
+        opaque_container_output_resource<std::string> output{16};
+        opaque_container_input_resource<std::string> opaque_input{
+            std::string{"42\n"}
+        };
+        opaque_input.tie(output);
+        output.write(reinterpret_cast<const std::byte*>("?"), 1);
+        if (
+            opaque_input.peek_view(1).size() != 3
+                || output.grab_content() != "?"
+        ) {
+            std::cout << "Peeking at an opaque container "
+                         "input did not flush the tie."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        transparent_container_input_resource<std::string> transparent_input{
+            std::string{"42\n"}
+        };
+        transparent_input.tie(output);
+        output.write(reinterpret_cast<const std::byte*>("?"), 1);
+        if (
+            transparent_input.peek_view(1).size() != 3
+                || output.grab_content() != "??"
+        ) {
+            std::cout << "Peeking at a transparent container "
+                         "input did not flush the tie."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
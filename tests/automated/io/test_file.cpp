@@ -1,6 +1,11 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <cmp/core/test_module.hpp>
 #include <cmp/io/file.hpp>
 
@@ -22,11 +27,35 @@ public:
               &file_test_module
                   :: test_is_at_end,
 
+              &file_test_module
+                  :: test_end_tracking,
+
               &file_test_module
                   :: test_read,
 
               &file_test_module
-                  :: test_write
+                  :: test_peek_view,
+
+              &file_test_module
+                  :: test_write,
+
+              &file_test_module
+                  :: test_write_gather,
+
+              &file_test_module
+                  :: test_read_at_write_at,
+
+              &file_test_module
+                  :: test_buffer_sizing,
+
+              &file_test_module
+                  :: test_read_ahead,
+
+              &file_test_module
+                  :: test_read_ahead_with_peeks,
+
+              &file_test_module
+                  :: test_tie_flush
           })
     {
     } // function -------------------------------------------------------------
@@ -280,6 +309,117 @@ public:
         return true;
     } // function -------------------------------------------------------------
 
+    bool
+    test_end_tracking ()
+    noexcept
+    {
+        start_test("test_end_tracking");
+
+        std::filesystem::path file_path{"../../test_data/test_growing.txt"};
+
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+
+        file writer{file_path, write_only, if_not_there::create, 0};
+        file reader{file_path, read_only, if_not_there::fail};
+
+        if (!writer.is_open() || !reader.is_open()) {
+            std::cout << "File test_growing.txt could not be opened."
+                      << std::endl;
+
+            return false;
+        }
+
+        if (reader.get_end_tracking() != end_tracking::cached) {
+            std::cout << "The default end tracking mode is not "
+                         "end_tracking::cached."
+                      << std::endl;
+
+            return false;
+        }
+
+        if (!reader.is_at_end()) {
+            std::cout << "is_at_end is incorrectly reporting "
+                         "that the empty file is not at the end."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        std::byte data[] = {
+            static_cast<std::byte>('a'),
+            static_cast<std::byte>('b')
+        };
+        writer.write(data, 2);
+
+        if (!reader.is_at_end()) {
+            std::cout << "is_at_end is not using the cached file "
+                         "size in the end_tracking::cached mode."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        reader.set_end_tracking(end_tracking::growing);
+        if (reader.is_at_end()) {
+            std::cout << "is_at_end is not noticing that the file grew "
+                         "in the end_tracking::growing mode."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        std::byte read_data[2];
+        auto bytes_read{reader.read(read_data, 2)};
+        if (
+            bytes_read != 2
+                || static_cast<char>(read_data[0]) != 'a'
+                || static_cast<char>(read_data[1]) != 'b'
+        ) {
+            std::cout << "The data appended to the file was not read."
+                      << std::endl;
+
+            return false;
+        }
+
+        if (!reader.is_at_end()) {
+            std::cout << "is_at_end is incorrectly reporting "
+                         "that the file is not at the end."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        reader.set_end_tracking(end_tracking::cached);
+        reader.set_position(0, position_reference::begin);
+        if (reader.is_at_end()) {
+            std::cout << "is_at_end is incorrectly reporting "
+                         "that the file is at the end."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        writer.close();
+        reader.close();
+        std::filesystem::remove(file_path);
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
     bool
     test_read ()
     noexcept
@@ -328,6 +468,124 @@ public:
         return true;
     } // function -------------------------------------------------------------
 
+    bool
+    test_peek_view ()
+    noexcept
+    {
+        start_test("test_peek_view");
+
+        file f{
+            "../../test_data/test_reading.txt",
+            read_only,
+            if_not_there::fail,
+            2
+        };
+
+        if (!f.is_open()) {
+            std::cout << "File test_reading.txt could "
+                         "not be opened for reading."
+                      << std::endl;
+
+            return false;
+        }
+
+        auto view{f.peek_view(1)};
+        if (
+            view.size() != 2
+                || static_cast<char>(view[0]) != 'a'
+                || static_cast<char>(view[1]) != 'b'
+        ) {
+            std::cout << "The view does not hold the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        if (f.get_position() != 0) {
+            std::cout << "Peeking changed the position of the file."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.consume(1);
+        view = f.peek_view(3);
+        if (
+            view.size() != 3
+                || static_cast<char>(view[0]) != 'b'
+                || static_cast<char>(view[1]) != 'c'
+                || static_cast<char>(view[2]) != 'd'
+        ) {
+            std::cout << "Looking ahead across the end of the "
+                         "buffer did not give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        if (f.get_position() != 1) {
+            std::cout << "The file's position is not where it "
+                         "should be, which is position 1."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        std::byte data[1];
+        f.read(data, 1);
+        if (static_cast<char>(data[0]) != 'b' || f.get_position() != 2) {
+            std::cout << "Reading after peeking did not "
+                         "give the byte expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        view = f.peek_view(8);
+        if (view.size() != 2 || static_cast<char>(view[0]) != 'c') {
+            std::cout << "Looking ahead past the end of the file "
+                         "did not give the bytes that are left."
+                      << std::endl;
+
+            return false;
+        }
+
+        f.consume(view.size());
+        if (!f.is_at_end() || !f.peek_view(1).empty()) {
+            std::cout << "Consuming the bytes that were left "
+                         "did not bring the file to its end."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.set_position(1, position_reference::begin);
+        view = f.peek_view(2);
+        if (
+            view.size() < 2
+                || static_cast<char>(view[0]) != 'b'
+                || static_cast<char>(view[1]) != 'c'
+        ) {
+            std::cout << "Peeking after setting the position did "
+                         "not give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
     bool
     test_write ()
     noexcept
@@ -368,6 +626,764 @@ public:
 
         return true;
     } // function -------------------------------------------------------------
+
+    bool
+    test_write_gather ()
+    {
+        start_test("test_write_gather");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_write_gather.txt"
+        };
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+
+        std::string expected;
+        {
+            file f{file_path, write_only, if_not_there::create, 8};
+
+            std::string header{"ab"};
+            std::string payload{"cde"};
+            std::span<const std::byte> pieces[] = {
+                std::as_bytes(std::span{header}),
+                std::as_bytes(std::span{payload})
+            };
+            if (f.write_gather(pieces) != 5 || f.get_position() != 5) {
+                std::cout << "Pieces that fit in the buffer "
+                             "were not all written."
+                          << std::endl;
+
+                return false;
+            }
+            expected += header + payload;
+
+            end_stage();
+
+            std::string long_payload{"fghijklmnop"};
+            pieces[1] = std::as_bytes(std::span{long_payload});
+            if (f.write_gather(pieces) != 13 || f.get_position() != 18) {
+                std::cout << "Pieces that don't fit in the buffer "
+                             "were not all written."
+                          << std::endl;
+
+                return false;
+            }
+            expected += header + long_payload;
+
+            end_stage();
+
+            /*
+                More pieces than fit in a single vectored write.
+            */
+            std::vector<std::string> strings;
+            for (std::size_t i{0}; i < 200; ++i) {
+                strings.push_back(std::to_string(i));
+                expected += strings.back();
+            }
+            std::vector<std::span<const std::byte>> many_pieces;
+            std::size_t byte_count{0};
+            for (const auto& string : strings) {
+                many_pieces.push_back(std::as_bytes(std::span{string}));
+                byte_count += string.size();
+            }
+            if (f.write_gather(many_pieces) != byte_count) {
+                std::cout << "Many pieces were not all written."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        std::string content(expected.size() + 1, '\0');
+        {
+            file f{file_path, read_only, if_not_there::fail};
+            content.resize(f.read(
+                reinterpret_cast<std::byte*>(content.data()),
+                content.size()
+            ));
+        }
+        std::filesystem::remove(file_path);
+        if (content != expected) {
+            std::cout << "The file's content does not match "
+                         "the content expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_read_at_write_at ()
+    {
+        start_test("test_read_at_write_at");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_read_at_write_at.txt"
+        };
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+
+        constexpr std::size_t region_size{1000};
+        constexpr std::size_t region_count{8};
+        {
+            file f{file_path, read_and_write, if_not_there::create, 16};
+
+            /*
+                Each thread writes its own region of the file.
+            */
+            std::vector<std::thread> threads;
+            for (std::size_t i{0}; i < region_count; ++i) {
+                threads.emplace_back([&f, i] {
+                    std::string region(
+                        region_size,
+                        static_cast<char>('a' + i)
+                    );
+                    f.write_at(
+                        i * region_size,
+                        std::as_bytes(std::span{region})
+                    );
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            threads.clear();
+
+            /*
+                Then each thread reads another thread's region back.
+            */
+            bool regions_match[region_count]{};
+            for (std::size_t i{0}; i < region_count; ++i) {
+                threads.emplace_back([&f, &regions_match, i] {
+                    std::size_t other{(i + 1) % region_count};
+                    std::string region(region_size, '\0');
+                    std::size_t bytes_read{f.read_at(
+                        other * region_size,
+                        std::as_writable_bytes(std::span{region})
+                    )};
+                    regions_match[i] = bytes_read == region_size
+                        && region == std::string(
+                               region_size,
+                               static_cast<char>('a' + other)
+                           );
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            for (bool region_matches : regions_match) {
+                if (!region_matches) {
+                    std::cout << "A region read by one thread does not "
+                                 "hold what another thread wrote."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+
+            end_stage();
+
+            /*
+                Positional reads don't disturb the buffered position.
+            */
+            std::string head(10, '\0');
+            f.read(reinterpret_cast<std::byte*>(head.data()), 5);
+            std::string middle(4, '\0');
+            f.read_at(
+                3 * region_size,
+                std::as_writable_bytes(std::span{middle})
+            );
+            f.read(reinterpret_cast<std::byte*>(head.data()) + 5, 5);
+            if (
+                head != std::string(10, 'a')
+                    || middle != std::string(4, 'd')
+                    || f.get_position() != 10
+            ) {
+                std::cout << "A positional read moved the position."
+                          << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+
+            /*
+                Reading past the end only returns the bytes there are.
+            */
+            std::string tail(10, '\0');
+            if (
+                f.read_at(
+                    region_count * region_size - 4,
+                    std::as_writable_bytes(std::span{tail})
+                ) != 4
+            ) {
+                std::cout << "A positional read past the end did not "
+                             "stop at the end."
+                          << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+
+            /*
+                Positional calls go around the buffer, so bytes waiting in
+                it to be written are only read once it's flushed, and they
+                are written over the bytes of a positional write.
+            */
+            f.write(reinterpret_cast<const std::byte*>("XY"), 2);
+            std::string pair(2, '\0');
+            f.read_at(10, std::as_writable_bytes(std::span{pair}));
+            if (pair != "aa") {
+                std::cout << "A positional read saw bytes that were not "
+                             "flushed yet."
+                          << std::endl;
+
+                return false;
+            }
+            f.flush();
+            f.read_at(10, std::as_writable_bytes(std::span{pair}));
+            if (pair != "XY") {
+                std::cout << "A positional read did not see the bytes "
+                             "that were flushed."
+                          << std::endl;
+
+                return false;
+            }
+            f.write(reinterpret_cast<const std::byte*>("PQ"), 2);
+            f.write_at(12, std::as_bytes(std::span{"RS", 2}));
+            f.flush();
+            f.read_at(12, std::as_writable_bytes(std::span{pair}));
+            if (pair != "PQ") {
+                std::cout << "Flushing did not write over the bytes of "
+                             "a positional write."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        {
+            file f{file_path, read_only, if_not_there::fail};
+            std::byte data[1]{};
+            try {
+                f.write_at(0, data);
+                std::cout << "A positional write to a read-only "
+                             "file did not throw."
+                          << std::endl;
+
+                return false;
+            } catch (const invalid_access_mode&) {
+            }
+        }
+        std::filesystem::remove(file_path);
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_buffer_sizing ()
+    {
+        start_test("test_buffer_sizing");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_buffer_sizing.txt"
+        };
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+
+        constexpr std::size_t initial_capacity{16};
+        constexpr std::size_t file_size{1 << 20};
+        auto byte_at = [] (std::size_t i) {
+            return static_cast<char>('a' + (i * 31 + i / 97) % 26);
+        };
+
+        /*
+            Small sequential writes grow the buffer.
+        */
+        {
+            file f{file_path, write_only, if_not_there::create, 16};
+            if (f.get_buffer_sizing() != buffer_sizing::fixed) {
+                std::cout << "Buffers were not fixed by default."
+                          << std::endl;
+
+                return false;
+            }
+            f.set_buffer_sizing(buffer_sizing::adaptive);
+            std::size_t preferred_capacity{f.get_buffer_capacity()};
+            if (preferred_capacity < initial_capacity) {
+                std::cout << "Sizing the buffer adaptively shrank it."
+                          << std::endl;
+
+                return false;
+            }
+            for (std::size_t i{0}; i < file_size; i += 8) {
+                char record[8];
+                for (std::size_t j{0}; j < 8; ++j) {
+                    record[j] = byte_at(i + j);
+                }
+                f.write(reinterpret_cast<std::byte*>(record), 8);
+            }
+            if (
+                f.get_buffer_capacity() <= preferred_capacity
+                    && preferred_capacity
+                           < file::max_adaptive_buffer_capacity
+            ) {
+                std::cout << "Small sequential writes did not grow "
+                             "the buffer."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        /*
+            Small sequential reads grow the buffer as well, and the bytes
+            read are unaffected by the resizing.
+        */
+        file f{file_path, read_only, if_not_there::fail, 16};
+        f.set_buffer_sizing(buffer_sizing::adaptive);
+        std::size_t preferred_capacity{f.get_buffer_capacity()};
+        for (std::size_t i{0}; i < file_size / 2; i += 5) {
+            char record[5];
+            std::size_t bytes_read{
+                f.read(reinterpret_cast<std::byte*>(record), 5)
+            };
+            for (std::size_t j{0}; j < bytes_read; ++j) {
+                if (record[j] != byte_at(i + j)) {
+                    std::cout << "Byte " << i + j << " was not read "
+                                 "back correctly."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+        }
+        std::size_t grown_capacity{f.get_buffer_capacity()};
+        if (
+            grown_capacity <= preferred_capacity
+                && preferred_capacity < file::max_adaptive_buffer_capacity
+        ) {
+            std::cout << "Small sequential reads did not grow the buffer."
+                      << std::endl;
+
+            return false;
+        }
+        if (grown_capacity > file::max_adaptive_buffer_capacity) {
+            std::cout << "The buffer grew past the limit." << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        /*
+            Small reads far apart from each other shrink it back.
+        */
+        for (std::size_t i{0}; i < 64; ++i) {
+            std::size_t position{(i * 7919 * 64) % (file_size - 4)};
+            f.set_position(position, position_reference::begin);
+            char record[4];
+            f.read(reinterpret_cast<std::byte*>(record), 4);
+            if (record[0] != byte_at(position)) {
+                std::cout << "Byte " << position << " was not read "
+                             "back correctly."
+                          << std::endl;
+
+                return false;
+            }
+        }
+        if (f.get_buffer_capacity() != preferred_capacity) {
+            std::cout << "Scattered reads did not shrink the buffer back."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.close();
+        std::filesystem::remove(file_path);
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_read_ahead ()
+    {
+        start_test("test_read_ahead");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_read_ahead.txt"
+        };
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+
+        constexpr std::size_t file_size{1 << 20};
+        auto byte_at = [] (std::size_t i) {
+            return static_cast<char>('a' + (i * 17 + i / 251) % 26);
+        };
+        {
+            std::string content(file_size, '\0');
+            for (std::size_t i{0}; i < file_size; ++i) {
+                content[i] = byte_at(i);
+            }
+            file f{file_path, write_only, if_not_there::create};
+            f.write(reinterpret_cast<const std::byte*>(content.data()),
+                    content.size());
+        }
+
+        file f{file_path, read_and_write, if_not_there::fail, 4096};
+        if (f.get_read_ahead() != read_ahead::none) {
+            std::cout << "Read-ahead was not off by default." << std::endl;
+
+            return false;
+        }
+        f.set_read_ahead(read_ahead::background);
+        if (f.get_read_ahead() != read_ahead::background) {
+            std::cout << "Read-ahead could not be turned on." << std::endl;
+
+            return false;
+        }
+
+        /*
+            Reads of all sizes, big ones included, see the bytes of the
+            file in order, and the position follows them.
+        */
+        constexpr std::size_t read_sizes[]{7, 300, 4096, 5000, 1};
+        std::vector<char> record(5000);
+        std::size_t position{0};
+        for (std::size_t i{0}; position < file_size / 2; ++i) {
+            std::size_t read_size{read_sizes[i % std::size(read_sizes)]};
+            std::size_t bytes_read{
+                f.read(reinterpret_cast<std::byte*>(record.data()), read_size)
+            };
+            for (std::size_t j{0}; j < bytes_read; ++j) {
+                if (record[j] != byte_at(position + j)) {
+                    std::cout << "Byte " << position + j << " was not read "
+                                 "correctly."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+            position += bytes_read;
+            if (
+                bytes_read != read_size
+                    || f.get_position() != static_cast<std::int64_t>(position)
+            ) {
+                std::cout << "The position did not follow the reads."
+                          << std::endl;
+
+                return false;
+            }
+        }
+        auto view{f.peek_view(64)};
+        if (
+            view.size() < 64
+                || static_cast<char>(view[63]) != byte_at(position + 63)
+        ) {
+            std::cout << "Peeking did not see the bytes that come next."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        /*
+            Seeking drops the block read ahead.
+        */
+        position = file_size / 4 + 3;
+        f.set_position(position, position_reference::begin);
+        f.read(reinterpret_cast<std::byte*>(record.data()), 5000);
+        for (std::size_t j{0}; j < 5000; ++j) {
+            if (record[j] != byte_at(position + j)) {
+                std::cout << "Byte " << position + j << " was not read "
+                             "correctly after seeking."
+                          << std::endl;
+
+                return false;
+            }
+        }
+        position += 5000;
+
+        end_stage();
+
+        /*
+            Writing lands at the logical position, not at the end of the
+            block read ahead.
+        */
+        f.write(reinterpret_cast<const std::byte*>("READ-AHEAD"), 10);
+        f.set_position(position - 2, position_reference::begin);
+        f.read(reinterpret_cast<std::byte*>(record.data()), 14);
+        if (
+            record[0] != byte_at(position - 2)
+                || record[1] != byte_at(position - 1)
+                || std::string(record.data() + 2, 10) != "READ-AHEAD"
+                || record[12] != byte_at(position + 10)
+                || record[13] != byte_at(position + 11)
+        ) {
+            std::cout << "The write did not land where it should have."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        /*
+            Reading on reaches the end of the file.
+        */
+        position += 12;
+        while (true) {
+            std::size_t bytes_read{
+                f.read(reinterpret_cast<std::byte*>(record.data()), 5000)
+            };
+            if (bytes_read == 0) {
+                break;
+            }
+            if (record[bytes_read - 1] != byte_at(position + bytes_read - 1)) {
+                std::cout << "Byte " << position + bytes_read - 1 << " was "
+                             "not read correctly."
+                          << std::endl;
+
+                return false;
+            }
+            position += bytes_read;
+        }
+        if (position != file_size || !f.is_at_end()) {
+            std::cout << "Reading did not reach the end of the file."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.set_read_ahead(read_ahead::none);
+        f.set_position(0, position_reference::begin);
+        f.read(reinterpret_cast<std::byte*>(record.data()), 1);
+        if (
+            f.get_read_ahead() != read_ahead::none || record[0] != byte_at(0)
+        ) {
+            std::cout << "Read-ahead could not be turned off." << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.close();
+        std::filesystem::remove(file_path);
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_read_ahead_with_peeks ()
+    {
+        start_test("test_read_ahead_with_peeks");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_read_ahead_with_peeks.txt"
+        };
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+
+        constexpr std::size_t file_size{4096};
+        auto byte_at = [] (std::size_t i) {
+            return static_cast<char>('a' + (i * 7 + i / 26) % 26);
+        };
+        {
+            std::string content(file_size, '\0');
+            for (std::size_t i{0}; i < file_size; ++i) {
+                content[i] = byte_at(i);
+            }
+            file f{file_path, write_only, if_not_there::create};
+            f.write(reinterpret_cast<const std::byte*>(content.data()),
+                    content.size());
+        }
+
+        file f{file_path, read_only, if_not_there::fail, 64};
+        f.set_read_ahead(read_ahead::background);
+        std::vector<char> record(64);
+        std::size_t position{0};
+        auto read_and_check = [&] (std::size_t byte_count) {
+            std::size_t bytes_read{
+                f.read(reinterpret_cast<std::byte*>(record.data()), byte_count)
+            };
+            for (std::size_t j{0}; j < bytes_read; ++j) {
+                if (record[j] != byte_at(position + j)) {
+                    return false;
+                }
+            }
+            position += bytes_read;
+            return bytes_read == byte_count
+                && f.get_position() == static_cast<std::int64_t>(position);
+        };
+
+        /*
+            Peeking copies part of the block read ahead into the buffer,
+            and the rest of the block is still read from where it left
+            off once the buffer trades places with it.
+        */
+        if (
+            !read_and_check(60)
+                || f.peek_view(8).size() < 8
+                || !read_and_check(64)
+                || !read_and_check(4)
+        ) {
+            std::cout << "Reading after a peek that straddled the block "
+                         "read ahead did not give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        /*
+            Peeks, consumes and reads of all sizes keep seeing the bytes
+            of the file in order.
+        */
+        constexpr std::size_t step_sizes[]{5, 61, 9, 64, 3, 30, 1, 63};
+        for (std::size_t i{0}; position + 128 < file_size; ++i) {
+            std::size_t step_size{step_sizes[i % std::size(step_sizes)]};
+            if (i % 3 == 0) {
+                auto view{f.peek_view(step_size)};
+                if (
+                    view.size() < step_size
+                        || static_cast<char>(view[0]) != byte_at(position)
+                        || static_cast<char>(view[step_size - 1])
+                            != byte_at(position + step_size - 1)
+                ) {
+                    std::cout << "Peeking at byte " << position << " did "
+                                 "not see the bytes that come next."
+                              << std::endl;
+
+                    return false;
+                }
+                if (i % 2 == 0) {
+                    f.consume(step_size);
+                    position += step_size;
+                }
+            } else if (!read_and_check(step_size)) {
+                std::cout << "Reading at byte " << position << " did not "
+                             "give the bytes expected."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        f.close();
+        std::filesystem::remove(file_path);
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_tie_flush ()
+    {
+        start_test("test_tie_flush");
+
+        std::filesystem::path input_path{
+            "../../test_data/test_tie_flush_input.txt"
+        };
+        std::filesystem::path output_path{
+            "../../test_data/test_tie_flush_output.txt"
+        };
+        {
+            file f{input_path, write_only, if_not_there::create};
+            std::string content(64, 'x');
+            f.write(reinterpret_cast<const std::byte*>(content.data()),
+                    content.size());
+        }
+        if (std::filesystem::exists(output_path)) {
+            std::filesystem::remove(output_path);
+        }
+
+        file input{input_path, read_only, if_not_there::fail, 16};
+        file output{output_path, write_only, if_not_there::create};
+        input.tie(output);
+        std::byte b;
+        auto prompt_and_read = [&] {
+            output.write(reinterpret_cast<const std::byte*>("?"), 1);
+            input.read(&b, 1);
+            return std::filesystem::file_size(output_path);
+        };
+
+        /*
+            By default, the tied file is flushed when the buffer has to
+            be filled, and not when the buffer serves the read.
+        */
+        if (input.get_tie_flush() != tie_flush::on_refill) {
+            std::cout << "The tie was not flushed on refills by default."
+                      << std::endl;
+
+            return false;
+        }
+        if (prompt_and_read() != 1) {
+            std::cout << "Filling the buffer did not flush the tie."
+                      << std::endl;
+
+            return false;
+        }
+        if (prompt_and_read() != 1) {
+            std::cout << "A read served by the buffer flushed the tie."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        input.set_tie_flush(tie_flush::always);
+        if (prompt_and_read() != 3) {
+            std::cout << "A read did not flush the tie." << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        input.set_tie_flush(tie_flush::never);
+        input.set_position(48, position_reference::begin);
+        if (prompt_and_read() != 3) {
+            std::cout << "Filling the buffer flushed the tie." << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        input.close();
+        output.close();
+        std::filesystem::remove(input_path);
+        std::filesystem::remove(output_path);
+
+        return true;
+    } // function -------------------------------------------------------------
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -0,0 +1,495 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include <cmp/core/test_module.hpp>
+#include <cmp/io/file.hpp>
+
+namespace cmp {
+
+class file_interleaving_test_module
+    : public test_module<file_interleaving_test_module>
+{
+public:
+    file_interleaving_test_module ()
+    noexcept
+        : test_module({
+              &file_interleaving_test_module
+                  :: test_read_then_write,
+
+              &file_interleaving_test_module
+                  :: test_write_then_read,
+
+              &file_interleaving_test_module
+                  :: test_seek_within_buffer,
+
+              &file_interleaving_test_module
+                  :: test_seek_after_large_read,
+
+              &file_interleaving_test_module
+                  :: test_random_interleavings
+          })
+    {
+    } // function -------------------------------------------------------------
+
+    // Test Tooling -----------------------------------------------------------
+
+    static constexpr const char* file_path{
+        "../../test_data/test_interleaving.txt"
+    };
+
+    void
+    create_file (
+        const std::string& content
+    ) {
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+        file f{file_path, write_only, if_not_there::create};
+        f.write(
+            reinterpret_cast<const std::byte*>(content.data()),
+            content.size()
+        );
+    } // function -------------------------------------------------------------
+
+    std::string
+    read_file ()
+    {
+        file f{file_path, read_only, if_not_there::fail};
+        std::string content(
+            static_cast<std::size_t>(std::filesystem::file_size(file_path)),
+            '\0'
+        );
+        f.read(reinterpret_cast<std::byte*>(content.data()), content.size());
+        return content;
+    } // function -------------------------------------------------------------
+
+    std::string
+    read_string (
+        file& f,
+        std::size_t byte_count
+    ) {
+        std::string result(byte_count, '\0');
+        result.resize(
+            f.read(reinterpret_cast<std::byte*>(result.data()), byte_count)
+        );
+        return result;
+    } // function -------------------------------------------------------------
+
+    void
+    write_string (
+        file& f,
+        const std::string& data
+    ) {
+        f.write(reinterpret_cast<const std::byte*>(data.data()), data.size());
+    } // function -------------------------------------------------------------
+
+    /**
+        Description:
+            Runs a long sequence of randomly chosen reads, writes, peeks
+            and seeks on a file with the given buffer capacity, checking
+            every outcome against a simple in-memory model of the file.
+    */
+    bool
+    run_random_interleavings (
+        std::size_t buffer_capacity,
+        std::mt19937& generator
+    ) {
+        std::string model{"The quick brown fox jumps over the lazy dog."};
+        create_file(model);
+
+        std::int64_t position{0};
+        {
+            file f{
+                file_path,
+                read_and_write,
+                if_not_there::fail,
+                buffer_capacity
+            };
+
+            auto random{
+                [&generator] (std::int64_t low, std::int64_t high) {
+                    return std::uniform_int_distribution<std::int64_t>{
+                        low,
+                        high
+                    }(generator);
+                }
+            };
+
+            const std::int64_t operation_count{2000};
+            for (std::int64_t i{0}; i < operation_count; ++i) {
+                const auto model_size{static_cast<std::int64_t>(model.size())};
+                const std::int64_t left{std::max<std::int64_t>(
+                    model_size - position,
+                    0
+                )};
+                switch (random(0, 5)) {
+                    case 0: {
+                        auto byte_count{random(0, 24)};
+                        std::string expected{
+                            position < model_size
+                                ? model.substr(
+                                      static_cast<std::size_t>(position),
+                                      static_cast<std::size_t>(byte_count)
+                                  )
+                                : std::string{}
+                        };
+                        std::string actual{read_string(
+                            f,
+                            static_cast<std::size_t>(byte_count)
+                        )};
+                        if (actual != expected) {
+                            std::cout << "Operation " << i << " read \""
+                                      << actual << "\" instead of \""
+                                      << expected << "\"."
+                                      << std::endl;
+
+                            return false;
+                        }
+                        position += static_cast<std::int64_t>(actual.size());
+                        break;
+                    }
+                    case 1: {
+                        std::string data(
+                            static_cast<std::size_t>(random(1, 12)),
+                            '\0'
+                        );
+                        for (auto& c : data) {
+                            c = static_cast<char>(random('a', 'z'));
+                        }
+                        write_string(f, data);
+                        auto end{position + static_cast<std::int64_t>(
+                            data.size()
+                        )};
+                        if (end > model_size) {
+                            model.resize(static_cast<std::size_t>(end), '\0');
+                        }
+                        model.replace(
+                            static_cast<std::size_t>(position),
+                            data.size(),
+                            data
+                        );
+                        position = end;
+                        break;
+                    }
+                    case 2: {
+                        auto min_bytes{random(1, 12)};
+                        auto view{
+                            f.peek_view(static_cast<std::size_t>(min_bytes))
+                        };
+                        auto view_size{
+                            static_cast<std::int64_t>(view.size())
+                        };
+                        if (
+                            view_size < std::min(min_bytes, left)
+                                || view_size > left
+                                || !std::equal(
+                                       view.begin(),
+                                       view.end(),
+                                       reinterpret_cast<const std::byte*>(
+                                           model.data()
+                                       ) + position
+                                   )
+                        ) {
+                            std::cout << "Operation " << i << " peeked at "
+                                      << "bytes that don't match the file."
+                                      << std::endl;
+
+                            return false;
+                        }
+                        auto byte_count{random(0, view_size)};
+                        f.consume(static_cast<std::size_t>(byte_count));
+                        position += byte_count;
+                        break;
+                    }
+                    case 3: {
+                        position = random(0, model_size + 2);
+                        f.set_position(position, position_reference::begin);
+                        break;
+                    }
+                    case 4: {
+                        auto offset{random(-position, 8)};
+                        f.set_position(offset, position_reference::current);
+                        position += offset;
+                        break;
+                    }
+                    case 5: {
+                        auto offset{random(-model_size, 0)};
+                        f.set_position(offset, position_reference::end);
+                        position = model_size + offset;
+                        break;
+                    }
+                }
+
+                if (f.get_position() != position) {
+                    std::cout << "After operation " << i << ", the file's "
+                                 "position is " << f.get_position()
+                              << " instead of " << position << "."
+                              << std::endl;
+
+                    return false;
+                }
+
+                if (
+                    f.is_at_end()
+                        != (position >= static_cast<std::int64_t>(
+                               model.size()
+                           ))
+                ) {
+                    std::cout << "After operation " << i << ", is_at_end "
+                                 "disagrees with the model."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+        }
+
+        if (read_file() != model) {
+            std::cout << "The file's content does not match the model "
+                         "with a buffer capacity of " << buffer_capacity
+                      << "."
+                      << std::endl;
+
+            return false;
+        }
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    // Tests ------------------------------------------------------------------
+
+    bool
+    test_read_then_write ()
+    {
+        start_test("test_read_then_write");
+
+        create_file("abcdefgh");
+
+        {
+            file f{file_path, read_and_write, if_not_there::fail, 4};
+            if (read_string(f, 2) != "ab") {
+                std::cout << "The data read does not match the data expected."
+                          << std::endl;
+
+                return false;
+            }
+
+            write_string(f, "XY");
+            if (f.get_position() != 4) {
+                std::cout << "The file's position is not where it "
+                             "should be, which is position 4."
+                          << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+
+            if (read_string(f, 2) != "ef") {
+                std::cout << "Reading after writing did not continue "
+                             "right after the bytes written."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        if (read_file() != "abXYefgh") {
+            std::cout << "Writing after reading did not write "
+                         "at the position reached by reading."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_write_then_read ()
+    {
+        start_test("test_write_then_read");
+
+        create_file("abcdefgh");
+
+        {
+            file f{file_path, read_and_write, if_not_there::fail, 4};
+            write_string(f, "12");
+            if (read_string(f, 2) != "cd") {
+                std::cout << "Reading after writing did not continue "
+                             "right after the bytes written."
+                          << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+
+            f.set_position(0, position_reference::begin);
+            if (read_string(f, 4) != "12cd") {
+                std::cout << "The bytes written could not be read back."
+                          << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+
+            f.set_position(0, position_reference::end);
+            write_string(f, "ij");
+            f.set_position(-4, position_reference::current);
+            if (read_string(f, 8) != "ghij" || !f.is_at_end()) {
+                std::cout << "The bytes appended could not be read back."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        if (read_file() != "12cdefghij") {
+            std::cout << "The file's content does not match "
+                         "the content expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_seek_within_buffer ()
+    {
+        start_test("test_seek_within_buffer");
+
+        create_file("abcdefgh");
+
+        file f{file_path, read_only, if_not_there::fail, 8};
+        if (read_string(f, 1) != "a") {
+            std::cout << "The data read does not match the data expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        f.set_position(5, position_reference::begin);
+        if (f.get_position() != 5 || read_string(f, 1) != "f") {
+            std::cout << "Seeking forward within the buffer "
+                         "did not give the byte expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.set_position(-3, position_reference::current);
+        if (f.get_position() != 3 || read_string(f, 1) != "d") {
+            std::cout << "Seeking backward within the buffer "
+                         "did not give the byte expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.go_forward(2);
+        if (f.get_position() != 6 || read_string(f, 2) != "gh") {
+            std::cout << "Going forward within the buffer "
+                         "did not give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_seek_after_large_read ()
+    {
+        start_test("test_seek_after_large_read");
+
+        std::string content(32, '\0');
+        for (std::size_t i{0}; i < content.size(); ++i) {
+            content[i] = static_cast<char>('A' + i);
+        }
+        create_file(content);
+
+        file f{file_path, read_only, if_not_there::fail, 8};
+        if (read_string(f, 20) != content.substr(0, 20)) {
+            std::cout << "Reading more bytes than the buffer holds "
+                         "did not give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        f.set_position(16, position_reference::begin);
+        if (f.get_position() != 16 || read_string(f, 2) != "QR") {
+            std::cout << "Seeking after reading more bytes than the "
+                         "buffer holds did not give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.set_position(-12, position_reference::current);
+        if (read_string(f, 12) != content.substr(6, 12)) {
+            std::cout << "Seeking backward after reading more bytes than "
+                         "the buffer holds did not give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_random_interleavings ()
+    {
+        start_test("test_random_interleavings");
+
+        std::mt19937 generator{20230611};
+        for (std::size_t buffer_capacity : {0, 1, 3, 16, 1024}) {
+            if (!run_random_interleavings(buffer_capacity, generator)) {
+                std::cout << "Random interleavings failed with a "
+                             "buffer capacity of " << buffer_capacity
+                          << "."
+                          << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+        }
+
+        std::filesystem::remove(file_path);
+
+        return true;
+    } // function -------------------------------------------------------------
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    return cmp::file_interleaving_test_module{}.run_tests();
+} // function -----------------------------------------------------------------
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSL-1.0
 
 #include <cstdint>
+#include <vector>
 
 #include <cmp/core/test_module.hpp>
 #include <cmp/io/general.hpp>
@@ -16,7 +17,10 @@ public:
     noexcept
         : test_module({
               &io_general_test_module
-                  :: test_invert_endianness
+                  :: test_invert_endianness,
+
+              &io_general_test_module
+                  :: test_invert_endianness_of_elements
           })
     {
     } // function -------------------------------------------------------------
@@ -76,6 +80,86 @@ public:
 
         return true;
     } // function -------------------------------------------------------------
+
+    bool
+    test_invert_endianness_of_elements ()
+    noexcept
+    {
+        start_test("test_invert_endianness_of_elements");
+
+        /*
+            The counts cover the vector loops along with their tails.
+        */
+        auto test_elements = [] <typename T> (T first_value) {
+            for (std::size_t count : {0, 1, 2, 3, 7, 8, 9, 17, 100}) {
+                std::vector<T> values(count);
+                std::vector<T> expected(count);
+                for (std::size_t i{0}; i < count; ++i) {
+                    values[i] = static_cast<T>(first_value + i);
+                    expected[i] = values[i];
+                    invert_endianness(
+                        reinterpret_cast<std::byte*>(&expected[i]),
+                        sizeof (T)
+                    );
+                }
+                invert_endianness_of_elements(
+                    reinterpret_cast<std::byte*>(values.data()),
+                    sizeof (T),
+                    count
+                );
+                if (values != expected) {
+                    std::cout << "invert_endianness_of_elements did not "
+                                 "correctly invert the endianness of "
+                              << count << " elements of " << sizeof (T)
+                              << " bytes."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        if (!test_elements(std::uint16_t{0x0102})) {
+            return false;
+        }
+
+        end_stage();
+
+        if (!test_elements(std::uint32_t{0x01020304})) {
+            return false;
+        }
+
+        end_stage();
+
+        if (!test_elements(std::uint64_t{0x0102030405060708})) {
+            return false;
+        }
+
+        end_stage();
+
+        std::byte bytes[9]{
+            std::byte{1}, std::byte{2}, std::byte{3},
+            std::byte{4}, std::byte{5}, std::byte{6},
+            std::byte{7}, std::byte{8}, std::byte{9}
+        };
+        invert_endianness_of_elements(bytes, 3, 3);
+        if (
+            bytes[0] != std::byte{3} || bytes[2] != std::byte{1}
+                || bytes[3] != std::byte{6} || bytes[5] != std::byte{4}
+                || bytes[6] != std::byte{9} || bytes[8] != std::byte{7}
+        ) {
+            std::cout << "invert_endianness_of_elements did not correctly "
+                         "invert the endianness of elements of 3 bytes."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -0,0 +1,371 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <fstream>
+#include <string>
+
+#include <cmp/core/test_module.hpp>
+#include <cmp/io/data_input_stream.hpp>
+#include <cmp/io/mapped_file.hpp>
+#include <cmp/io/opaque_container_output_resource.hpp>
+#include <cmp/io/text_input_stream.hpp>
+
+namespace cmp {
+
+class mapped_file_test_module
+    : public test_module<mapped_file_test_module>
+{
+public:
+    mapped_file_test_module ()
+    noexcept
+        : test_module({
+              &mapped_file_test_module
+                  :: test_open,
+
+              &mapped_file_test_module
+                  :: test_read,
+
+              &mapped_file_test_module
+                  :: test_position,
+
+              &mapped_file_test_module
+                  :: test_peek_view,
+
+              &mapped_file_test_module
+                  :: test_move,
+
+              &mapped_file_test_module
+                  :: test_streams
+          })
+    {
+    } // function -------------------------------------------------------------
+
+    // Test Tooling -----------------------------------------------------------
+
+    static constexpr const char* file_path{
+        "../../test_data/test_mapped_file.txt"
+    };
+
+    static constexpr const char* empty_file_path{
+        "../../test_data/test_mapped_file_empty.txt"
+    };
+
+    static constexpr const char* file_content{"Hello\nmapped world\n"};
+
+    void
+    create_file (
+        const char* path,
+        const std::string& content
+    ) {
+        std::ofstream ofstream{path, std::ios::binary};
+        ofstream.write(content.data(), content.size());
+    } // function -------------------------------------------------------------
+
+    std::string
+    read_string (
+        mapped_file& f,
+        std::size_t byte_count
+    ) {
+        std::string result(byte_count, '\0');
+        result.resize(
+            f.read(reinterpret_cast<std::byte*>(result.data()), byte_count)
+        );
+        return result;
+    } // function -------------------------------------------------------------
+
+    // Tests ------------------------------------------------------------------
+
+    bool
+    test_open ()
+    {
+        start_test("test_open");
+
+        create_file(file_path, file_content);
+        create_file(empty_file_path, "");
+
+        mapped_file f{file_path};
+        if (!f.is_open() || f.get_size() != 19 || f.is_at_end()) {
+            std::cout << "File test_mapped_file.txt could "
+                         "not be mapped for reading."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        mapped_file empty_file{empty_file_path};
+        if (
+            !empty_file.is_open()
+                || empty_file.get_size() != 0
+                || !empty_file.is_at_end()
+                || !empty_file.peek_view().empty()
+        ) {
+            std::cout << "An empty file should open and be at its end."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        mapped_file missing_file{"../../test_data/test_mapped_missing.txt"};
+        if (missing_file.is_open()) {
+            std::cout << "A file that doesn't exist should not open."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.close();
+        if (f.is_open() || f.get_size() != 0) {
+            std::cout << "Closing the mapped file did not unmap it."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_read ()
+    {
+        start_test("test_read");
+
+        mapped_file f{file_path, access_pattern::sequential};
+        if (read_string(f, 6) != "Hello\n") {
+            std::cout << "The data read does not match the data expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.set_access_pattern(access_pattern::random);
+        if (read_string(f, 100) != "mapped world\n" || !f.is_at_end()) {
+            std::cout << "Reading past the end did not stop at the end."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        if (!read_string(f, 1).empty()) {
+            std::cout << "Reading at the end should read nothing."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_position ()
+    {
+        start_test("test_position");
+
+        mapped_file f{file_path};
+        f.set_position(6, position_reference::begin);
+        if (f.get_position() != 6 || read_string(f, 6) != "mapped") {
+            std::cout << "Seeking from the beginning did not "
+                         "give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.set_position(-6, position_reference::end);
+        if (f.get_position() != 13 || read_string(f, 5) != "world") {
+            std::cout << "Seeking from the end did not "
+                         "give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.go_back(18);
+        if (f.get_position() != 0 || read_string(f, 5) != "Hello") {
+            std::cout << "Going back did not give the bytes expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.set_position(-100, position_reference::current);
+        if (f.get_position() != 0) {
+            std::cout << "Seeking before the beginning should "
+                         "stop at the beginning."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_peek_view ()
+    {
+        start_test("test_peek_view");
+
+        mapped_file f{file_path};
+        f.go_forward(6);
+        auto view{f.peek_view()};
+        if (
+            view.size() != 13
+                || view.data() != f.get_view().data() + 6
+                || static_cast<char>(view[0]) != 'm'
+        ) {
+            std::cout << "The view does not point into the "
+                         "mapping at the current position."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        f.consume(100);
+        if (!f.is_at_end() || f.get_position() != 19) {
+            std::cout << "Consuming more bytes than are left "
+                         "did not stop at the end."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_move ()
+    {
+        start_test("test_move");
+
+        mapped_file f1{file_path};
+        f1.go_forward(6);
+        mapped_file f2{std::move(f1)};
+        if (
+            f1.is_open()
+                || !f2.is_open()
+                || read_string(f2, 6) != "mapped"
+        ) {
+            std::cout << "Move-constructing did not move the mapping."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        mapped_file f3{empty_file_path};
+        f3 = std::move(f2);
+        if (
+            f2.is_open()
+                || f3.get_position() != 12
+                || read_string(f3, 6) != " world"
+        ) {
+            std::cout << "Move-assigning did not move the mapping."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_streams ()
+    {
+        start_test("test_streams");
+
+        mapped_file f{file_path};
+        opaque_container_output_resource<std::string> prompt_output{16};
+        f.tie(prompt_output);
+        prompt_output.write(reinterpret_cast<const std::byte*>("?"), 1);
+        text_input_stream text_stream{f, utf8};
+        std::u8string line;
+        text_stream.read_line(line);
+        if (line != u8"Hello") {
+            std::cout << "A line read through a text input stream "
+                         "does not match the line expected."
+                      << std::endl;
+
+            return false;
+        }
+        if (prompt_output.grab_content() != "?") {
+            std::cout << "Reading through a text input stream "
+                         "did not flush the tie."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        std::int32_t value_to_write1{75};
+        double value_to_write2{128.25};
+        {
+            std::ofstream ofstream{file_path, std::ios::binary};
+            ofstream.write(
+                reinterpret_cast<const char*>(&value_to_write1),
+                sizeof (value_to_write1)
+            );
+            ofstream.write(
+                reinterpret_cast<const char*>(&value_to_write2),
+                sizeof (value_to_write2)
+            );
+        }
+
+        f.open(file_path);
+        data_input_stream data_stream{f};
+        std::int32_t value_to_read1;
+        double value_to_read2;
+        data_stream >> value_to_read1 >> value_to_read2;
+        if (value_to_read1 != 75 || value_to_read2 != 128.25) {
+            std::cout << "The values read through a data input stream "
+                         "do not match the values expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        f.close();
+        std::filesystem::remove(file_path);
+        std::filesystem::remove(empty_file_path);
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    return cmp::mapped_file_test_module{}.run_tests();
+} // function -----------------------------------------------------------------
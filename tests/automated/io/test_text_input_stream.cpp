@@ -6,6 +6,8 @@
 #include <cmp/io/file.hpp>
 #include <cmp/io/opaque_container_input_resource.hpp>
 
+#include "../allocation_counter.hpp"
+
 namespace cmp {
 
 class text_input_stream_test_module
@@ -52,7 +54,19 @@ public:
                   :: test_read_all_from_utf32,
 
               &text_input_stream_test_module
-                  :: test_read_all_from_wide
+                  :: test_read_all_from_wide,
+
+              &text_input_stream_test_module
+                  :: test_read_utf8_across_refills,
+
+              &text_input_stream_test_module
+                  :: test_read_wide_across_refills,
+
+              &text_input_stream_test_module
+                  :: test_read_line_views,
+
+              &text_input_stream_test_module
+                  :: test_read_numbers
           })
     {
     } // function -------------------------------------------------------------
@@ -914,6 +928,436 @@ public:
 
         return true;
     } // function -------------------------------------------------------------
+
+    bool
+    test_read_utf8_across_refills ()
+    noexcept
+    {
+        start_test("test_read_utf8_across_refills");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_read_utf8_across_refills.txt"
+        };
+        auto write_file = [&file_path] (std::u8string_view content) {
+            file f{file_path, write_only, if_not_there::create};
+            f.write(
+                reinterpret_cast<const std::byte*>(content.data()),
+                content.size()
+            );
+        };
+
+        /*
+            Tiny buffers split the multi-byte sequences across refills
+            at every possible place.
+        */
+        std::u8string content;
+        std::u8string expected;
+        for (int i{0}; i < 50; ++i) {
+            content += u8"h\u00E9llo w\u00F6rld \u65E5\u672C\u8A9E "
+                       u8"\U0001F600 and more plain text\r\n"
+                       u8"second\tline\r\r\n";
+            expected += u8"h\u00E9llo w\u00F6rld \u65E5\u672C\u8A9E "
+                        u8"\U0001F600 and more plain text\n"
+                        u8"second\tline\r\n";
+        }
+        content += u8"last\r";
+        expected += u8"last\r";
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+        write_file(content);
+
+        for (std::size_t capacity : {1, 2, 3, 5, 7, 64, 4096}) {
+            file f{file_path, read_only, if_not_there::fail, capacity};
+            text_input_stream<file> tis{f, utf8};
+            std::u32string text;
+            tis.read_all(text);
+            if (text != to_u32string(expected)) {
+                std::cout << "The text read with a buffer capacity of "
+                          << capacity << " is not the text expected."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        for (std::size_t capacity : {1, 3, 4096}) {
+            file f{file_path, read_only, if_not_there::fail, capacity};
+            text_input_stream<file> tis{f, utf8};
+            std::u8string lines;
+            std::u8string line;
+            while (!tis.is_at_end()) {
+                tis.read_line(line);
+                lines += line;
+                lines += u8'\n';
+            }
+            if (lines != expected + u8'\n') {
+                std::cout << "The lines read with a buffer capacity of "
+                          << capacity << " are not the lines expected."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        /*
+            Invalid and truncated sequences are still reported.
+        */
+        std::filesystem::remove(file_path);
+        write_file(u8"ab\xC3(cd");
+        try {
+            file f{file_path, read_only, if_not_there::fail};
+            text_input_stream<file> tis{f, utf8};
+            std::u8string text;
+            tis.read_all(text);
+            std::cout << "An invalid sequence was not reported." << std::endl;
+
+            return false;
+        } catch (const invalid_unicode_encoding&) {
+        }
+        std::filesystem::remove(file_path);
+        write_file(u8"ab\xE6\x97");
+        try {
+            file f{file_path, read_only, if_not_there::fail, 2};
+            text_input_stream<file> tis{f, utf8};
+            std::u8string text;
+            tis.read_all(text);
+            std::cout << "A truncated sequence was not reported."
+                      << std::endl;
+
+            return false;
+        } catch (const read_past_end&) {
+        }
+        std::filesystem::remove(file_path);
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_read_wide_across_refills ()
+    noexcept
+    {
+        start_test("test_read_wide_across_refills");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_read_wide_across_refills.txt"
+        };
+
+        /*
+            There is enough text for several blocks of code units, and the
+            tiny buffers split the code units and the surrogate pairs across
+            refills at every possible place.
+        */
+        std::u32string content;
+        std::u32string expected;
+        for (int i{0}; i < 100; ++i) {
+            content += U"h\u00E9llo \u65E5\u672C\u8A9E \U0001F600 text\r\n"
+                       U"second\tline\r\r\n";
+            expected += U"h\u00E9llo \u65E5\u672C\u8A9E \U0001F600 text\n"
+                        U"second\tline\r\n";
+        }
+        content += U"last\r";
+        expected += U"last\r";
+
+        auto run = [&] <typename CodeUnit> (std::endian endianness) {
+            encoding_form encoding{
+                std::is_same_v<CodeUnit, char16_t> ? utf16 : utf32
+            };
+            auto code_units{convert_string<std::basic_string<CodeUnit>>(
+                content
+            )};
+            if (endianness != std::endian::native) {
+                invert_endianness_of_elements(
+                    reinterpret_cast<std::byte*>(code_units.data()),
+                    sizeof (CodeUnit),
+                    code_units.size()
+                );
+            }
+            if (std::filesystem::exists(file_path)) {
+                std::filesystem::remove(file_path);
+            }
+            {
+                file f{file_path, write_only, if_not_there::create};
+                f.write(
+                    reinterpret_cast<const std::byte*>(code_units.data()),
+                    code_units.size() * sizeof (CodeUnit)
+                );
+            }
+
+            for (std::size_t capacity : {1, 3, 5, 4096}) {
+                file f{file_path, read_only, if_not_there::fail, capacity};
+                text_input_stream<file> tis{f, encoding, endianness};
+                std::u8string text;
+                tis.read_all(text);
+                if (text != to_u8string(expected)) {
+                    std::cout << "The text read with a buffer capacity of "
+                              << capacity << " is not the text expected."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+
+            for (std::size_t capacity : {1, 3, 4096}) {
+                file f{file_path, read_only, if_not_there::fail, capacity};
+                text_input_stream<file> tis{f, encoding, endianness};
+                std::u16string lines;
+                std::u16string line;
+                while (!tis.is_at_end()) {
+                    tis.read_line(line);
+                    lines += line;
+                    lines += u'\n';
+                }
+                if (lines != to_u16string(expected) + u'\n') {
+                    std::cout << "The lines read with a buffer capacity of "
+                              << capacity << " are not the lines expected."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+        for (auto endianness : {std::endian::little, std::endian::big}) {
+            if (!run.template operator ()<char16_t>(endianness)) {
+                std::cout << "Reading UTF-16 failed." << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+
+            if (!run.template operator ()<char32_t>(endianness)) {
+                std::cout << "Reading UTF-32 failed." << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+        }
+        std::filesystem::remove(file_path);
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_read_line_views ()
+    noexcept
+    {
+        start_test("test_read_line_views");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_read_line_views.txt"
+        };
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+        {
+            std::u8string_view content{
+                u8"plain line\n"
+                u8"windows line\r\n"
+                u8"carriage\rreturn inside\r\n"
+                u8"\n"
+                u8"h\u00E9llo \u65E5\u672C\u8A9E \U0001F600\n"
+                u8"doubled\r\r\n"
+                u8"last"
+            };
+            file f{file_path, write_only, if_not_there::create};
+            f.write(
+                reinterpret_cast<const std::byte*>(content.data()),
+                content.size()
+            );
+        }
+        std::u8string_view expected_lines[]{
+            u8"plain line",
+            u8"windows line",
+            u8"carriagereturn inside",
+            u8"",
+            u8"h\u00E9llo \u65E5\u672C\u8A9E \U0001F600",
+            u8"doubled\r",
+            u8"last"
+        };
+
+        /*
+            Small buffers make lines straddle refills, so they have to
+            be copied into the storage of the stream instead.
+        */
+        for (std::size_t capacity : {1, 3, 16, 4096}) {
+            file f{file_path, read_only, if_not_there::fail, capacity};
+            text_input_stream<file> tis{f, utf8};
+            for (std::u8string_view expected_line : expected_lines) {
+                if (tis.is_at_end()) {
+                    std::cout << "The stream ended early with a buffer "
+                                 "capacity of " << capacity << "."
+                              << std::endl;
+
+                    return false;
+                }
+                if (tis.read_line() != expected_line) {
+                    std::cout << "A line read with a buffer capacity of "
+                              << capacity << " is not the line expected."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+            if (!tis.is_at_end()) {
+                std::cout << "The stream did not end with a buffer "
+                             "capacity of " << capacity << "."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        /*
+            The encoding of a line that is handed out where it is still
+            has to be checked.
+        */
+        std::filesystem::remove(file_path);
+        {
+            std::u8string_view content{u8"ok\nab\xC3(cd\nrest\n"};
+            file f{file_path, write_only, if_not_there::create};
+            f.write(
+                reinterpret_cast<const std::byte*>(content.data()),
+                content.size()
+            );
+        }
+        try {
+            file f{file_path, read_only, if_not_there::fail};
+            text_input_stream<file> tis{f, utf8};
+            if (tis.read_line() != u8"ok") {
+                std::cout << "The line before the invalid one is not the "
+                             "line expected."
+                          << std::endl;
+
+                return false;
+            }
+            static_cast<void>(tis.read_line());
+            std::cout << "An invalid sequence was not reported." << std::endl;
+
+            return false;
+        } catch (const invalid_unicode_encoding&) {
+        }
+        std::filesystem::remove(file_path);
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_read_numbers ()
+    noexcept
+    {
+        start_test("test_read_numbers");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_read_numbers.txt"
+        };
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+        {
+            std::u8string_view content{
+                u8"  12 -345\t6789\r\n"
+                u8"1 0\n"
+                u8"3.25\u00A0-17\u3000"
+                u8"123456789 0.5\r\n"
+                u8"42"
+            };
+            file f{file_path, write_only, if_not_there::create};
+            f.write(
+                reinterpret_cast<const std::byte*>(content.data()),
+                content.size()
+            );
+        }
+
+        /*
+            Small buffers make numbers straddle refills, and whitespace
+            outside of ASCII and carriage returns take the slow path.
+        */
+        for (std::size_t capacity : {1, 3, 16, 4096}) {
+            file f{file_path, read_only, if_not_there::fail, capacity};
+            text_input_stream<file> tis{f, utf8};
+            int a, b, c;
+            bool d, e;
+            double g;
+            long long h, i;
+            float j;
+            unsigned int k;
+            tis >> a >> b >> c >> d >> e >> g >> h >> i >> j >> k;
+            if (
+                a != 12 || b != -345 || c != 6789 || !d || e
+                    || g != 3.25 || h != -17 || i != 123456789
+                    || j != 0.5f || k != 42
+            ) {
+                std::cout << "The numbers read with a buffer capacity of "
+                          << capacity << " are not the numbers expected."
+                          << std::endl;
+
+                return false;
+            }
+        }
+        std::filesystem::remove(file_path);
+
+        end_stage();
+
+        /*
+            Once the storage of the stream has grown, reading numbers
+            doesn't allocate, whether they are parsed where they are in
+            the buffer or copied into the storage first.
+        */
+        std::u8string numbers;
+        for (int n{0}; n < 1000; ++n) {
+            numbers += u8"1234 5.5 1\u00A0";
+        }
+        for (std::size_t capacity : {7, 4096}) {
+            opaque_u8string_input_resource resource{numbers, capacity};
+            text_input_stream tis{resource, utf8};
+            int integer;
+            double floating_point;
+            bool boolean;
+            tis >> integer >> floating_point >> boolean;
+            std::size_t initial_allocation_count{allocation_count};
+            while (!tis.is_at_end()) {
+                tis >> integer >> floating_point >> boolean;
+                if (
+                    integer != 1234
+                        || floating_point != 5.5
+                        || !boolean
+                ) {
+                    std::cout << "A number read with a buffer capacity of "
+                              << capacity << " is not the number "
+                              << "expected."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+            if (allocation_count != initial_allocation_count) {
+                std::cout << "Reading numbers with a buffer capacity of "
+                          << capacity << " allocated."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -1,9 +1,15 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <string>
+#include <vector>
+
 #include <cmp/core/test_module.hpp>
 #include <cmp/io/text_output_stream.hpp>
 #include <cmp/io/file.hpp>
+#include <cmp/io/transparent_container_output_resource.hpp>
+
+#include "../allocation_counter.hpp"
 
 namespace cmp {
 
@@ -24,7 +30,13 @@ public:
                   :: test_write_to_utf32,
 
               &text_output_stream_test_module
-                  :: test_write_to_wide
+                  :: test_write_to_wide,
+
+              &text_output_stream_test_module
+                  :: test_write_to_containers,
+
+              &text_output_stream_test_module
+                  :: test_write_without_allocating
           })
     {
     } // function -------------------------------------------------------------
@@ -156,6 +168,89 @@ public:
         return true;
     } // function -------------------------------------------------------------
 
+    template <
+        typename CodeUnit
+    >
+    std::vector<std::byte>
+    encode_expected (
+        const std::u32string& text,
+        std::endian endianness
+    ) {
+        std::basic_string<CodeUnit> code_units{
+            convert_string<std::basic_string<CodeUnit>>(text)
+        };
+        std::vector<std::byte> result;
+        for (CodeUnit code_unit : code_units) {
+            std::byte bytes[sizeof (CodeUnit)];
+            std::memcpy(bytes, &code_unit, sizeof (CodeUnit));
+            if (endianness != std::endian::native) {
+                invert_endianness(bytes, sizeof (CodeUnit));
+            }
+            result.insert(result.end(), bytes, bytes + sizeof (CodeUnit));
+        }
+        return result;
+    } // function -------------------------------------------------------------
+
+    template <
+        typename CodeUnit
+    >
+    bool
+    test_write_to_container (
+        std::endian endianness
+    ) {
+        encoding_form encoding{
+            sizeof (CodeUnit) == 1 ? utf8
+                : sizeof (CodeUnit) == 2 ? utf16
+                : utf32
+        };
+
+        /*
+            The long text is written in several blocks, some of which end
+            in the middle of a multi-byte sequence or surrogate pair.
+        */
+        std::u32string long_text;
+        for (int i{0}; i < 200; ++i) {
+            long_text += U"h\u00E9llo \u65E5\u672C\u8A9E \U0001F600 ";
+        }
+        std::u32string expected_text{
+            U"\u00AF\\_(\u30C4)_/\u00AF\n"
+            U"\u00AF\\_(\u30C4)_/\u00AF\n"
+            U"\u00AF\\_(\u30C4)_/\u00AF\n"
+            U"\u00AF\\_(\u30C4)_/\u00AF\n"
+            U"plain chars\n"
+            U"\u00E9\U0001F600"
+        };
+        expected_text += long_text;
+        expected_text += long_text;
+        expected_text += long_text;
+
+        std::vector<std::byte> content;
+        transparent_container_output_resource<std::vector<std::byte>>
+            resource{content};
+        text_output_stream stream{resource, encoding, endianness};
+        stream << u8"\u00AF\\_(\u30C4)_/\u00AF" << '\n';
+        stream << u"\u00AF\\_(\u30C4)_/\u00AF" << '\n';
+        stream << U"\u00AF\\_(\u30C4)_/\u00AF" << '\n';
+        stream << L"\u00AF\\_(\u30C4)_/\u00AF" << '\n';
+        stream << "plain chars\n";
+        stream << U'\u00E9' << U'\U0001F600';
+        stream << to_u8string(long_text);
+        stream << to_u16string(long_text);
+        stream << long_text;
+        stream.flush();
+
+        if (content != encode_expected<CodeUnit>(expected_text, endianness)) {
+            std::cout << "The text written as "
+                      << sizeof (CodeUnit) * 8
+                      << "-bit code units is not the text expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        return true;
+    } // function -------------------------------------------------------------
+
     // Tests ------------------------------------------------------------------
 
     bool
@@ -277,6 +372,79 @@ public:
 
         return true;
     } // function -------------------------------------------------------------
+
+    bool
+    test_write_to_containers ()
+    noexcept
+    {
+        start_test("test_write_to_containers");
+
+        for (
+            std::endian endianness : {std::endian::little, std::endian::big}
+        ) {
+            if (
+                !test_write_to_container<char8_t>(endianness)
+                    || !test_write_to_container<char16_t>(endianness)
+                    || !test_write_to_container<char32_t>(endianness)
+            ) {
+                return false;
+            }
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_write_without_allocating ()
+    noexcept
+    {
+        start_test("test_write_without_allocating");
+
+        std::u8string utf8_string{u8"\u00AF\\_(\u30C4)_/\u00AF"};
+        std::u16string utf16_string{u"\u00AF\\_(\u30C4)_/\u00AF"};
+        std::u32string utf32_string{U"\u00AF\\_(\u30C4)_/\u00AF"};
+        std::wstring wide_string{L"\u00AF\\_(\u30C4)_/\u00AF"};
+
+        for (encoding_form encoding : {utf8, utf16, utf32}) {
+            for (
+                std::endian endianness
+                    : {std::endian::little, std::endian::big}
+            ) {
+                std::vector<std::byte> content;
+                content.reserve(1 << 16);
+                transparent_container_output_resource<std::vector<std::byte>>
+                    resource{content};
+                text_output_stream stream{resource, encoding, endianness};
+
+                std::size_t initial_allocation_count{allocation_count};
+                stream << U'\u00E9' << U'\U0001F600' << 'x';
+                stream << utf8_string << utf16_string;
+                stream << utf32_string << wide_string;
+                stream << "plain chars";
+                stream << -1234567890123456789LL;
+                std::size_t operation_count{10};
+                std::size_t allocations{
+                    allocation_count - initial_allocation_count
+                };
+                if (allocations != 0) {
+                    std::cout << "Writing allocated "
+                              << static_cast<double>(allocations)
+                                     / operation_count
+                              << " times per operator << with encoding form "
+                              << static_cast<int>(encoding) << "."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -0,0 +1,250 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <filesystem>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <cmp/core/test_module.hpp>
+#include <cmp/io/file.hpp>
+#include <cmp/io/opaque_container_input_resource.hpp>
+#include <cmp/io/text_ranges.hpp>
+
+namespace cmp {
+
+static_assert(std::ranges::input_range<line_range<file>>);
+static_assert(std::ranges::input_range<token_range<file>>);
+
+class text_ranges_test_module
+    : public test_module<text_ranges_test_module>
+{
+public:
+    text_ranges_test_module ()
+    noexcept
+        : test_module({
+              &text_ranges_test_module
+                  :: test_lines,
+
+              &text_ranges_test_module
+                  :: test_tokens,
+
+              &text_ranges_test_module
+                  :: test_ranges_with_algorithms
+          })
+    {
+    } // function -------------------------------------------------------------
+
+    // Test Tooling -----------------------------------------------------------
+
+    static
+    void
+    write_file (
+        const std::filesystem::path& file_path,
+        std::u8string_view content
+    ) {
+        if (std::filesystem::exists(file_path)) {
+            std::filesystem::remove(file_path);
+        }
+        file f{file_path, write_only, if_not_there::create};
+        f.write(
+            reinterpret_cast<const std::byte*>(content.data()),
+            content.size()
+        );
+    } // function -------------------------------------------------------------
+
+    // Tests ------------------------------------------------------------------
+
+    bool
+    test_lines ()
+    noexcept
+    {
+        start_test("test_lines");
+
+        std::filesystem::path file_path{"../../test_data/test_lines.txt"};
+        write_file(
+            file_path,
+            u8"first line\n"
+            u8"windows line\r\n"
+            u8"\n"
+            u8"héllo 日本語 \U0001F600\n"
+            u8"last"
+        );
+        std::vector<std::u8string> expected_lines{
+            u8"first line",
+            u8"windows line",
+            u8"",
+            u8"héllo 日本語 \U0001F600",
+            u8"last"
+        };
+
+        /*
+            Small buffers make lines straddle refills.
+        */
+        for (std::size_t capacity : {1, 3, 16, 4096}) {
+            file f{file_path, read_only, if_not_there::fail, capacity};
+            text_input_stream<file> tis{f, utf8};
+            std::vector<std::u8string> read_lines;
+            for (std::u8string_view line : lines(tis)) {
+                read_lines.emplace_back(line);
+            }
+            if (read_lines != expected_lines) {
+                std::cout << "The lines read with a buffer capacity of "
+                          << capacity << " are not the lines expected."
+                          << std::endl;
+
+                return false;
+            }
+        }
+        std::filesystem::remove(file_path);
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_tokens ()
+    noexcept
+    {
+        start_test("test_tokens");
+
+        std::filesystem::path file_path{"../../test_data/test_tokens.txt"};
+        write_file(
+            file_path,
+            u8"  alpha beta\t\tgamma\r\n"
+            u8"délta \U0001F600\n\n"
+            u8"  last  "
+        );
+        std::vector<std::u8string> expected_tokens{
+            u8"alpha",
+            u8"beta",
+            u8"gamma",
+            u8"délta",
+            u8"\U0001F600",
+            u8"last"
+        };
+
+        for (std::size_t capacity : {1, 3, 16, 4096}) {
+            file f{file_path, read_only, if_not_there::fail, capacity};
+            text_input_stream<file> tis{f, utf8};
+            std::vector<std::u8string> read_tokens;
+            for (std::u8string_view token : tokens(tis)) {
+                read_tokens.emplace_back(token);
+            }
+            if (read_tokens != expected_tokens) {
+                std::cout << "The tokens read with a buffer capacity of "
+                          << capacity << " are not the tokens expected."
+                          << std::endl;
+
+                return false;
+            }
+        }
+        std::filesystem::remove(file_path);
+
+        end_stage();
+
+        /*
+            Tokens can be separated by any ASCII characters, and they're
+            read from other encoding forms too.
+        */
+        opaque_u16string_input_resource resource{u"1,22,,333\n4444"};
+        text_input_stream tis{resource, utf16, std::endian::native};
+        std::vector<std::u8string> read_tokens;
+        for (std::u8string_view token : tokens(tis, u8",\n")) {
+            read_tokens.emplace_back(token);
+        }
+        if (
+            read_tokens
+                != std::vector<std::u8string>{
+                       u8"1", u8"22", u8"333", u8"4444"
+                   }
+        ) {
+            std::cout << "The tokens read from UTF-16 with custom "
+                         "delimiters are not the tokens expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        try {
+            opaque_u8string_input_resource u8_resource{u8"a b"};
+            text_input_stream u8_tis{u8_resource, utf8};
+            u8_tis.read_token(u8"é");
+            std::cout << "A delimiter that is not an ASCII character "
+                         "was not reported."
+                      << std::endl;
+
+            return false;
+        } catch (const std::invalid_argument&) {
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_ranges_with_algorithms ()
+    noexcept
+    {
+        start_test("test_ranges_with_algorithms");
+
+        opaque_u8string_input_resource resource{
+            u8"ok 1\nerror 2\nok 3\nerror 4\nerror 5\n"
+        };
+        text_input_stream tis{resource, utf8};
+        auto error_count{std::ranges::count_if(
+            lines(tis),
+            [] (std::u8string_view line) {
+                return line.starts_with(u8"error");
+            }
+        )};
+        if (error_count != 3) {
+            std::cout << "Counting lines with a standard algorithm "
+                         "did not give the count expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        opaque_u8string_input_resource token_resource{u8"a b stop c d"};
+        text_input_stream token_tis{token_resource, utf8};
+        auto token_view{
+            tokens(token_tis)
+                | std::views::take_while([] (std::u8string_view token) {
+                      return token != u8"stop";
+                  })
+        };
+        std::size_t token_count{0};
+        for (std::u8string_view token : token_view) {
+            static_cast<void>(token);
+            ++token_count;
+        }
+        if (token_count != 2) {
+            std::cout << "Taking tokens with a view adaptor "
+                         "did not give the count expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    return cmp::text_ranges_test_module{}.run_tests();
+} // function -----------------------------------------------------------------
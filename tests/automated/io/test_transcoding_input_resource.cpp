@@ -0,0 +1,358 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cmp/core/test_module.hpp>
+#include <cmp/io/file.hpp>
+#include <cmp/io/opaque_container_input_resource.hpp>
+#include <cmp/io/text_input_stream.hpp>
+#include <cmp/io/transcoding_input_resource.hpp>
+
+namespace cmp {
+
+class transcoding_input_resource_test_module
+    : public test_module<transcoding_input_resource_test_module>
+{
+public:
+    transcoding_input_resource_test_module ()
+    noexcept
+        : test_module({
+              &transcoding_input_resource_test_module
+                  :: test_detect_encoding,
+
+              &transcoding_input_resource_test_module
+                  :: test_told_encoding,
+
+              &transcoding_input_resource_test_module
+                  :: test_read_across_refills,
+
+              &transcoding_input_resource_test_module
+                  :: test_report_errors
+          })
+    {
+    } // function -------------------------------------------------------------
+
+    // Test Tooling -----------------------------------------------------------
+
+    /*
+        Encodes the given code points in the given encoding form and
+        endianness, starting with a BOM if asked to.
+    */
+    static
+    std::vector<std::byte>
+    encode (
+        const std::u32string& code_points,
+        encoding_form encoding,
+        std::endian endianness,
+        bool has_bom
+    ) {
+        std::u32string text{code_points};
+        if (has_bom) {
+            text.insert(text.begin(), U'\uFEFF');
+        }
+        auto to_bytes = [endianness] (const auto& code_units) {
+            using code_unit_type = typename std::remove_cvref_t<
+                decltype(code_units)
+            >::value_type;
+            std::vector<std::byte> bytes(
+                code_units.size() * sizeof (code_unit_type)
+            );
+            std::memcpy(bytes.data(), code_units.data(), bytes.size());
+            if (endianness != std::endian::native) {
+                invert_endianness_of_elements(
+                    bytes.data(),
+                    sizeof (code_unit_type),
+                    code_units.size()
+                );
+            }
+            return bytes;
+        };
+        switch (encoding) {
+            case utf8:
+                return to_bytes(to_u8string(text));
+            case utf16:
+                return to_bytes(to_u16string(text));
+            case utf32:
+                return to_bytes(text);
+        }
+        return {};
+    } // function -------------------------------------------------------------
+
+    static
+    std::u32string
+    make_content ()
+    {
+        std::u32string content;
+        for (int i{0}; i < 300; ++i) {
+            content += U"héllo 日本語 \U0001F600 text\n";
+        }
+        return content;
+    } // function -------------------------------------------------------------
+
+    // Tests ------------------------------------------------------------------
+
+    bool
+    test_detect_encoding ()
+    noexcept
+    {
+        start_test("test_detect_encoding");
+
+        std::u32string content{make_content()};
+        std::u8string expected{to_u8string(content)};
+        struct case_type {
+            encoding_form encoding;
+            std::endian endianness;
+            bool has_bom;
+        };
+        for (auto [encoding, endianness, has_bom] : {
+            case_type{utf8, std::endian::big, false},
+            case_type{utf8, std::endian::big, true},
+            case_type{utf16, std::endian::little, true},
+            case_type{utf16, std::endian::big, true},
+            case_type{utf32, std::endian::little, true},
+            case_type{utf32, std::endian::big, true}
+        }) {
+            opaque_blob_input_resource source{
+                encode(content, encoding, endianness, has_bom)
+            };
+            transcoding_input_resource resource{source};
+            if (
+                resource.get_source_encoding_form() != encoding
+                    || (
+                           encoding != utf8
+                               && resource.get_source_endianness()
+                                   != endianness
+                       )
+            ) {
+                std::cout << "The encoding form or the endianness of the "
+                             "source was not detected correctly."
+                          << std::endl;
+
+                return false;
+            }
+            text_input_stream tis{resource, utf8};
+            std::u8string text;
+            tis.read_all(text);
+            if (text != expected) {
+                std::cout << "The text read from the source is not the "
+                             "text expected."
+                          << std::endl;
+
+                return false;
+            }
+
+            end_stage();
+        }
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_told_encoding ()
+    noexcept
+    {
+        start_test("test_told_encoding");
+
+        std::u32string content{make_content()};
+        opaque_blob_input_resource source{
+            encode(content, utf16, std::endian::little, false)
+        };
+        transcoding_input_resource resource{
+            source,
+            utf16,
+            std::endian::little
+        };
+        text_input_stream tis{resource, utf8};
+        std::u32string text;
+        tis.read_all(text);
+        if (text != content) {
+            std::cout << "The text read from the source is not the "
+                         "text expected."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        /*
+            A BOM isn't skipped when the encoding form is told.
+        */
+        opaque_blob_input_resource source_with_bom{
+            encode(U"A", utf32, std::endian::big, true)
+        };
+        transcoding_input_resource resource_with_bom{source_with_bom, utf32};
+        text_input_stream tis_with_bom{resource_with_bom, utf8};
+        tis_with_bom.read_all(text);
+        if (text != U"\uFEFFA") {
+            std::cout << "The BOM was not kept when the encoding form "
+                         "was told."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_read_across_refills ()
+    noexcept
+    {
+        start_test("test_read_across_refills");
+
+        std::filesystem::path file_path{
+            "../../test_data/test_transcoding_across_refills.txt"
+        };
+        std::u32string content{make_content()};
+        std::u8string expected_text{to_u8string(content)};
+
+        /*
+            Tiny buffers in the file and in the transcoding input resource
+            split code units, surrogate pairs and UTF-8 sequences at every
+            possible place, and with no buffer at all the transcoding input
+            resource is read a byte at a time.
+        */
+        for (encoding_form encoding : {utf16, utf32}) {
+            std::vector<std::byte> bytes{
+                encode(content, encoding, std::endian::big, true)
+            };
+            if (std::filesystem::exists(file_path)) {
+                std::filesystem::remove(file_path);
+            }
+            {
+                file f{file_path, write_only, if_not_there::create};
+                f.write(bytes.data(), bytes.size());
+            }
+            for (std::size_t file_capacity : {1, 3, 4096}) {
+                for (std::size_t capacity : {0, 1, 3, 5, 1024}) {
+                    file f{
+                        file_path,
+                        read_only,
+                        if_not_there::fail,
+                        file_capacity
+                    };
+                    transcoding_input_resource resource{f, capacity};
+                    text_input_stream tis{resource, utf8};
+                    std::u8string lines;
+                    std::u8string line;
+                    while (!tis.is_at_end()) {
+                        tis.read_line(line);
+                        lines += line;
+                        lines += u8'\n';
+                    }
+                    if (lines != expected_text) {
+                        std::cout << "The lines read with buffer capacities "
+                                  << "of " << file_capacity << " and "
+                                  << capacity << " are not the lines "
+                                  << "expected."
+                                  << std::endl;
+
+                        return false;
+                    }
+                }
+            }
+
+            end_stage();
+        }
+        std::filesystem::remove(file_path);
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_report_errors ()
+    noexcept
+    {
+        start_test("test_report_errors");
+
+        /*
+            A lone surrogate is invalid UTF-16.
+        */
+        try {
+            std::vector<std::byte> bytes{
+                encode(U"ab", utf16, std::endian::little, true)
+            };
+            bytes.push_back(std::byte{0x00});
+            bytes.push_back(std::byte{0xDC});
+            opaque_blob_input_resource invalid_source{bytes};
+            transcoding_input_resource resource{invalid_source};
+            text_input_stream tis{resource, utf8};
+            std::u8string text;
+            tis.read_all(text);
+            std::cout << "A lone surrogate was not reported." << std::endl;
+
+            return false;
+        } catch (const invalid_unicode_encoding&) {
+        }
+
+        end_stage();
+
+        /*
+            A code point past the last one is invalid UTF-32.
+        */
+        try {
+            std::vector<std::byte> bytes{
+                encode(U"ab", utf32, std::endian::little, true)
+            };
+            bytes.insert(bytes.end(), {
+                std::byte{0x00}, std::byte{0x00},
+                std::byte{0x11}, std::byte{0x00}
+            });
+            opaque_blob_input_resource source{bytes};
+            transcoding_input_resource resource{source};
+            text_input_stream tis{resource, utf8};
+            std::u8string text;
+            tis.read_all(text);
+            std::cout << "An invalid code point was not reported."
+                      << std::endl;
+
+            return false;
+        } catch (const invalid_code_point&) {
+        }
+
+        end_stage();
+
+        /*
+            A code unit or a surrogate pair cut short at the end is
+            reported as a read past the end.
+        */
+        for (std::size_t extra_byte_count : {1, 3}) {
+            try {
+                std::vector<std::byte> bytes{
+                    encode(U"ab\U0001F600", utf16, std::endian::big, true)
+                };
+                bytes.resize(bytes.size() - extra_byte_count);
+                opaque_blob_input_resource source{bytes};
+                transcoding_input_resource resource{source};
+                text_input_stream tis{resource, utf8};
+                std::u8string text;
+                tis.read_all(text);
+                std::cout << "A truncated code unit was not reported."
+                          << std::endl;
+
+                return false;
+            } catch (const read_past_end&) {
+            }
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+}; // class -------------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    return cmp::transcoding_input_resource_test_module{}.run_tests();
+} // function -----------------------------------------------------------------
@@ -1,6 +1,13 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <cmp/core/test_module.hpp>
 #include <cmp/unicode/algorithms.hpp>
 
@@ -26,11 +33,340 @@ public:
                   :: test_prepend_code_point,
 
               &algorithms_test_module
-                  :: test_validate_string
+                  :: test_validate_string,
+
+              &algorithms_test_module
+                  :: test_validation_kernels,
+
+              &algorithms_test_module
+                  :: test_transcoding,
+
+              &algorithms_test_module
+                  :: test_transcoding_kernels
           })
     {
     } // function -------------------------------------------------------------
 
+    // Test Tooling -----------------------------------------------------------
+
+    template <
+        typename CodeUnit
+    >
+    using kernel = std::size_t (*)(const CodeUnit*, std::size_t) noexcept;
+
+    template <
+        typename CodeUnit
+    >
+    struct named_kernel {
+        const char* name;
+        kernel<CodeUnit> function;
+    };
+
+    /**
+        Description:
+            Returns where by_code_point finds the given string to stop
+            being valid, the way validate_string did before it used the
+            validation kernels.
+    */
+    template <
+        typename CodeUnit
+    >
+    typename by_code_point<CodeUnit>::const_iterator
+    find_invalid_by_code_point (
+        std::basic_string_view<CodeUnit> s
+    ) {
+        by_code_point<CodeUnit> bcp_range{s};
+        auto bcp_iterator{bcp_range.cbegin()};
+        try {
+            while (bcp_iterator != bcp_range.cend()) {
+                if (*bcp_iterator > maximum_code_point) {
+                    return bcp_iterator;
+                }
+                ++bcp_iterator;
+            }
+        } catch (const invalid_unicode_encoding& ex) {
+        } catch (const iterated_past_end& ex) {
+        }
+        return bcp_iterator;
+    } // function -------------------------------------------------------------
+
+    std::vector<named_kernel<char8_t>>
+    get_utf8_kernels ()
+    {
+        std::vector<named_kernel<char8_t>> kernels{
+            {"scalar", &impl::find_invalid_utf8_scalar}
+        };
+#if defined(CMP_ARCHITECTURE_X86)
+        if (impl::is_sse4_supported()) {
+            kernels.push_back({"SSE4.1", &impl::find_invalid_utf8_sse4});
+        }
+        if (impl::is_avx2_supported()) {
+            kernels.push_back({"AVX2", &impl::find_invalid_utf8_avx2});
+        }
+#endif // CMP_ARCHITECTURE_X86
+        return kernels;
+    } // function -------------------------------------------------------------
+
+    std::vector<named_kernel<char16_t>>
+    get_utf16_kernels ()
+    {
+        std::vector<named_kernel<char16_t>> kernels{
+            {"scalar", &impl::find_invalid_utf16_scalar}
+        };
+#if defined(CMP_ARCHITECTURE_X86)
+        if (impl::is_sse4_supported()) {
+            kernels.push_back({"SSE4.1", &impl::find_invalid_utf16_sse4});
+        }
+        if (impl::is_avx2_supported()) {
+            kernels.push_back({"AVX2", &impl::find_invalid_utf16_avx2});
+        }
+#endif // CMP_ARCHITECTURE_X86
+        return kernels;
+    } // function -------------------------------------------------------------
+
+    /**
+        Description:
+            Checks that every kernel and validate_string stop where
+            by_code_point does on the given string, and prints the
+            string if one of them doesn't.
+    */
+    template <
+        typename CodeUnit
+    >
+    bool
+    check_kernels (
+        const std::vector<named_kernel<CodeUnit>>& kernels,
+        const std::basic_string<CodeUnit>& s
+    ) {
+        std::basic_string_view<CodeUnit> view{s};
+        auto expected{find_invalid_by_code_point(view)};
+        bool is_correct{validate_string(s) == expected};
+        for (const auto& k : kernels) {
+            auto offset{k.function(s.data(), s.size())};
+            auto found{typename by_code_point<CodeUnit>::const_iterator{
+                view.cbegin() + static_cast<std::ptrdiff_t>(offset),
+                view.cend()
+            }};
+            if (offset > s.size() || found != expected) {
+                std::cout << "The " << k.name << " kernel disagreed with "
+                             "by_code_point on where this string becomes "
+                             "invalid:";
+                is_correct = false;
+                break;
+            }
+        }
+        if (!is_correct) {
+            for (CodeUnit code_unit : s) {
+                std::cout << ' ' << std::hex
+                          << static_cast<unsigned>(code_unit) << std::dec;
+            }
+            std::cout << std::endl;
+        }
+        return is_correct;
+    } // function -------------------------------------------------------------
+
+    /**
+        Description:
+            Encodes the given code points one at a time with
+            append_code_point, which doesn't go through the transcoding
+            engine.
+    */
+    template <
+        typename OutputString
+    >
+    OutputString
+    encode_code_points (
+        const std::u32string& code_points
+    ) {
+        OutputString result;
+        for (char32_t code_point : code_points) {
+            append_code_point(result, code_point);
+        }
+        return result;
+    } // function -------------------------------------------------------------
+
+    /**
+        Description:
+            Checks that converting the given code points from one string
+            type to another with convert_string, transcoded_size and
+            transcode_into gives what append_code_point does.
+    */
+    template <
+        typename InputString,
+        typename OutputString
+    >
+    bool
+    check_transcoding (
+        const std::u32string& code_points
+    ) {
+        using output_code_unit_type = typename OutputString::value_type;
+
+        InputString input{encode_code_points<InputString>(code_points)};
+        OutputString expected{encode_code_points<OutputString>(code_points)};
+
+        if (convert_string<OutputString>(input) != expected) {
+            std::cout << "convert_string didn't give the expected string."
+                      << std::endl;
+
+            return false;
+        }
+
+        std::size_t expected_size{expected.size()};
+        if (transcoded_size<output_code_unit_type>(input) != expected_size) {
+            std::cout << "transcoded_size didn't give the size of the "
+                         "expected string."
+                      << std::endl;
+
+            return false;
+        }
+
+        OutputString output(expected.size() + 1, output_code_unit_type{'!'});
+        std::size_t output_size{
+            transcode_into(input, std::span<output_code_unit_type>{output})
+        };
+        if (
+            output_size != expected.size()
+                || output.substr(0, output_size) != expected
+                || output.back() != output_code_unit_type{'!'}
+        ) {
+            std::cout << "transcode_into didn't write the expected string."
+                      << std::endl;
+
+            return false;
+        }
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    template <
+        typename InputString
+    >
+    bool
+    check_transcoding_to_all (
+        const std::u32string& code_points
+    ) {
+        return check_transcoding<InputString, std::u8string>(code_points)
+            && check_transcoding<InputString, std::u16string>(code_points)
+            && check_transcoding<InputString, std::u32string>(code_points)
+            && check_transcoding<InputString, std::wstring>(code_points);
+    } // function -------------------------------------------------------------
+
+    /**
+        Description:
+            Checks that the given fast run kernel transcodes whole blocks
+            up to the first of the given code units that it can't take,
+            and copies their values over.
+    */
+    template <
+        typename InputCodeUnit,
+        typename OutputCodeUnit
+    >
+    bool
+    check_fast_run (
+        const char* kernel_name,
+        std::size_t (*kernel)(
+            const InputCodeUnit*,
+            std::size_t,
+            OutputCodeUnit*
+        ) noexcept,
+        const std::basic_string<InputCodeUnit>& input,
+        std::size_t fast_size
+    ) {
+        std::basic_string<OutputCodeUnit> output(input.size(), 0);
+        std::size_t run_size{
+            kernel(input.data(), input.size(), output.data())
+        };
+        bool is_correct{run_size <= fast_size && fast_size - run_size < 32};
+        for (std::size_t i{0}; is_correct && i < run_size; ++i) {
+            is_correct = static_cast<char32_t>(output[i])
+                == static_cast<char32_t>(input[i]);
+        }
+        if (!is_correct) {
+            std::cout << "The " << kernel_name << " kernel transcoded "
+                      << run_size << " code units out of a run of "
+                      << fast_size << " incorrectly."
+                      << std::endl;
+        }
+        return is_correct;
+    } // function -------------------------------------------------------------
+
+    /**
+        Description:
+            Makes a run of code units that the kernels can take, with one
+            that they can't at a random position, or none, and checks
+            every kernel for the given input and output against it.
+    */
+    template <
+        typename InputCodeUnit,
+        typename OutputCodeUnit
+    >
+    bool
+    check_fast_runs (
+        std::mt19937& generator,
+        char32_t fast_maximum,
+        InputCodeUnit slow_code_unit
+    ) {
+        auto random{[&generator] (std::size_t low, std::size_t high) {
+            return std::uniform_int_distribution<std::size_t>{
+                low,
+                high
+            }(generator);
+        }};
+
+        for (int i{0}; i < 500; ++i) {
+            std::basic_string<InputCodeUnit> input(random(0, 200), 0);
+            for (auto& code_unit : input) {
+                do {
+                    code_unit = static_cast<InputCodeUnit>(
+                        random(0, fast_maximum)
+                    );
+                } while (
+                    code_unit >= 0xD800 && code_unit <= 0xDFFF
+                );
+            }
+            std::size_t fast_size{random(0, input.size())};
+            if (fast_size < input.size()) {
+                input[fast_size] = slow_code_unit;
+            }
+
+            if (
+                !check_fast_run<InputCodeUnit, OutputCodeUnit>(
+                    "dispatched",
+                    &impl::transcode_fast_run,
+                    input,
+                    fast_size
+                )
+            ) {
+                return false;
+            }
+#if defined(CMP_ARCHITECTURE_X86)
+            if (
+                impl::is_sse4_supported()
+                    && !check_fast_run<InputCodeUnit, OutputCodeUnit>(
+                           "SSE4.1",
+                           &impl::transcode_fast_run_sse4,
+                           input,
+                           fast_size
+                       )
+            ) {
+                return false;
+            }
+            if (
+                impl::is_avx2_supported()
+                    && !check_fast_run<InputCodeUnit, OutputCodeUnit>(
+                           "AVX2",
+                           &impl::transcode_fast_run_avx2,
+                           input,
+                           fast_size
+                       )
+            ) {
+                return false;
+            }
+#endif // CMP_ARCHITECTURE_X86
+        }
+        return true;
+    } // function -------------------------------------------------------------
+
     // Tests ------------------------------------------------------------------
 
     bool
@@ -358,6 +694,249 @@ public:
 
         return true;
     } // function -------------------------------------------------------------
+
+    bool
+    test_validation_kernels ()
+    noexcept
+    {
+        start_test("test_validation_kernels");
+
+        /*
+            Pieces of UTF-8 that the random strings are made of, including
+            overlong sequences and encoded surrogates, which by_code_point
+            accepts, and invalid or cut off sequences.
+        */
+        const std::vector<std::u8string> utf8_pieces{
+            u8"a", u8"plain ASCII text ", u8"\n", u8"é", u8"日本", u8"✓",
+            u8"\U0001F600", u8"\U0010FFFF",
+            {0xC0, 0x80}, {0xE0, 0x80, 0x80}, {0xF0, 0x80, 0x80, 0x80},
+            {0xED, 0xA0, 0x80}, {0xF4, 0x8F, 0xBF, 0xBF},
+            {0xF4, 0x90, 0x80, 0x80}, {0xF5, 0x80, 0x80, 0x80},
+            {0xF8, 0x88, 0x80, 0x80, 0x80}, {0xFF}, {0x80}, {0xBF, 0x80},
+            {0xE2, 0x82}, {0xF0, 0x9F, 0x98}, {0xC3}
+        };
+        const std::size_t valid_utf8_piece_count{13};
+
+        const std::vector<std::u16string> utf16_pieces{
+            u"a", u"plain ASCII text ", u"é", u"日本", u"\U0001F600",
+            u"\U0010FFFF", {0xFFFF}, {0xD7FF, 0xE000},
+            {0xD800}, {0xDC00}, {0xDBFF, 0xDBFF}, {0xDFFF, 0xD800}
+        };
+        const std::size_t valid_utf16_piece_count{8};
+
+        std::mt19937 generator{20230702};
+        auto random{[&generator] (std::size_t low, std::size_t high) {
+            return std::uniform_int_distribution<std::size_t>{
+                low,
+                high
+            }(generator);
+        }};
+
+        /*
+            Strings long enough to span several blocks of every kernel,
+            mostly valid so that the errors land at all kinds of offsets.
+        */
+        auto utf8_kernels{get_utf8_kernels()};
+        for (int i{0}; i < 4000; ++i) {
+            std::u8string s;
+            std::size_t piece_count{random(0, 40)};
+            bool has_error{random(0, 1) == 0};
+            for (std::size_t j{0}; j < piece_count; ++j) {
+                std::size_t last_piece{
+                    has_error && random(0, 20) == 0
+                        ? utf8_pieces.size() - 1
+                        : valid_utf8_piece_count - 1
+                };
+                s += utf8_pieces[random(0, last_piece)];
+            }
+            if (!check_kernels<char8_t>(utf8_kernels, s)) {
+                return false;
+            }
+            for (std::size_t cut{1}; cut <= 3 && cut <= s.size(); ++cut) {
+                std::u8string prefix{s, 0, s.size() - cut};
+                if (!check_kernels<char8_t>(utf8_kernels, prefix)) {
+                    return false;
+                }
+            }
+        }
+
+        end_stage();
+
+        auto utf16_kernels{get_utf16_kernels()};
+        for (int i{0}; i < 4000; ++i) {
+            std::u16string s;
+            std::size_t piece_count{random(0, 40)};
+            bool has_error{random(0, 1) == 0};
+            for (std::size_t j{0}; j < piece_count; ++j) {
+                std::size_t last_piece{
+                    has_error && random(0, 20) == 0
+                        ? utf16_pieces.size() - 1
+                        : valid_utf16_piece_count - 1
+                };
+                s += utf16_pieces[random(0, last_piece)];
+            }
+            if (!check_kernels<char16_t>(utf16_kernels, s)) {
+                return false;
+            }
+            if (!s.empty()) {
+                std::u16string prefix{s, 0, s.size() - 1};
+                if (!check_kernels<char16_t>(utf16_kernels, prefix)) {
+                    return false;
+                }
+            }
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_transcoding ()
+    noexcept
+    {
+        start_test("test_transcoding");
+
+        std::mt19937 generator{20230709};
+        auto random{[&generator] (char32_t low, char32_t high) {
+            return std::uniform_int_distribution<char32_t>{
+                low,
+                high
+            }(generator);
+        }};
+
+        /*
+            Mostly ASCII with runs of other code points from every range,
+            long enough that the vector kernels get used.
+        */
+        for (int i{0}; i < 300; ++i) {
+            std::u32string code_points;
+            std::size_t run_count{random(0, 12)};
+            for (std::size_t j{0}; j < run_count; ++j) {
+                char32_t run_length{random(0, 70)};
+                char32_t range{random(0, 4)};
+                for (char32_t k{0}; k < run_length; ++k) {
+                    char32_t code_point;
+                    do {
+                        code_point = range == 0 ? random(0x80, 0x7FF)
+                            : range == 1 ? random(0x800, 0xFFFF)
+                            : range == 2 ? random(0x10000, 0x10FFFF)
+                            : random(0, 0x7F);
+                    } while (is_surrogate(code_point));
+                    code_points.push_back(code_point);
+                }
+            }
+            if (
+                !check_transcoding_to_all<std::u8string>(code_points)
+                    || !check_transcoding_to_all<std::u16string>(code_points)
+                    || !check_transcoding_to_all<std::u32string>(code_points)
+                    || !check_transcoding_to_all<std::wstring>(code_points)
+            ) {
+                return false;
+            }
+        }
+
+        end_stage();
+
+        std::u16string too_small(2, u'\0');
+        try {
+            transcode_into(u8"日本語", std::span<char16_t>{too_small});
+
+            std::cout << "transcode_into wrote three code points into room "
+                         "for only two."
+                      << std::endl;
+
+            return false;
+        } catch (const std::length_error& ex) {
+        }
+
+        if (too_small != std::u16string(2, u'\0')) {
+            std::cout << "transcode_into wrote to storage that was too small."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        auto throws{[] <typename Exception> (auto function) {
+            try {
+                function();
+            } catch (const Exception& ex) {
+                return true;
+            } catch (...) {
+            }
+            return false;
+        }};
+
+        if (
+            !throws.template operator()<invalid_unicode_encoding>([] {
+                return to_u16string(std::u8string{u8"valid \xFF"});
+            })
+                || !throws.template operator()<iterated_past_end>([] {
+                       return to_u32string(
+                           std::u8string{u8"cut off \xE2\x82"}
+                       );
+                   })
+                || !throws.template operator()<invalid_unicode_encoding>([] {
+                       return to_u8string(std::u16string{u"lone \xDC00"});
+                   })
+                || !throws.template operator()<iterated_past_end>([] {
+                       return to_u8string(std::u16string{u"cut off \xD83D"});
+                   })
+                || !throws.template operator()<invalid_code_point>([] {
+                       return to_u8string(std::u32string{U"\xD800"});
+                   })
+                || !throws.template operator()<invalid_code_point>([] {
+                       return to_u16string(std::u32string(1, 0x110000));
+                   })
+                || !throws.template operator()<invalid_code_point>([] {
+                       return to_u8string(std::u8string{u8"\xED\xA0\x80"});
+                   })
+        ) {
+            std::cout << "Transcoding invalid text didn't throw the "
+                         "expected exception."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_transcoding_kernels ()
+    noexcept
+    {
+        start_test("test_transcoding_kernels");
+
+        std::mt19937 generator{20230710};
+
+        if (
+            !check_fast_runs<char8_t, char16_t>(generator, 0x7F, 0xC3)
+                || !check_fast_runs<char8_t, char32_t>(generator, 0x7F, 0xE2)
+                || !check_fast_runs<char16_t, char8_t>(generator, 0x7F, 0xE9)
+                || !check_fast_runs<char16_t, char32_t>(
+                       generator,
+                       0xFFFF,
+                       0xD83D
+                   )
+                || !check_fast_runs<char32_t, char8_t>(generator, 0x7F, 0x100)
+                || !check_fast_runs<char32_t, char16_t>(
+                       generator,
+                       0xFFFF,
+                       0x1F600
+                   )
+        ) {
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
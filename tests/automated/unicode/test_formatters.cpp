@@ -1,6 +1,15 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
 #include <cmp/core/test_module.hpp>
 #include <cmp/unicode/formatters.hpp>
 
@@ -20,7 +29,16 @@ public:
                   :: test_format_integer,
 
               &formatters_test_module
-                  :: test_format_floating_point
+                  :: test_format_integer_to,
+
+              &formatters_test_module
+                  :: test_format_floating_point,
+
+              &formatters_test_module
+                  :: test_format_floating_point_notation,
+
+              &formatters_test_module
+                  :: test_format_with_constant_formats
           })
     {
     } // function -------------------------------------------------------------
@@ -172,6 +190,152 @@ public:
         return true;
     } // function -------------------------------------------------------------
 
+    bool
+    test_format_integer_to ()
+    noexcept
+    {
+        start_test("test_format_integer_to");
+
+        /*
+            Decimal digits are written two at a time, so every length
+            and both halves of the table are compared with to_chars.
+        */
+        char8_t buffer[max_formatted_integer_size_v<long long>];
+        char expected[32];
+        long long value{1};
+        for (int i{0}; i < 19; ++i) {
+            for (long long test_value : {value, value - 1, -value}) {
+                std::size_t size{
+                    format_integer_to(test_value, buffer, integer_format{})
+                };
+                auto result{
+                    std::to_chars(expected, std::end(expected), test_value)
+                };
+                std::string_view expected_text{
+                    expected,
+                    static_cast<std::size_t>(result.ptr - expected)
+                };
+                if (
+                    std::string_view{
+                        reinterpret_cast<const char*>(buffer),
+                        size
+                    } != expected_text
+                ) {
+                    std::cout << "format_integer_to did not format "
+                              << expected_text << " correctly."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+            value = value * 10 + (i % 10);
+        }
+
+        end_stage();
+
+        struct case_type {
+            long long value;
+            unsigned int radix;
+            sign_status sign;
+            thousands_separator separator;
+            std::u8string_view expected;
+        };
+        for (auto [test_value, radix, sign, separator, expected_text] : {
+            case_type{
+                std::numeric_limits<long long>::min(),
+                10,
+                sign_status::only_when_negative,
+                thousands_separator::period,
+                u8"-9.223.372.036.854.775.808"
+            },
+            case_type{
+                -255,
+                2,
+                sign_status::always_show,
+                thousands_separator::comma,
+                u8"-11,111,111"
+            },
+            case_type{
+                0xBEEF,
+                16,
+                sign_status::always_show,
+                thousands_separator::none,
+                u8"+BEEF"
+            },
+            case_type{
+                0,
+                10,
+                sign_status::always_show,
+                thousands_separator::comma,
+                u8"0"
+            },
+            case_type{
+                -1295,
+                36,
+                sign_status::only_when_negative,
+                thousands_separator::none,
+                u8"-ZZ"
+            }
+        }) {
+            std::size_t size{
+                format_integer_to(
+                    test_value,
+                    buffer,
+                    integer_format{radix, sign, separator}
+                )
+            };
+            if (std::u8string_view{buffer, size} != expected_text) {
+                std::cout << "format_integer_to did not format "
+                          << test_value << " in radix " << radix
+                          << " correctly."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        /*
+            The largest magnitude in radix 2 with separators takes up the
+            whole of the largest size.
+        */
+        char8_t largest_buffer[max_formatted_integer_size_v<std::uint64_t>];
+        std::size_t largest_size{
+            format_integer_to(
+                std::numeric_limits<std::uint64_t>::max(),
+                largest_buffer,
+                integer_format{
+                    2,
+                    sign_status::always_show,
+                    thousands_separator::comma
+                }
+            )
+        };
+        if (largest_size != std::size(largest_buffer)) {
+            std::cout << "format_integer_to did not fill the largest size."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        try {
+            char8_t small_buffer[3]{u8'x', u8'x', u8'x'};
+            format_integer_to(1234, small_buffer, integer_format{});
+            std::cout << "A target that is too small was not reported."
+                      << std::endl;
+
+            return false;
+        } catch (const std::length_error&) {
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
     bool
     test_format_floating_point ()
     noexcept
@@ -382,6 +546,403 @@ public:
 
         return true;
     } // function -------------------------------------------------------------
+
+    bool
+    test_format_floating_point_notation ()
+    noexcept
+    {
+        start_test("test_format_floating_point_notation");
+
+        /*
+            Values spread over the whole range of double are compared
+            with to_chars, in scientific notation and, while fixed
+            notation doesn't need more digits than the shortest ones, in
+            shortest notation.
+        */
+        floating_point_format scientific_format;
+        scientific_format.set_notation(floating_point_notation::scientific);
+        floating_point_format shortest_format;
+        shortest_format.set_notation(floating_point_notation::shortest);
+        char expected[64];
+        std::uint64_t state{12345};
+        for (int i{0}; i < 100000; ++i) {
+            state = state * 6364136223846793005 + 1442695040888963407;
+            double test_value;
+            std::memcpy(&test_value, &state, sizeof (test_value));
+            if (!std::isfinite(test_value)) {
+                continue;
+            }
+            auto result{
+                std::to_chars(
+                    expected,
+                    std::end(expected),
+                    test_value,
+                    std::chars_format::scientific
+                )
+            };
+            std::string_view expected_text{
+                expected,
+                static_cast<std::size_t>(result.ptr - expected)
+            };
+            std::string text{
+                format_floating_point<std::string>(
+                    test_value,
+                    scientific_format
+                )
+            };
+            if (text != expected_text) {
+                std::cout << "format_floating_point did not format "
+                          << expected_text << " correctly."
+                          << std::endl;
+
+                return false;
+            }
+            test_value = std::ldexp(
+                static_cast<double>(state >> 40),
+                static_cast<int>(state % 48) - 40
+            );
+            result = std::to_chars(expected, std::end(expected), test_value);
+            expected_text = std::string_view{
+                expected,
+                static_cast<std::size_t>(result.ptr - expected)
+            };
+            text = format_floating_point<std::string>(
+                test_value,
+                shortest_format
+            );
+            if (text != expected_text) {
+                std::cout << "format_floating_point did not format "
+                          << expected_text << " correctly."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        /*
+            Rounding to a number of places is compared with to_chars as
+            well, on values whose shortest digits are fewer than the ones
+            asked for, so that they would be rounded twice if they were
+            rounded from the shortest digits.
+        */
+        floating_point_format rounded_format;
+        rounded_format.set_radix_place_limit(radix_place_limit::exactly_equal);
+        for (int i{0}; i < 100000; ++i) {
+            state = state * 6364136223846793005 + 1442695040888963407;
+            double test_value{
+                std::ldexp(
+                    static_cast<double>(state >> 11),
+                    static_cast<int>(state % 64) - 60
+                )
+            };
+            auto place_count{static_cast<int>((state >> 6) % 24)};
+            bool is_scientific{(state & (1 << 12)) != 0};
+            auto result{
+                std::to_chars(
+                    expected,
+                    std::end(expected),
+                    test_value,
+                    is_scientific
+                        ? std::chars_format::scientific
+                        : std::chars_format::fixed,
+                    place_count
+                )
+            };
+            std::string_view expected_text{
+                expected,
+                static_cast<std::size_t>(result.ptr - expected)
+            };
+            rounded_format.set_notation(
+                is_scientific
+                    ? floating_point_notation::scientific
+                    : floating_point_notation::fixed
+            );
+            rounded_format.set_radix_place_count(
+                static_cast<unsigned int>(place_count)
+            );
+            std::string text{
+                format_floating_point<std::string>(
+                    test_value,
+                    rounded_format
+                )
+            };
+            if (text != expected_text) {
+                std::cout << "format_floating_point did not format "
+                          << expected_text << " correctly."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        struct case_type {
+            double value;
+            floating_point_notation notation;
+            radix_place_limit limit;
+            unsigned int place_count;
+            thousands_separator separator;
+            std::u8string_view expected;
+        };
+        for (
+            auto [
+                test_value,
+                notation,
+                limit,
+                place_count,
+                separator,
+                expected_text
+            ] : {
+                case_type{
+                    0.1,
+                    floating_point_notation::fixed,
+                    radix_place_limit::none,
+                    0,
+                    thousands_separator::none,
+                    u8"0.1"
+                },
+                case_type{
+                    1e21,
+                    floating_point_notation::fixed,
+                    radix_place_limit::none,
+                    0,
+                    thousands_separator::comma,
+                    u8"1,000,000,000,000,000,000,000"
+                },
+                case_type{
+                    1e300,
+                    floating_point_notation::shortest,
+                    radix_place_limit::none,
+                    0,
+                    thousands_separator::none,
+                    u8"1e+300"
+                },
+                case_type{
+                    -123456.789,
+                    floating_point_notation::scientific,
+                    radix_place_limit::none,
+                    0,
+                    thousands_separator::none,
+                    u8"-1.23456789e+05"
+                },
+                case_type{
+                    1234567.0078125,
+                    floating_point_notation::fixed,
+                    radix_place_limit::none,
+                    0,
+                    thousands_separator::comma,
+                    u8"1,234,567.007,812,5"
+                },
+                case_type{
+                    2.675,
+                    floating_point_notation::fixed,
+                    radix_place_limit::up_to,
+                    2,
+                    thousands_separator::none,
+                    u8"2.67"
+                },
+                case_type{
+                    2.5,
+                    floating_point_notation::fixed,
+                    radix_place_limit::up_to,
+                    0,
+                    thousands_separator::none,
+                    u8"2"
+                },
+                case_type{
+                    9.9996,
+                    floating_point_notation::fixed,
+                    radix_place_limit::up_to,
+                    3,
+                    thousands_separator::none,
+                    u8"10"
+                },
+                case_type{
+                    1000000000000000.25,
+                    floating_point_notation::fixed,
+                    radix_place_limit::exactly_equal,
+                    2,
+                    thousands_separator::none,
+                    u8"1000000000000000.25"
+                },
+                case_type{
+                    278077623150832.84375,
+                    floating_point_notation::fixed,
+                    radix_place_limit::up_to,
+                    3,
+                    thousands_separator::none,
+                    u8"278077623150832.844"
+                },
+                case_type{
+                    0.0004,
+                    floating_point_notation::fixed,
+                    radix_place_limit::exactly_equal,
+                    2,
+                    thousands_separator::none,
+                    u8"0.00"
+                },
+                case_type{
+                    99999.5,
+                    floating_point_notation::scientific,
+                    radix_place_limit::exactly_equal,
+                    2,
+                    thousands_separator::none,
+                    u8"1.00e+05"
+                },
+                case_type{
+                    0,
+                    floating_point_notation::scientific,
+                    radix_place_limit::none,
+                    0,
+                    thousands_separator::none,
+                    u8"0e+00"
+                },
+                case_type{
+                    -std::numeric_limits<double>::infinity(),
+                    floating_point_notation::fixed,
+                    radix_place_limit::none,
+                    0,
+                    thousands_separator::none,
+                    u8"-inf"
+                },
+                case_type{
+                    std::numeric_limits<double>::quiet_NaN(),
+                    floating_point_notation::shortest,
+                    radix_place_limit::none,
+                    0,
+                    thousands_separator::none,
+                    u8"nan"
+                }
+            }
+        ) {
+            floating_point_format f;
+            f.set_notation(notation);
+            f.set_radix_place_limit(limit);
+            f.set_radix_place_count(place_count);
+            f.set_thousands_separator(separator);
+            std::u8string text{
+                format_floating_point<std::u8string>(test_value, f)
+            };
+            if (text != expected_text) {
+                std::cout << "format_floating_point did not format "
+                          << test_value << " correctly."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        floating_point_format f;
+        f.set_notation(floating_point_notation::shortest);
+        if (
+            format_floating_point<std::u32string>(0.1F, f) != U"0.1"
+                || format_floating_point<std::u32string>(0.1L, f) != U"0.1"
+                || format_floating_point<std::u32string>(1e-7F, f)
+                    != U"1e-07"
+        ) {
+            std::cout << "format_floating_point did not format "
+                         "float or long double values correctly."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_format_with_constant_formats ()
+    noexcept
+    {
+        start_test("test_format_with_constant_formats");
+
+        constexpr integer_format separated_format{
+            10,
+            sign_status::always_show,
+            thousands_separator::comma
+        };
+        constexpr integer_format hexadecimal_format{
+            16,
+            sign_status::only_when_negative,
+            thousands_separator::none
+        };
+        std::uint64_t state{12345};
+        for (int i{0}; i < 10000; ++i) {
+            state = state * 6364136223846793005 + 1442695040888963407;
+            auto test_value{static_cast<long long>(state >> (state % 64))};
+            if (i % 2 == 0) {
+                test_value = -test_value;
+            }
+            char8_t buffer[max_formatted_integer_size_v<long long>];
+            std::size_t size{
+                format_integer_to<hexadecimal_format>(test_value, buffer)
+            };
+            if (
+                format_integer<std::u8string, separated_format>(test_value)
+                    != format_integer<std::u8string>(
+                        test_value,
+                        separated_format
+                    )
+                    || std::u8string_view{buffer, size}
+                        != format_integer<std::u8string>(
+                            test_value,
+                            hexadecimal_format
+                        )
+            ) {
+                std::cout << "format_integer did not format "
+                          << test_value
+                          << " the same with a constant format."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        constexpr floating_point_format rounded_format{
+            10,
+            sign_status::only_when_negative,
+            thousands_separator::comma,
+            radix_character::period,
+            radix_place_limit::exactly_equal,
+            2
+        };
+        if (
+            format_integer<
+                std::u32string,
+                integer_format{
+                    10,
+                    sign_status::only_when_negative,
+                    thousands_separator::none
+                }
+            >(-1234567) != U"-1234567"
+                || format_floating_point<std::u8string, rounded_format>(
+                    1234.5
+                ) != u8"1,234.50"
+                || format_floating_point<
+                    std::u8string,
+                    floating_point_format{}
+                >(-0.25F) != u8"-0.25"
+        ) {
+            std::cout << "format_integer or format_floating_point did not "
+                         "format with a constant format correctly."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -1,6 +1,14 @@
 // Copyright (C) 2022 Daniel T. McGinnis
 // SPDX-License-Identifier: BSL-1.0
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
 #include <cmp/core/test_module.hpp>
 #include <cmp/unicode/parsers.hpp>
 
@@ -20,7 +28,16 @@ public:
                   :: test_parse_integer,
 
               &parsers_test_module
-                  :: test_parse_floating_point
+                  :: test_parse_decimal_integer,
+
+              &parsers_test_module
+                  :: test_parse_floating_point,
+
+              &parsers_test_module
+                  :: test_parse_floating_point_exactly,
+
+              &parsers_test_module
+                  :: test_parse_with_constant_formats
           })
     {
     } // function -------------------------------------------------------------
@@ -387,6 +404,191 @@ public:
         return true;
     } // function -------------------------------------------------------------
 
+    bool
+    test_parse_decimal_integer ()
+    noexcept
+    {
+        start_test("test_parse_decimal_integer");
+
+        /*
+            Integers of every length, some of them with leading zeros or
+            too large for the type, have to read back the way from_chars
+            reads them, including when it finds them out of range.
+        */
+        char text[64];
+        std::uint64_t state{12345};
+        for (int i{0}; i < 100000; ++i) {
+            state = state * 6364136223846793005 + 1442695040888963407;
+            std::uint64_t magnitude{state >> (state % 64)};
+            char* begin{text};
+            if (i % 3 == 0) {
+                *begin++ = '-';
+            }
+            if (i % 7 == 0) {
+                begin = std::fill_n(begin, i % 23, '0');
+            }
+            char* end{std::to_chars(begin, std::end(text), magnitude).ptr};
+            if (i % 11 == 0) {
+                end = std::fill_n(end, 1 + i % 3, '9');
+            }
+            std::u8string test_text{
+                reinterpret_cast<const char8_t*>(text),
+                static_cast<std::size_t>(end - text)
+            };
+
+            long long signed_value;
+            auto signed_result{std::from_chars(text, end, signed_value)};
+            unsigned long long unsigned_value;
+            auto unsigned_result{std::from_chars(text, end, unsigned_value)};
+            if (
+                (signed_result.ec == std::errc{}
+                    ? !expect_successful_integer_parse<long long>(
+                        test_text,
+                        integer_format{},
+                        signed_value
+                    )
+                    : !expect_failed_integer_parse<long long>(
+                        test_text,
+                        integer_format{},
+                        parse_failed::type::out_of_range
+                    ))
+                    || (text[0] != '-'
+                        && (unsigned_result.ec == std::errc{}
+                            ? !expect_successful_integer_parse<
+                                unsigned long long
+                            >(
+                                test_text,
+                                integer_format{},
+                                unsigned_value
+                            )
+                            : !expect_failed_integer_parse<
+                                unsigned long long
+                            >(
+                                test_text,
+                                integer_format{},
+                                parse_failed::type::out_of_range
+                            )))
+            ) {
+                std::cout << "parse_integer did not read "
+                          << std::string{text, end} << " correctly."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        integer_format f;
+        if (
+            !expect_successful_integer_parse<long long>(
+                u8"-9223372036854775808",
+                f,
+                std::numeric_limits<long long>::min()
+            )
+                || !expect_successful_integer_parse<unsigned long long>(
+                    u8"18446744073709551615",
+                    f,
+                    std::numeric_limits<unsigned long long>::max()
+                )
+                || !expect_successful_integer_parse<signed char>(
+                    u8"-128",
+                    f,
+                    -128
+                )
+                || !expect_successful_integer_parse<int>(
+                    u8"0000000000000000000000000042",
+                    f,
+                    42
+                )
+                || !expect_successful_integer_parse<int>(u8"-0", f, 0)
+                || !expect_failed_integer_parse<long long>(
+                    u8"9223372036854775808",
+                    f,
+                    parse_failed::type::out_of_range
+                )
+                || !expect_failed_integer_parse<unsigned long long>(
+                    u8"18446744073709551616",
+                    f,
+                    parse_failed::type::out_of_range
+                )
+                || !expect_failed_integer_parse<signed char>(
+                    u8"-129",
+                    f,
+                    parse_failed::type::out_of_range
+                )
+                || !expect_failed_integer_parse<unsigned short>(
+                    u8"65536",
+                    f,
+                    parse_failed::type::out_of_range
+                )
+        ) {
+            std::cout << "parse_integer did not read the limits "
+                         "of its output types correctly."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        if (
+            parse_integer<int>(u"-1234567890", f) != -1234567890
+                || parse_integer<long long>(U"123456789012", f)
+                    != 123456789012
+                || parse_integer<int>(std::u8string_view{u8"77 ", 2}, f)
+                    != 77
+        ) {
+            std::cout << "parse_integer did not read "
+                         "UTF-16, UTF-32 or a view correctly."
+                      << std::endl;
+
+            return false;
+        }
+        if (
+            !expect_failed_integer_parse<long long>(
+                u8"1234567a9012",
+                f,
+                parse_failed::type::digit_character_expected
+            )
+                || !expect_failed_integer_parse<int>(
+                    u8"1,234",
+                    f,
+                    parse_failed::type::digit_character_expected
+                )
+                || !expect_failed_integer_parse<int>(
+                    u8"+5",
+                    f,
+                    parse_failed::type::digit_character_expected
+                )
+                || !expect_failed_integer_parse<int>(
+                    u8"-",
+                    f,
+                    parse_failed::type::digit_character_expected
+                )
+                || !expect_failed_integer_parse<unsigned int>(
+                    u8"-12345678",
+                    f,
+                    parse_failed::type::negative_unsigned
+                )
+                || !expect_failed_integer_parse<long long>(
+                    u8"99999999999999999999x",
+                    f,
+                    parse_failed::type::digit_character_expected
+                )
+        ) {
+            std::cout << "parse_integer did not reject "
+                         "malformed input correctly."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
     bool
     test_parse_floating_point ()
     noexcept
@@ -663,6 +865,262 @@ public:
 
         return true;
     } // function -------------------------------------------------------------
+
+    bool
+    test_parse_floating_point_exactly ()
+    noexcept
+    {
+        start_test("test_parse_floating_point_exactly");
+
+        /*
+            Values spread over the whole range of double and float are
+            written with to_chars, both with their shortest digits and
+            with more digits than the significand keeps, and have to read
+            back as the same bits as from_chars gives.
+        */
+        char text[64];
+        std::uint64_t state{12345};
+        for (int i{0}; i < 100000; ++i) {
+            state = state * 6364136223846793005 + 1442695040888963407;
+            double test_value;
+            std::memcpy(&test_value, &state, sizeof (test_value));
+            if (!std::isfinite(test_value)) {
+                continue;
+            }
+            for (int precision : {-1, 24}) {
+                auto result{
+                    precision < 0
+                        ? std::to_chars(text, std::end(text), test_value)
+                        : std::to_chars(
+                            text,
+                            std::end(text),
+                            test_value,
+                            std::chars_format::scientific,
+                            precision
+                        )
+                };
+                double expected_value;
+                std::from_chars(text, result.ptr, expected_value);
+                /*
+                    Values out of the range of float aren't read by
+                    from_chars, so only double is checked for them.
+                */
+                float float_expected_value;
+                bool is_float_value{
+                    std::from_chars(text, result.ptr, float_expected_value).ec
+                        == std::errc{}
+                };
+                std::u8string test_text{
+                    reinterpret_cast<const char8_t*>(text),
+                    static_cast<std::size_t>(result.ptr - text)
+                };
+                if (
+                    !expect_successful_floating_point_parse<double>(
+                        test_text,
+                        floating_point_format{},
+                        expected_value
+                    )
+                        || (is_float_value
+                            && !expect_successful_floating_point_parse<float>(
+                                test_text,
+                                floating_point_format{},
+                                float_expected_value
+                            ))
+                ) {
+                    std::cout << "parse_floating_point did not read "
+                              << text << " exactly."
+                              << std::endl;
+
+                    return false;
+                }
+            }
+        }
+
+        end_stage();
+
+        struct case_type {
+            std::u8string_view text;
+            double expected_value;
+        };
+        for (
+            auto [test_text, expected_value] : {
+                case_type{u8"9007199254740993", 9007199254740992.0},
+                case_type{
+                    u8"9007199254740993.00000000000000000000000001",
+                    9007199254740994.0
+                },
+                case_type{
+                    u8"2.4703282292062327208828439643411068618252990130716"
+                    u8"2382212e-324",
+                    0.0
+                },
+                case_type{
+                    u8"2.4703282292062327208828439643411068618252990130716"
+                    u8"2382213e-324",
+                    std::numeric_limits<double>::denorm_min()
+                },
+                case_type{
+                    u8"1.7976931348623158e308",
+                    std::numeric_limits<double>::max()
+                },
+                case_type{u8"1e400", std::numeric_limits<double>::infinity()},
+                case_type{u8"-1e-400", -0.0},
+                case_type{u8"-5.5", -5.5},
+                case_type{u8"-0.25", -0.25},
+                case_type{u8"2.5E-3", 0.0025},
+                case_type{u8"-inf", -std::numeric_limits<double>::infinity()}
+            }
+        ) {
+            if (
+                !expect_successful_floating_point_parse<double>(
+                    std::u8string{test_text},
+                    floating_point_format{},
+                    expected_value
+                )
+            ) {
+                std::cout << "parse_floating_point did not read "
+                          << std::string{test_text.begin(), test_text.end()}
+                          << " correctly."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        floating_point_format f;
+        f.set_thousands_separator(thousands_separator::comma);
+        if (
+            !expect_successful_floating_point_parse<double>(
+                u8"-1,234,567.125",
+                f,
+                -1234567.125
+            )
+                || parse_floating_point<double>(u"1,024.5e1", f) != 10245.0
+                || parse_floating_point<float>(U"0.125", f) != 0.125F
+                || !std::isnan(parse_floating_point<double>(u8"nan", f))
+        ) {
+            std::cout << "parse_floating_point did not read "
+                         "separators, UTF-16, UTF-32 or NaN correctly."
+                      << std::endl;
+
+            return false;
+        }
+        if (
+            !expect_failed_floating_point_parse<double>(
+                u8"1234.5",
+                f,
+                parse_failed::type::thousands_separator_missing
+            )
+                || !expect_failed_floating_point_parse<double>(
+                    u8"12,34",
+                    f,
+                    parse_failed::type::thousands_separator_missing
+                )
+                || !expect_failed_floating_point_parse<double>(
+                    u8"1.5e",
+                    f,
+                    parse_failed::type::digit_character_expected
+                )
+                || !expect_failed_floating_point_parse<double>(
+                    u8"--1",
+                    f,
+                    parse_failed::type::multiple_signs
+                )
+        ) {
+            std::cout << "parse_floating_point did not reject "
+                         "malformed input correctly."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
+
+    bool
+    test_parse_with_constant_formats ()
+    noexcept
+    {
+        start_test("test_parse_with_constant_formats");
+
+        constexpr integer_format signed_format{
+            10,
+            sign_status::always_show,
+            thousands_separator::none
+        };
+        constexpr integer_format octal_format{
+            8,
+            sign_status::always_show,
+            thousands_separator::comma
+        };
+        constexpr floating_point_format separated_format{
+            10,
+            sign_status::only_when_negative,
+            thousands_separator::comma,
+            radix_character::period,
+            radix_place_limit::none,
+            0
+        };
+        try {
+            if (
+                parse_integer<int, signed_format>(std::u8string{u8"+42"})
+                    != 42
+                    || parse_integer<int, octal_format>(u"-2,317") != -1231
+                    || parse_integer<
+                        unsigned long long,
+                        integer_format{}
+                    >(U"18446744073709551615")
+                        != std::numeric_limits<unsigned long long>::max()
+                    || parse_floating_point<double, separated_format>(
+                        std::u8string_view{u8"-1,234.5"}
+                    ) != -1234.5
+                    || parse_floating_point<float, floating_point_format{}>(
+                        U"0.125"
+                    ) != 0.125F
+            ) {
+                std::cout << "parse_integer or parse_floating_point did "
+                             "not parse with a constant format correctly."
+                          << std::endl;
+
+                return false;
+            }
+        } catch (const parse_failed&) {
+            std::cout << "parse_integer or parse_floating_point failed "
+                         "with a constant format."
+                      << std::endl;
+
+            return false;
+        }
+
+        end_stage();
+
+        try {
+            parse_integer<int, integer_format{}>(std::u8string{u8"+5"});
+            std::cout << "parse_integer accepted a sign that the "
+                         "constant format doesn't allow."
+                      << std::endl;
+
+            return false;
+        } catch (const parse_failed& ex) {
+            if (
+                ex.get_type() != parse_failed::type::digit_character_expected
+            ) {
+                std::cout << "parse_integer did not reject a sign that the "
+                             "constant format doesn't allow correctly."
+                          << std::endl;
+
+                return false;
+            }
+        }
+
+        end_stage();
+
+        return true;
+    } // function -------------------------------------------------------------
 }; // class -------------------------------------------------------------------
 
 } // namespace ----------------------------------------------------------------
@@ -0,0 +1,162 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <cmp/io/async_file.hpp>
+#include <cmp/io/file.hpp>
+
+/*
+    This benchmark reads many files in fixed-size chunks, once one chunk
+    after another through file, and once with all the chunks of all the
+    files queued through a single io_ring, and reports the time taken.
+    With the files in the page cache, the difference mostly reflects the
+    number of system calls made.
+*/
+
+#if defined(CMP_OS_LINUX_BASED)
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_directory{"benchmark_async_file"};
+constexpr std::size_t file_count{256};
+constexpr std::size_t file_size{256 * 1024};
+constexpr std::size_t chunk_size{16 * 1024};
+
+std::filesystem::path
+get_file_path (
+    std::size_t index
+) {
+    return benchmark_directory / ("file_" + std::to_string(index) + ".bin");
+} // function -----------------------------------------------------------------
+
+void
+create_files ()
+{
+    std::filesystem::create_directory(benchmark_directory);
+    std::vector<std::byte> content(file_size, std::byte{'c'});
+    for (std::size_t i{0}; i < file_count; ++i) {
+        file f{get_file_path(i), write_only, if_not_there::create};
+        f.write(content.data(), content.size());
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    typename Function
+>
+void
+run (
+    const char* label,
+    Function function
+) {
+    auto start{std::chrono::steady_clock::now()};
+    std::size_t byte_count{function()};
+    auto end{std::chrono::steady_clock::now()};
+    std::chrono::duration<double, std::milli> elapsed{end - start};
+
+    std::cout << std::left << std::setw(16) << label
+              << std::right << std::setw(14) << byte_count
+              << std::fixed << std::setprecision(1)
+              << std::setw(12) << elapsed.count()
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    cmp::create_files();
+
+    std::cout << std::left << std::setw(16) << "method"
+              << std::right
+              << std::setw(14) << "bytes"
+              << std::setw(12) << "ms"
+              << std::endl;
+
+    cmp::run("file", [] {
+        std::vector<std::byte> chunk(cmp::chunk_size);
+        std::size_t byte_count{0};
+        for (std::size_t i{0}; i < cmp::file_count; ++i) {
+            cmp::file f{
+                cmp::get_file_path(i),
+                cmp::read_only,
+                cmp::if_not_there::fail
+            };
+            while (!f.is_at_end()) {
+                byte_count += f.read(chunk.data(), chunk.size());
+            }
+        }
+        return byte_count;
+    });
+
+    cmp::run("async_file", [] {
+        cmp::io_ring ring{256};
+        std::vector<cmp::async_file> files;
+        files.reserve(cmp::file_count);
+        std::vector<std::byte> chunks(cmp::file_count * cmp::chunk_size);
+        std::size_t byte_count{0};
+        for (std::size_t i{0}; i < cmp::file_count; ++i) {
+            files.emplace_back(
+                ring,
+                cmp::get_file_path(i),
+                cmp::read_only,
+                cmp::if_not_there::fail
+            );
+        }
+
+        /*
+            Each file keeps one chunk in flight and
+            queues the next one as soon as it completes.
+        */
+        std::function<void (std::size_t)> read_next{
+            [&] (std::size_t i) {
+                auto chunk{
+                    std::span{chunks}.subspan(
+                        i * cmp::chunk_size,
+                        cmp::chunk_size
+                    )
+                };
+                files[i].read(chunk, [&, i] (std::int64_t result) {
+                    if (result > 0) {
+                        byte_count += result;
+                        read_next(i);
+                    }
+                });
+            }
+        };
+        for (std::size_t i{0}; i < cmp::file_count; ++i) {
+            read_next(i);
+        }
+        ring.drain();
+        return byte_count;
+    });
+
+    std::filesystem::remove_all(cmp::benchmark_directory);
+
+    return 0;
+} // function -----------------------------------------------------------------
+
+#else
+
+int
+main ()
+{
+    std::cout << "Async files are only available on Linux-based systems."
+              << std::endl;
+
+    return 0;
+} // function -----------------------------------------------------------------
+
+#endif // CMP_OS_LINUX_BASED
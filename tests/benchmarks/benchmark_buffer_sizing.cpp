@@ -0,0 +1,236 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cmp/io/file.hpp>
+#include <cmp/io/transparent_container_input_resource.hpp>
+#include <cmp/io/uio.hpp>
+
+#if defined(CMP_OS_UNIX_LIKE)
+#   include <unistd.h>
+#endif
+
+/*
+    This benchmark reads the same content in small records from a file,
+    from standard input fed by a pipe, and from a container, with a sweep
+    of fixed buffer capacities and with an adaptive buffer that starts at
+    the default capacity, and reports the throughput of each in MiB/s.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{"benchmark_buffer_sizing.bin"};
+constexpr std::size_t content_size{32 << 20};
+constexpr std::size_t record_size{100};
+constexpr std::size_t fixed_capacities[] = {
+    256,
+    1024,
+    4096,
+    16384,
+    65536,
+    262144
+};
+
+std::vector<std::byte>
+make_content ()
+{
+    std::vector<std::byte> content(content_size);
+    for (std::size_t i{0}; i < content.size(); ++i) {
+        content[i] = static_cast<std::byte>(i * 31 + i / 97);
+    }
+    return content;
+} // function -----------------------------------------------------------------
+
+template <
+    typename Resource
+>
+std::size_t
+read_records (
+    Resource& resource
+) {
+    std::byte record[record_size];
+    std::size_t byte_count{0};
+    std::size_t bytes_read;
+    do {
+        bytes_read = resource.read(record, record_size);
+        byte_count += bytes_read;
+    } while (bytes_read > 0 && byte_count < content_size);
+    return byte_count;
+} // function -----------------------------------------------------------------
+
+template <
+    typename Function
+>
+void
+run (
+    const char* resource_name,
+    const std::string& capacity_name,
+    Function function
+) {
+    auto start{std::chrono::steady_clock::now()};
+    std::size_t byte_count{function()};
+    auto end{std::chrono::steady_clock::now()};
+    std::chrono::duration<double> elapsed{end - start};
+
+    std::cout << std::left << std::setw(12) << resource_name
+              << std::right << std::setw(12) << capacity_name
+              << std::fixed << std::setprecision(1)
+              << std::setw(12) << byte_count / elapsed.count() / (1 << 20)
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+void
+run_file (
+    std::size_t capacity,
+    buffer_sizing sizing
+) {
+    run(
+        "file",
+        sizing == buffer_sizing::adaptive
+            ? "adaptive" : std::to_string(capacity),
+        [capacity, sizing] {
+            file f{
+                benchmark_file_path,
+                read_only,
+                if_not_there::fail,
+                capacity
+            };
+            f.set_buffer_sizing(sizing);
+            return read_records(f);
+        }
+    );
+} // function -----------------------------------------------------------------
+
+#if defined(CMP_OS_UNIX_LIKE)
+
+void
+run_stdin (
+    const std::vector<std::byte>& content,
+    std::size_t capacity,
+    buffer_sizing sizing
+) {
+    /*
+        Standard input is replaced with the read end of a pipe that
+        another thread keeps writing the content to.
+    */
+    int pipe_descriptors[2];
+    if (::pipe(pipe_descriptors) == -1) {
+        return;
+    }
+    int saved_stdin{::dup(STDIN_FILENO)};
+    ::dup2(pipe_descriptors[0], STDIN_FILENO);
+    ::close(pipe_descriptors[0]);
+    std::thread writer{[&content, descriptor = pipe_descriptors[1]] {
+        std::size_t offset{0};
+        while (offset < content.size()) {
+            ssize_t bytes_written{::write(
+                descriptor,
+                content.data() + offset,
+                content.size() - offset
+            )};
+            if (bytes_written <= 0) {
+                break;
+            }
+            offset += bytes_written;
+        }
+        ::close(descriptor);
+    }};
+
+    run(
+        "stdin",
+        sizing == buffer_sizing::adaptive
+            ? "adaptive" : std::to_string(capacity),
+        [capacity, sizing] {
+            stdin_resource resource{capacity};
+            resource.set_buffer_sizing(sizing);
+            return read_records(resource);
+        }
+    );
+
+    writer.join();
+    ::dup2(saved_stdin, STDIN_FILENO);
+    ::close(saved_stdin);
+} // function -----------------------------------------------------------------
+
+#endif // CMP_OS_UNIX_LIKE
+
+void
+run_container (
+    const std::vector<std::byte>& content,
+    std::size_t capacity,
+    buffer_sizing sizing
+) {
+    run(
+        "container",
+        sizing == buffer_sizing::adaptive
+            ? "adaptive" : std::to_string(capacity),
+        [&content, capacity, sizing] {
+            transparent_container_input_resource<std::vector<std::byte>>
+                resource{content, capacity};
+            resource.set_buffer_sizing(sizing);
+            return read_records(resource);
+        }
+    );
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    std::vector<std::byte> content{cmp::make_content()};
+    {
+        cmp::file f{
+            cmp::benchmark_file_path,
+            cmp::write_only,
+            cmp::if_not_there::create
+        };
+        f.write(content.data(), content.size());
+    }
+
+    std::cout << std::left << std::setw(12) << "resource"
+              << std::right
+              << std::setw(12) << "capacity"
+              << std::setw(12) << "MiB/s"
+              << std::endl;
+
+    constexpr std::size_t adaptive_capacity{
+        cmp::io_buffer::default_buffer_capacity
+    };
+    for (std::size_t capacity : cmp::fixed_capacities) {
+        cmp::run_file(capacity, cmp::buffer_sizing::fixed);
+    }
+    cmp::run_file(adaptive_capacity, cmp::buffer_sizing::adaptive);
+
+#if defined(CMP_OS_UNIX_LIKE)
+    for (std::size_t capacity : cmp::fixed_capacities) {
+        cmp::run_stdin(content, capacity, cmp::buffer_sizing::fixed);
+    }
+    cmp::run_stdin(content, adaptive_capacity, cmp::buffer_sizing::adaptive);
+#endif // CMP_OS_UNIX_LIKE
+
+    for (std::size_t capacity : cmp::fixed_capacities) {
+        cmp::run_container(content, capacity, cmp::buffer_sizing::fixed);
+    }
+    cmp::run_container(
+        content,
+        adaptive_capacity,
+        cmp::buffer_sizing::adaptive
+    );
+
+    std::filesystem::remove(cmp::benchmark_file_path);
+
+    return 0;
+} // function -----------------------------------------------------------------
@@ -0,0 +1,139 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cmp/io/file.hpp>
+#include <cmp/io/text_input_stream.hpp>
+#include <cmp/io/text_output_stream.hpp>
+
+/*
+    This benchmark reads and writes UTF-16 text in the native endianness
+    and in the other one, where every code unit has its bytes reversed,
+    and reports the throughput of each in MiB/s next to that of copying
+    the same bytes with memcpy.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{
+    "benchmark_byte_swapping.txt"
+};
+constexpr std::size_t line_count{400'000};
+constexpr std::size_t buffer_capacity{64 * 1024};
+
+constexpr std::endian other_endianness{
+    std::endian::native == std::endian::little
+        ? std::endian::big
+        : std::endian::little
+};
+
+std::u16string
+make_content ()
+{
+    std::u16string content;
+    for (std::size_t i{0}; i < line_count; ++i) {
+        content += u"2023-06-01T12:00:00Z INFO worker-";
+        content += static_cast<char16_t>(u'0' + i % 10);
+        content += i % 8 == 0
+            ? u" résumé upload ✓ 日本\n"
+            : u" request served in 12 ms, status 200\n";
+    }
+    return content;
+} // function -----------------------------------------------------------------
+
+void
+report (
+    const char* operation_name,
+    std::size_t byte_count,
+    std::chrono::duration<double> elapsed
+) {
+    std::cout << std::left << std::setw(24) << operation_name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << byte_count / elapsed.count() / (1 << 20)
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+void
+run_write (
+    const char* operation_name,
+    const std::u16string& content,
+    std::endian endianness
+) {
+    if (std::filesystem::exists(benchmark_file_path)) {
+        std::filesystem::remove(benchmark_file_path);
+    }
+    file f{
+        benchmark_file_path,
+        write_only,
+        if_not_there::create,
+        buffer_capacity
+    };
+    text_output_stream<file> tos{f, utf16, endianness};
+
+    auto start{std::chrono::steady_clock::now()};
+    tos << content;
+    tos.flush();
+    auto end{std::chrono::steady_clock::now()};
+    report(operation_name, content.size() * 2, end - start);
+} // function -----------------------------------------------------------------
+
+void
+run_read (
+    const char* operation_name,
+    std::size_t byte_count,
+    std::endian endianness
+) {
+    file f{
+        benchmark_file_path,
+        read_only,
+        if_not_there::fail,
+        buffer_capacity
+    };
+    text_input_stream<file> tis{f, utf16, endianness};
+
+    auto start{std::chrono::steady_clock::now()};
+    std::u16string text;
+    tis.read_all(text);
+    auto end{std::chrono::steady_clock::now()};
+    report(operation_name, byte_count, end - start);
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    std::u16string content{cmp::make_content()};
+    std::size_t byte_count{content.size() * 2};
+
+    std::cout << std::left << std::setw(24) << "operation"
+              << std::right
+              << std::setw(12) << "MiB/s"
+              << std::endl;
+
+    std::vector<char16_t> copy(content.size());
+    auto start{std::chrono::steady_clock::now()};
+    std::memcpy(copy.data(), content.data(), byte_count);
+    auto end{std::chrono::steady_clock::now()};
+    cmp::report("memcpy", byte_count + copy[0] * 0, end - start);
+
+    cmp::run_write("write native", content, std::endian::native);
+    cmp::run_read("read_all native", byte_count, std::endian::native);
+    cmp::run_write("write swapped", content, cmp::other_endianness);
+    cmp::run_read("read_all swapped", byte_count, cmp::other_endianness);
+
+    std::filesystem::remove(cmp::benchmark_file_path);
+
+    return 0;
+} // function -----------------------------------------------------------------
@@ -0,0 +1,134 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <string>
+
+#include <cmp/io/transparent_container_input_resource.hpp>
+
+/*
+    This benchmark counts the line feeds in an in-memory string, first
+    by walking a plain std::span over it and then through a transparent
+    container input resource, both by reading chunks and by peeking at
+    its content. The container resources serve reads straight from their
+    content, so the numbers for them should stay close to the plain walk.
+*/
+
+namespace cmp {
+
+namespace {
+
+constexpr std::size_t megabyte_count{64};
+constexpr std::size_t chunk_size{4096};
+constexpr std::size_t run_count{5};
+
+std::u8string
+create_content ()
+{
+    const std::u8string line{
+        u8"The quick brown fox jumps over the lazy dog 0123456789.\n"
+    };
+    std::u8string content;
+    content.reserve(megabyte_count * 1024 * 1024 + line.size());
+    while (content.size() < megabyte_count * 1024 * 1024) {
+        content += line;
+    }
+    return content;
+} // function -----------------------------------------------------------------
+
+std::size_t
+count_line_feeds (
+    std::span<const std::byte> bytes
+)
+noexcept
+{
+    return static_cast<std::size_t>(
+        std::count(bytes.begin(), bytes.end(), std::byte{'\n'})
+    );
+} // function -----------------------------------------------------------------
+
+template <
+    typename Function
+>
+void
+run (
+    const char* label,
+    std::size_t byte_count,
+    Function function
+) {
+    /*
+        We keep the best of a few runs so that a
+        stray hiccup doesn't skew the comparison.
+    */
+    using duration_type = std::chrono::duration<double>;
+
+    std::size_t line_count{0};
+    duration_type elapsed{duration_type::max()};
+    for (std::size_t i{0}; i < run_count; ++i) {
+        auto start{std::chrono::steady_clock::now()};
+        line_count = function();
+        auto end{std::chrono::steady_clock::now()};
+        elapsed = std::min<duration_type>(elapsed, end - start);
+    }
+
+    double megabytes{static_cast<double>(byte_count) / (1024 * 1024)};
+
+    std::cout << std::left << std::setw(16) << label
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << megabytes / elapsed.count()
+              << std::setw(12) << line_count
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    const std::u8string content{cmp::create_content()};
+    const std::span<const std::byte> content_bytes{
+        reinterpret_cast<const std::byte*>(content.data()),
+        content.size()
+    };
+
+    std::cout << std::left << std::setw(16) << "method"
+              << std::right
+              << std::setw(12) << "MB/s"
+              << std::setw(12) << "lines"
+              << std::endl;
+
+    cmp::run("span walk", content.size(), [&] () {
+        return cmp::count_line_feeds(content_bytes);
+    });
+
+    cmp::run("read chunks", content.size(), [&] () {
+        cmp::transparent_u8string_input_resource resource{content};
+        std::byte chunk[cmp::chunk_size];
+        std::size_t line_count{0};
+        std::size_t bytes_read;
+        while ((bytes_read = resource.read(chunk, cmp::chunk_size)) > 0) {
+            line_count += cmp::count_line_feeds({chunk, bytes_read});
+        }
+        return line_count;
+    });
+
+    cmp::run("peek_view", content.size(), [&] () {
+        cmp::transparent_u8string_input_resource resource{content};
+        std::size_t line_count{0};
+        while (!resource.is_at_end()) {
+            auto view{resource.peek_view(1)};
+            auto chunk{view.first(std::min(view.size(), cmp::chunk_size))};
+            line_count += cmp::count_line_feeds(chunk);
+            resource.consume(chunk.size());
+        }
+        return line_count;
+    });
+
+    return 0;
+} // function -----------------------------------------------------------------
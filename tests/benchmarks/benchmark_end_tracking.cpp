@@ -0,0 +1,108 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <cmp/io/file.hpp>
+#include <cmp/io/text_input_stream.hpp>
+
+#include "syscall_counter.hpp"
+
+/*
+    This benchmark reads a text file line by line and reports how many
+    system calls were made per megabyte read, for each of the end
+    tracking modes of cmp::file. Reading lines asks the file whether
+    it's at its end once per code point, which is what used to make
+    the number of system calls grow with the number of characters.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{"benchmark_end_tracking.txt"};
+constexpr std::size_t megabyte_count{16};
+
+void
+create_benchmark_file ()
+{
+    std::ofstream output{benchmark_file_path, std::ios::binary};
+    const std::string line{
+        "The quick brown fox jumps over the lazy dog 0123456789.\n"
+    };
+    std::size_t bytes_written{0};
+    while (bytes_written < megabyte_count * 1024 * 1024) {
+        output << line;
+        bytes_written += line.size();
+    }
+} // function -----------------------------------------------------------------
+
+void
+run (
+    const char* label,
+    end_tracking tracking
+) {
+    file f{benchmark_file_path, read_only, if_not_there::fail};
+    f.set_end_tracking(tracking);
+    text_input_stream<file> tis{f, utf8};
+
+    reset_syscall_counts();
+    auto start{std::chrono::steady_clock::now()};
+
+    std::size_t line_count{0};
+    std::u8string line;
+    while (!tis.is_at_end()) {
+        tis.read_line(line);
+        ++line_count;
+    }
+
+    auto end{std::chrono::steady_clock::now()};
+    syscall_counts counts{get_syscall_counts()};
+    double megabytes{static_cast<double>(f.get_position()) / (1024 * 1024)};
+    std::chrono::duration<double, std::milli> elapsed{end - start};
+
+    std::cout << std::left << std::setw(10) << label
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << counts.get_total() / megabytes
+              << std::setw(12) << counts.reads / megabytes
+              << std::setw(12) << counts.seeks / megabytes
+              << std::setw(12) << counts.stats / megabytes
+              << std::setw(12) << elapsed.count()
+              << std::setw(10) << line_count
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    if (!cmp::is_syscall_counting_available()) {
+        std::cout << "System calls can't be counted on this platform."
+                  << std::endl;
+    }
+
+    cmp::create_benchmark_file();
+
+    std::cout << std::left << std::setw(10) << "mode"
+              << std::right
+              << std::setw(12) << "syscalls/MB"
+              << std::setw(12) << "reads/MB"
+              << std::setw(12) << "seeks/MB"
+              << std::setw(12) << "stats/MB"
+              << std::setw(12) << "ms"
+              << std::setw(10) << "lines"
+              << std::endl;
+
+    cmp::run("cached", cmp::end_tracking::cached);
+    cmp::run("growing", cmp::end_tracking::growing);
+
+    std::filesystem::remove(cmp::benchmark_file_path);
+    return 0;
+} // function -----------------------------------------------------------------
@@ -0,0 +1,146 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <cmp/io/file.hpp>
+
+#include "syscall_counter.hpp"
+
+/*
+    This benchmark reads a file through cmp::file in a few different
+    access patterns and reports how many system calls each pattern makes
+    per buffer refill. Ideally a refill costs exactly one read and asking
+    for the position costs nothing.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{"benchmark_file_syscalls.bin"};
+constexpr std::size_t file_size{16 * 1024 * 1024};
+constexpr std::size_t buffer_capacity{4096};
+
+void
+create_benchmark_file ()
+{
+    std::ofstream output{benchmark_file_path, std::ios::binary};
+    std::string block(buffer_capacity, 'x');
+    for (std::size_t i{0}; i < file_size / buffer_capacity; ++i) {
+        output << block;
+    }
+} // function -----------------------------------------------------------------
+
+template <
+    typename Function
+>
+void
+run (
+    const char* label,
+    Function function
+) {
+    file f{
+        benchmark_file_path,
+        read_only,
+        if_not_there::fail,
+        buffer_capacity
+    };
+
+    reset_syscall_counts();
+    auto start{std::chrono::steady_clock::now()};
+    function(f);
+    auto end{std::chrono::steady_clock::now()};
+
+    syscall_counts counts{get_syscall_counts()};
+    double refills{
+        static_cast<double>(counts.reads == 0 ? 1 : counts.reads)
+    };
+    std::chrono::duration<double, std::milli> elapsed{end - start};
+
+    std::cout << std::left << std::setw(24) << label
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << counts.reads
+              << std::setw(10) << counts.seeks
+              << std::setw(10) << counts.stats
+              << std::setw(14) << counts.get_total() / refills
+              << std::setw(12) << std::setprecision(1) << elapsed.count()
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    if (!cmp::is_syscall_counting_available()) {
+        std::cout << "System calls can't be counted on this platform."
+                  << std::endl;
+    }
+
+    cmp::create_benchmark_file();
+
+    std::cout << std::left << std::setw(24) << "pattern"
+              << std::right
+              << std::setw(10) << "reads"
+              << std::setw(10) << "seeks"
+              << std::setw(10) << "stats"
+              << std::setw(14) << "calls/refill"
+              << std::setw(12) << "ms"
+              << std::endl;
+
+    cmp::run("sequential bytes", [] (cmp::file& f) {
+        std::byte b;
+        while (f.read(&b, 1) == 1) {
+        }
+    });
+
+    cmp::run("sequential + position", [] (cmp::file& f) {
+        std::byte b;
+        std::int64_t sum{0};
+        while (f.read(&b, 1) == 1) {
+            sum += f.get_position();
+        }
+        static_cast<void>(sum);
+    });
+
+    cmp::run("peek and consume", [] (cmp::file& f) {
+        while (!f.peek_view(64).empty()) {
+            f.consume(64);
+        }
+    });
+
+    cmp::run("short hops forward", [] (cmp::file& f) {
+        std::byte data[16];
+        while (f.read(data, 16) == 16) {
+            f.go_forward(48);
+        }
+    });
+
+    cmp::run("random seeks", [] (cmp::file& f) {
+        std::mt19937 generator{1};
+        std::uniform_int_distribution<std::int64_t> distribution{
+            0,
+            cmp::file_size - 1
+        };
+        std::byte data[64];
+        for (std::size_t i{0}; i < 20000; ++i) {
+            f.set_position(
+                distribution(generator),
+                cmp::position_reference::begin
+            );
+            f.read(data, 64);
+        }
+    });
+
+    std::filesystem::remove(cmp::benchmark_file_path);
+    return 0;
+} // function -----------------------------------------------------------------
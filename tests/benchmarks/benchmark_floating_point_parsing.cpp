@@ -0,0 +1,194 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <cmp/io/file.hpp>
+#include <cmp/io/text_input_stream.hpp>
+#include <cmp/unicode/parsers.hpp>
+
+/*
+    This benchmark writes a CSV file of four columns of floating-point
+    values, like the prices and coordinates of a market data export,
+    with 5 million rows unless another count is given as the argument.
+    It reads the fields back with read_token and parses them with
+    parse_floating_point, with parse_floating_point on their UTF-32
+    transcoding, and with std::from_chars for reference. It reports the
+    throughput of each in millions of values per second and in MiB/s.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{
+    "benchmark_floating_point_parsing.csv"
+};
+
+constexpr std::size_t column_count{4};
+
+// A buffer this large keeps the reads from the file out of the way of the
+// parsing.
+constexpr std::size_t buffer_capacity{64 * 1024};
+
+std::size_t
+write_content (
+    std::size_t row_count
+) {
+    file f{benchmark_file_path, write_only, if_not_there::create};
+    std::size_t byte_count{0};
+    std::string chunk;
+    char field[64];
+    unsigned long long state{12345};
+    for (std::size_t i{0}; i < row_count; ++i) {
+        /*
+            The columns are a price with two decimal places, a quantity
+            with up to six, and a latitude and a longitude with their
+            shortest round-trip digits.
+        */
+        for (std::size_t column{0}; column < column_count; ++column) {
+            state = state * 6364136223846793005 + 1442695040888963407;
+            double fraction{static_cast<double>(state >> 11) / (1ULL << 53)};
+            std::to_chars_result result;
+            switch (column) {
+                case 0:
+                    result = std::to_chars(
+                        field,
+                        std::end(field),
+                        fraction * 5000,
+                        std::chars_format::fixed,
+                        2
+                    );
+                    break;
+                case 1:
+                    result = std::to_chars(
+                        field,
+                        std::end(field),
+                        fraction * 100,
+                        std::chars_format::fixed,
+                        static_cast<int>(state % 7)
+                    );
+                    break;
+                default:
+                    result = std::to_chars(
+                        field,
+                        std::end(field),
+                        fraction * 360 - 180
+                    );
+                    break;
+            }
+            chunk.append(field, result.ptr);
+            chunk += column + 1 == column_count ? '\n' : ',';
+        }
+        if (chunk.size() >= (1 << 20)) {
+            f.write(
+                reinterpret_cast<const std::byte*>(chunk.data()),
+                chunk.size()
+            );
+            byte_count += chunk.size();
+            chunk.clear();
+        }
+    }
+    f.write(reinterpret_cast<const std::byte*>(chunk.data()), chunk.size());
+    return byte_count + chunk.size();
+} // function -----------------------------------------------------------------
+
+template <
+    typename Function
+>
+void
+run (
+    const char* operation_name,
+    std::size_t value_count,
+    std::size_t byte_count,
+    Function function
+) {
+    file f{
+        benchmark_file_path,
+        read_only,
+        if_not_there::fail,
+        buffer_capacity
+    };
+    text_input_stream<file> tis{f, utf8};
+
+    auto start{std::chrono::steady_clock::now()};
+    double sum{0};
+    for (std::size_t i{0}; i < value_count; ++i) {
+        sum += function(tis.read_token(u8",\n"));
+    }
+    auto end{std::chrono::steady_clock::now()};
+    std::chrono::duration<double> elapsed{end - start};
+
+    std::cout << std::left << std::setw(32) << operation_name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << value_count / elapsed.count() / 1e6
+              << std::setw(12) << byte_count / elapsed.count() / (1 << 20)
+              << std::setw(24) << sum
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main (
+    int argc,
+    char** argv
+) {
+    std::size_t row_count{5'000'000};
+    if (argc > 1) {
+        row_count = std::strtoull(argv[1], nullptr, 10);
+    }
+    std::size_t value_count{row_count * cmp::column_count};
+    std::size_t byte_count{cmp::write_content(row_count)};
+
+    std::cout << std::left << std::setw(32) << "operation"
+              << std::right
+              << std::setw(12) << "M values/s"
+              << std::setw(12) << "MiB/s"
+              << std::setw(24) << "sum"
+              << std::endl;
+
+    cmp::floating_point_format format;
+    cmp::run(
+        "parse_floating_point",
+        value_count,
+        byte_count,
+        [&] (std::u8string_view field) {
+            return cmp::parse_floating_point<double>(field, format);
+        }
+    );
+    cmp::run(
+        "u32string parse_floating_point",
+        value_count,
+        byte_count,
+        [&] (std::u8string_view field) {
+            return cmp::parse_floating_point<double>(
+                cmp::to_u32string(field),
+                format
+            );
+        }
+    );
+    cmp::run(
+        "from_chars",
+        value_count,
+        byte_count,
+        [] (std::u8string_view field) {
+            const auto* data{reinterpret_cast<const char*>(field.data())};
+            double value{0};
+            std::from_chars(data, data + field.size(), value);
+            return value;
+        }
+    );
+
+    std::filesystem::remove(cmp::benchmark_file_path);
+
+    return 0;
+} // function -----------------------------------------------------------------
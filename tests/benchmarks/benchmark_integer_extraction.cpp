@@ -0,0 +1,191 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <cmp/io/file.hpp>
+#include <cmp/io/text_input_stream.hpp>
+#include <cmp/io/text_ranges.hpp>
+
+/*
+    This benchmark writes a file of whitespace-separated integers, 100
+    million of them unless another count is given as the argument, and
+    reads them back with operator >>, with the string operator >> and
+    parse_integer the way operator >> used to read them, with the tokens
+    range and parse_integer, and with the tokens range and
+    std::from_chars for reference. It reports the throughput of each in
+    millions of integers per second and in MiB/s.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{
+    "benchmark_integer_extraction.txt"
+};
+
+// A buffer this large keeps the reads from the file out of the way of the
+// parsing.
+constexpr std::size_t buffer_capacity{64 * 1024};
+
+std::size_t
+write_content (
+    std::size_t integer_count
+) {
+    file f{benchmark_file_path, write_only, if_not_there::create};
+    std::size_t byte_count{0};
+    std::string chunk;
+    unsigned int state{12345};
+    for (std::size_t i{0}; i < integer_count; ++i) {
+        /*
+            A linear congruential generator spreads the integers over
+            every length up to ten digits, with some of them negative.
+        */
+        state = state * 1664525 + 1013904223;
+        long long value{static_cast<long long>(state >> (state % 24))};
+        if (i % 5 == 0) {
+            value = -value;
+        }
+        chunk += std::to_string(value);
+        chunk += i % 16 == 15 ? '\n' : ' ';
+        if (chunk.size() >= (1 << 20)) {
+            f.write(
+                reinterpret_cast<const std::byte*>(chunk.data()),
+                chunk.size()
+            );
+            byte_count += chunk.size();
+            chunk.clear();
+        }
+    }
+    f.write(reinterpret_cast<const std::byte*>(chunk.data()), chunk.size());
+    return byte_count + chunk.size();
+} // function -----------------------------------------------------------------
+
+template <
+    typename Function
+>
+void
+run (
+    const char* operation_name,
+    std::size_t integer_count,
+    std::size_t byte_count,
+    Function function
+) {
+    file f{
+        benchmark_file_path,
+        read_only,
+        if_not_there::fail,
+        buffer_capacity
+    };
+    text_input_stream<file> tis{f, utf8};
+
+    auto start{std::chrono::steady_clock::now()};
+    long long sum{function(tis, integer_count)};
+    auto end{std::chrono::steady_clock::now()};
+    std::chrono::duration<double> elapsed{end - start};
+
+    std::cout << std::left << std::setw(24) << operation_name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << integer_count / elapsed.count() / 1e6
+              << std::setw(12) << byte_count / elapsed.count() / (1 << 20)
+              << std::setw(24) << sum
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main (
+    int argc,
+    char** argv
+) {
+    std::size_t integer_count{100'000'000};
+    if (argc > 1) {
+        integer_count = std::strtoull(argv[1], nullptr, 10);
+    }
+    std::size_t byte_count{cmp::write_content(integer_count)};
+
+    std::cout << std::left << std::setw(24) << "operation"
+              << std::right
+              << std::setw(12) << "M ints/s"
+              << std::setw(12) << "MiB/s"
+              << std::setw(24) << "sum"
+              << std::endl;
+
+    cmp::run(
+        "operator >>",
+        integer_count,
+        byte_count,
+        [] (auto& tis, std::size_t count) {
+            long long sum{0};
+            long long value;
+            for (std::size_t i{0}; i < count; ++i) {
+                tis >> value;
+                sum += value;
+            }
+            return sum;
+        }
+    );
+    cmp::run(
+        "u8string parse_integer",
+        integer_count,
+        byte_count,
+        [] (auto& tis, std::size_t count) {
+            long long sum{0};
+            std::u8string token;
+            for (std::size_t i{0}; i < count; ++i) {
+                tis >> token;
+                sum += cmp::parse_integer<long long>(
+                    token,
+                    cmp::integer_format{}
+                );
+            }
+            return sum;
+        }
+    );
+    cmp::run(
+        "tokens parse_integer",
+        integer_count,
+        byte_count,
+        [] (auto& tis, std::size_t) {
+            long long sum{0};
+            for (std::u8string_view token : cmp::tokens(tis)) {
+                sum += cmp::parse_integer<long long>(
+                    token,
+                    cmp::integer_format{}
+                );
+            }
+            return sum;
+        }
+    );
+    cmp::run(
+        "tokens from_chars",
+        integer_count,
+        byte_count,
+        [] (auto& tis, std::size_t) {
+            long long sum{0};
+            long long value{0};
+            for (std::u8string_view token : cmp::tokens(tis)) {
+                const auto* data{
+                    reinterpret_cast<const char*>(token.data())
+                };
+                std::from_chars(data, data + token.size(), value);
+                sum += value;
+            }
+            return sum;
+        }
+    );
+
+    std::filesystem::remove(cmp::benchmark_file_path);
+
+    return 0;
+} // function -----------------------------------------------------------------
@@ -0,0 +1,198 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cmp/unicode/formatters.hpp>
+
+/*
+    This benchmark formats integers spread over every length, like the
+    values of a metrics exporter, with format_integer, with
+    format_integer_to given the format as an argument or as a template
+    argument and with std::to_chars for reference, then doubles spread
+    over a wide range with format_floating_point in each notation and
+    with std::to_chars, and reports the number of values formatted per
+    second in millions.
+*/
+
+namespace cmp {
+
+namespace {
+
+constexpr std::size_t value_count{1 << 16};
+constexpr std::size_t round_count{200};
+
+std::vector<long long>
+make_integers ()
+{
+    std::vector<long long> values;
+    values.reserve(value_count);
+    unsigned long long state{12345};
+    for (std::size_t i{0}; i < value_count; ++i) {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        auto value{static_cast<long long>(state >> (state % 60 + 1))};
+        values.push_back(i % 4 == 0 ? -value : value);
+    }
+    return values;
+} // function -----------------------------------------------------------------
+
+std::vector<double>
+make_doubles ()
+{
+    std::vector<double> values;
+    values.reserve(value_count);
+    unsigned long long state{12345};
+    for (std::size_t i{0}; i < value_count; ++i) {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        double value{
+            std::ldexp(
+                static_cast<double>(state >> 11),
+                static_cast<int>(state % 96) - 80
+            )
+        };
+        values.push_back(i % 4 == 0 ? -value : value);
+    }
+    return values;
+} // function -----------------------------------------------------------------
+
+template <
+    typename Value,
+    typename Function
+>
+void
+run (
+    const char* operation_name,
+    const std::vector<Value>& values,
+    Function function
+) {
+    std::size_t size{0};
+    auto start{std::chrono::steady_clock::now()};
+    for (std::size_t round{0}; round < round_count; ++round) {
+        for (Value value : values) {
+            size += function(value);
+        }
+    }
+    auto end{std::chrono::steady_clock::now()};
+    std::chrono::duration<double> elapsed{end - start};
+
+    std::cout << std::left << std::setw(28) << operation_name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12)
+              << values.size() * round_count / elapsed.count() / 1e6
+              << std::setw(12) << size
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    std::vector<long long> integers{cmp::make_integers()};
+    cmp::integer_format decimal_format;
+    cmp::integer_format hexadecimal_format{
+        16,
+        cmp::sign_status::only_when_negative,
+        cmp::thousands_separator::none
+    };
+    cmp::integer_format separated_format{
+        10,
+        cmp::sign_status::only_when_negative,
+        cmp::thousands_separator::comma
+    };
+
+    std::cout << std::left << std::setw(28) << "operation"
+              << std::right
+              << std::setw(12) << "M/s"
+              << std::setw(12) << "units"
+              << std::endl;
+
+    cmp::run("format_integer", integers, [&] (long long value) {
+        return cmp::format_integer<std::u8string>(
+            value,
+            decimal_format
+        ).size();
+    });
+    cmp::run("format_integer_to", integers, [&] (long long value) {
+        char8_t buffer[cmp::max_formatted_integer_size_v<long long>];
+        return cmp::format_integer_to(value, buffer, decimal_format);
+    });
+    cmp::run("format_integer_to constant", integers, [] (long long value) {
+        char8_t buffer[cmp::max_formatted_integer_size_v<long long>];
+        return cmp::format_integer_to<cmp::integer_format{}>(value, buffer);
+    });
+    cmp::run("format_integer_to radix 16", integers, [&] (long long value) {
+        char8_t buffer[cmp::max_formatted_integer_size_v<long long>];
+        return cmp::format_integer_to(value, buffer, hexadecimal_format);
+    });
+    cmp::run("format_integer_to commas", integers, [&] (long long value) {
+        char8_t buffer[cmp::max_formatted_integer_size_v<long long>];
+        return cmp::format_integer_to(value, buffer, separated_format);
+    });
+    cmp::run("std::to_chars", integers, [] (long long value) {
+        char buffer[cmp::max_formatted_integer_size_v<long long>];
+        auto result{std::to_chars(buffer, std::end(buffer), value)};
+        return static_cast<std::size_t>(result.ptr - buffer);
+    });
+    cmp::run("std::to_chars radix 16", integers, [] (long long value) {
+        char buffer[cmp::max_formatted_integer_size_v<long long>];
+        auto result{std::to_chars(buffer, std::end(buffer), value, 16)};
+        return static_cast<std::size_t>(result.ptr - buffer);
+    });
+
+    std::vector<double> doubles{cmp::make_doubles()};
+    cmp::floating_point_format shortest_format;
+    shortest_format.set_notation(cmp::floating_point_notation::shortest);
+    cmp::floating_point_format scientific_format;
+    scientific_format.set_notation(cmp::floating_point_notation::scientific);
+    cmp::floating_point_format rounded_format;
+    rounded_format.set_radix_place_limit(cmp::radix_place_limit::up_to);
+    rounded_format.set_radix_place_count(3);
+
+    cmp::run("format_floating_point", doubles, [&] (double value) {
+        return cmp::format_floating_point<std::u8string>(
+            value,
+            shortest_format
+        ).size();
+    });
+    cmp::run("format_floating_point sci", doubles, [&] (double value) {
+        return cmp::format_floating_point<std::u8string>(
+            value,
+            scientific_format
+        ).size();
+    });
+    cmp::run("format_floating_point 3dp", doubles, [&] (double value) {
+        return cmp::format_floating_point<std::u8string>(
+            value,
+            rounded_format
+        ).size();
+    });
+    cmp::run("std::to_chars double", doubles, [] (double value) {
+        char buffer[32];
+        auto result{std::to_chars(buffer, std::end(buffer), value)};
+        return static_cast<std::size_t>(result.ptr - buffer);
+    });
+    cmp::run("std::to_chars double 3dp", doubles, [] (double value) {
+        char buffer[64];
+        auto result{
+            std::to_chars(
+                buffer,
+                std::end(buffer),
+                value,
+                std::chars_format::fixed,
+                3
+            )
+        };
+        return static_cast<std::size_t>(result.ptr - buffer);
+    });
+
+    return 0;
+} // function -----------------------------------------------------------------
@@ -0,0 +1,137 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <cmp/io/file.hpp>
+
+#if defined(CMP_OS_UNIX_LIKE)
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+/*
+    This benchmark reads a file in records and does some work on each
+    record, standing in for decoding, with and without read-ahead. The
+    file is dropped from the page cache before each run where that is
+    possible, so that reading it has to wait for the disk, and the time
+    of each run is reported along with the throughput in MiB/s.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{"benchmark_read_ahead.bin"};
+constexpr std::size_t content_size{64 << 20};
+constexpr std::size_t record_size{4096};
+constexpr std::size_t buffer_capacity{1 << 18};
+constexpr std::size_t decode_rounds[] = {0, 1, 2};
+
+void
+drop_from_cache ()
+{
+#if defined(CMP_OS_UNIX_LIKE)
+    int descriptor{::open(benchmark_file_path.string().c_str(), O_RDONLY)};
+    if (descriptor != -1) {
+        ::fdatasync(descriptor);
+        ::posix_fadvise(descriptor, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(descriptor);
+    }
+#endif // CMP_OS_UNIX_LIKE
+} // function -----------------------------------------------------------------
+
+std::uint64_t
+decode (
+    const std::byte* record,
+    std::size_t byte_count,
+    std::size_t round_count
+) {
+    std::uint64_t hash{14695981039346656037ull};
+    for (std::size_t round{0}; round < round_count; ++round) {
+        for (std::size_t i{0}; i < byte_count; ++i) {
+            hash = (hash ^ static_cast<std::uint64_t>(record[i]))
+                * 1099511628211ull;
+        }
+    }
+    return hash;
+} // function -----------------------------------------------------------------
+
+void
+run (
+    read_ahead mode,
+    std::size_t round_count
+) {
+    drop_from_cache();
+
+    auto start{std::chrono::steady_clock::now()};
+    file f{
+        benchmark_file_path,
+        read_only,
+        if_not_there::fail,
+        buffer_capacity
+    };
+    f.set_read_ahead(mode);
+    std::byte record[record_size];
+    std::size_t byte_count{0};
+    std::uint64_t checksum{0};
+    std::size_t bytes_read;
+    while ((bytes_read = f.read(record, record_size)) > 0) {
+        checksum += decode(record, bytes_read, round_count);
+        byte_count += bytes_read;
+    }
+    auto end{std::chrono::steady_clock::now()};
+    std::chrono::duration<double> elapsed{end - start};
+
+    std::cout << std::left << std::setw(12)
+              << (mode == read_ahead::background ? "background" : "none")
+              << std::right << std::setw(8) << round_count
+              << std::fixed << std::setprecision(1)
+              << std::setw(12) << elapsed.count() * 1000
+              << std::setw(12) << byte_count / elapsed.count() / (1 << 20)
+              << std::setw(22) << checksum
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    {
+        std::vector<std::byte> content(cmp::content_size);
+        for (std::size_t i{0}; i < content.size(); ++i) {
+            content[i] = static_cast<std::byte>(i * 31 + i / 97);
+        }
+        cmp::file f{
+            cmp::benchmark_file_path,
+            cmp::write_only,
+            cmp::if_not_there::create
+        };
+        f.write(content.data(), content.size());
+    }
+
+    std::cout << std::left << std::setw(12) << "read-ahead"
+              << std::right
+              << std::setw(8) << "rounds"
+              << std::setw(12) << "ms"
+              << std::setw(12) << "MiB/s"
+              << std::setw(22) << "checksum"
+              << std::endl;
+
+    for (std::size_t round_count : cmp::decode_rounds) {
+        cmp::run(cmp::read_ahead::none, round_count);
+        cmp::run(cmp::read_ahead::background, round_count);
+    }
+
+    std::filesystem::remove(cmp::benchmark_file_path);
+
+    return 0;
+} // function -----------------------------------------------------------------
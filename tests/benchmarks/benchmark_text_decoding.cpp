@@ -0,0 +1,152 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <cmp/io/file.hpp>
+#include <cmp/io/text_input_stream.hpp>
+#include <cmp/io/text_ranges.hpp>
+
+/*
+    This benchmark decodes a UTF-8 file that looks like a log, mostly
+    ASCII with some multi-byte characters, with read_all into UTF-8 and
+    UTF-32 strings, with both kinds of read_line, and by line and by
+    token with the ranges and with operator >>, and reports the
+    throughput of each in MiB/s.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{
+    "benchmark_text_decoding.txt"
+};
+constexpr std::size_t line_count{400'000};
+
+// A buffer this large keeps the reads from the file out of the way of the
+// decoding.
+constexpr std::size_t buffer_capacity{64 * 1024};
+
+std::size_t
+write_content ()
+{
+    std::u8string content;
+    for (std::size_t i{0}; i < line_count; ++i) {
+        content += u8"2023-06-01T12:00:00Z INFO worker-";
+        content += static_cast<char8_t>(u8'0' + i % 10);
+        content += i % 8 == 0
+            ? u8" résumé upload ✓ 日本\r\n"
+            : u8" request served in 12 ms, status 200\n";
+    }
+    file f{benchmark_file_path, write_only, if_not_there::create};
+    f.write(
+        reinterpret_cast<const std::byte*>(content.data()),
+        content.size()
+    );
+    return content.size();
+} // function -----------------------------------------------------------------
+
+template <
+    typename Function
+>
+void
+run (
+    const char* operation_name,
+    std::size_t byte_count,
+    Function function
+) {
+    file f{
+        benchmark_file_path,
+        read_only,
+        if_not_there::fail,
+        buffer_capacity
+    };
+    text_input_stream<file> tis{f, utf8};
+
+    auto start{std::chrono::steady_clock::now()};
+    std::size_t result_size{function(tis)};
+    auto end{std::chrono::steady_clock::now()};
+    std::chrono::duration<double> elapsed{end - start};
+
+    std::cout << std::left << std::setw(20) << operation_name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << byte_count / elapsed.count() / (1 << 20)
+              << std::setw(12) << result_size
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    std::size_t byte_count{cmp::write_content()};
+
+    std::cout << std::left << std::setw(20) << "operation"
+              << std::right
+              << std::setw(12) << "MiB/s"
+              << std::setw(12) << "units"
+              << std::endl;
+
+    cmp::run("read_all u8string", byte_count, [] (auto& tis) {
+        std::u8string text;
+        tis.read_all(text);
+        return text.size();
+    });
+    cmp::run("read_all u32string", byte_count, [] (auto& tis) {
+        std::u32string text;
+        tis.read_all(text);
+        return text.size();
+    });
+    cmp::run("read_line u8string", byte_count, [] (auto& tis) {
+        std::u8string line;
+        std::size_t size{0};
+        while (!tis.is_at_end()) {
+            tis.read_line(line);
+            size += line.size();
+        }
+        return size;
+    });
+    cmp::run("read_line view", byte_count, [] (auto& tis) {
+        std::size_t size{0};
+        while (!tis.is_at_end()) {
+            size += tis.read_line().size();
+        }
+        return size;
+    });
+
+    cmp::run("lines range", byte_count, [] (auto& tis) {
+        std::size_t size{0};
+        for (std::u8string_view line : cmp::lines(tis)) {
+            size += line.size();
+        }
+        return size;
+    });
+    cmp::run("operator >> token", byte_count, [] (auto& tis) {
+        std::u8string token;
+        std::size_t size{0};
+        while (!tis.is_at_end()) {
+            tis >> token;
+            size += token.size();
+        }
+        return size;
+    });
+    cmp::run("tokens range", byte_count, [] (auto& tis) {
+        std::size_t size{0};
+        for (std::u8string_view token : cmp::tokens(tis)) {
+            size += token.size();
+        }
+        return size;
+    });
+
+    std::filesystem::remove(cmp::benchmark_file_path);
+
+    return 0;
+} // function -----------------------------------------------------------------
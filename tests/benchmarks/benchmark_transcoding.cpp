@@ -0,0 +1,140 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <cmp/unicode/algorithms.hpp>
+
+/*
+    This benchmark converts text that is mostly ASCII and text that is
+    mostly made of other code points between UTF-8, UTF-16 and UTF-32,
+    both one code point at a time with by_code_point and
+    append_code_point, the way convert_string used to, and with
+    convert_string, and reports the throughput of each in MB/s of input.
+*/
+
+namespace cmp {
+
+namespace {
+
+constexpr std::size_t repetition_count{100'000};
+constexpr int round_count{3};
+
+template <
+    typename OutputString,
+    typename InputString
+>
+OutputString
+convert_by_code_point (
+    const InputString& s
+) {
+    OutputString result;
+    result.reserve(s.size());
+    for (char32_t code_point : by_code_point{s}) {
+        append_code_point(result, code_point);
+    }
+    return result;
+} // function -----------------------------------------------------------------
+
+template <
+    typename OutputString,
+    typename InputString
+>
+void
+run (
+    const char* text_name,
+    const char* conversion_name,
+    const InputString& text
+) {
+    double byte_count{static_cast<double>(
+        text.size() * sizeof (typename InputString::value_type)
+    )};
+    auto measure{[&] (auto function) {
+        std::size_t size{0};
+        auto start{std::chrono::steady_clock::now()};
+        for (int round{0}; round < round_count; ++round) {
+            size += function(text).size();
+        }
+        auto end{std::chrono::steady_clock::now()};
+        std::chrono::duration<double> elapsed{end - start};
+        return byte_count * round_count / elapsed.count() / 1e6
+            + static_cast<double>(size) * 0;
+    }};
+
+    double old_throughput{
+        measure(convert_by_code_point<OutputString, InputString>)
+    };
+    double new_throughput{
+        measure(convert_string<OutputString, InputString>)
+    };
+
+    std::cout << std::left << std::setw(10) << text_name
+              << std::setw(16) << conversion_name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(16) << old_throughput
+              << std::setw(16) << new_throughput
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+template <
+    typename InputString
+>
+void
+run_all (
+    const char* text_name,
+    const std::u32string& code_points
+) {
+    InputString text{convert_string<InputString>(code_points)};
+    const char* input_name{
+        std::is_same_v<InputString, std::u8string> ? "UTF-8"
+            : std::is_same_v<InputString, std::u16string> ? "UTF-16"
+            : "UTF-32"
+    };
+    std::string name{input_name};
+    if constexpr (!std::is_same_v<InputString, std::u8string>) {
+        run<std::u8string>(text_name, (name + " to 8").c_str(), text);
+    }
+    if constexpr (!std::is_same_v<InputString, std::u16string>) {
+        run<std::u16string>(text_name, (name + " to 16").c_str(), text);
+    }
+    if constexpr (!std::is_same_v<InputString, std::u32string>) {
+        run<std::u32string>(text_name, (name + " to 32").c_str(), text);
+    }
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    std::u32string ascii;
+    std::u32string mixed;
+    for (std::size_t i{0}; i < cmp::repetition_count; ++i) {
+        ascii += U"2023-06-01T12:00:00Z INFO request served, ";
+        ascii += i % 16 == 0 ? U"résumé\n" : U"status 200\n";
+        mixed += U"日本語のテキスト, Ελληνικά, русский 😀\n";
+    }
+
+    std::cout << std::left << std::setw(10) << "text"
+              << std::setw(16) << "conversion"
+              << std::right
+              << std::setw(16) << "old MB/s"
+              << std::setw(16) << "new MB/s"
+              << std::endl;
+
+    for (auto [text_name, code_points] : {
+        std::pair{"ASCII", ascii},
+        std::pair{"mixed", mixed}
+    }) {
+        cmp::run_all<std::u8string>(text_name, code_points);
+        cmp::run_all<std::u16string>(text_name, code_points);
+        cmp::run_all<std::u32string>(text_name, code_points);
+    }
+
+    return 0;
+} // function -----------------------------------------------------------------
@@ -0,0 +1,161 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <cmp/unicode/algorithms.hpp>
+
+/*
+    This benchmark validates UTF-8 and UTF-16 text, one mostly ASCII and
+    one mostly made of multi-byte characters, by walking it with
+    by_code_point, the way validate_string used to, and with each of the
+    validation kernels that the processor supports, and reports the
+    throughput of each in GB/s along with how many code units they found
+    to be valid.
+*/
+
+namespace cmp {
+
+namespace {
+
+constexpr std::size_t repetition_count{200'000};
+constexpr int round_count{5};
+
+template <
+    typename CodeUnit
+>
+std::size_t
+find_invalid_by_code_point (
+    const CodeUnit* data,
+    std::size_t size
+)
+noexcept {
+    std::basic_string_view<CodeUnit> s{data, size};
+    by_code_point<CodeUnit> bcp_range{s};
+    auto bcp_iterator{bcp_range.cbegin()};
+    std::size_t code_unit_count{0};
+    try {
+        while (bcp_iterator != bcp_range.cend()) {
+            char32_t code_point{*bcp_iterator};
+            if (code_point > maximum_code_point) {
+                break;
+            }
+            ++bcp_iterator;
+            if constexpr (std::is_same_v<CodeUnit, char8_t>) {
+                code_unit_count += code_point < 0x80 ? 1
+                    : code_point < 0x800 ? 2
+                    : code_point < 0x10000 ? 3
+                    : 4;
+            } else {
+                code_unit_count += code_point < 0x10000 ? 1 : 2;
+            }
+        }
+    } catch (...) {
+    }
+    return code_unit_count;
+} // function -----------------------------------------------------------------
+
+template <
+    typename CodeUnit
+>
+void
+run (
+    const char* text_name,
+    const char* kernel_name,
+    const std::basic_string<CodeUnit>& text,
+    std::size_t (*kernel)(const CodeUnit*, std::size_t) noexcept
+) {
+    std::size_t byte_count{text.size() * sizeof(CodeUnit)};
+    std::size_t result{0};
+    auto start{std::chrono::steady_clock::now()};
+    for (int round{0}; round < round_count; ++round) {
+        result += kernel(text.data(), text.size());
+    }
+    auto end{std::chrono::steady_clock::now()};
+    std::chrono::duration<double> elapsed{end - start};
+
+    std::cout << std::left << std::setw(16) << text_name
+              << std::setw(16) << kernel_name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10)
+              << byte_count * round_count / elapsed.count() / 1e9
+              << std::setw(14) << result / round_count
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+template <
+    typename CodeUnit
+>
+void
+run_all (
+    const char* text_name,
+    const std::basic_string<CodeUnit>& text
+) {
+    run<CodeUnit>(
+        text_name,
+        "by_code_point",
+        text,
+        &find_invalid_by_code_point<CodeUnit>
+    );
+    if constexpr (std::is_same_v<CodeUnit, char8_t>) {
+        run(text_name, "scalar", text, &impl::find_invalid_utf8_scalar);
+#if defined(CMP_ARCHITECTURE_X86)
+        if (impl::is_sse4_supported()) {
+            run(text_name, "SSE4.1", text, &impl::find_invalid_utf8_sse4);
+        }
+        if (impl::is_avx2_supported()) {
+            run(text_name, "AVX2", text, &impl::find_invalid_utf8_avx2);
+        }
+#endif // CMP_ARCHITECTURE_X86
+    } else {
+        run(text_name, "scalar", text, &impl::find_invalid_utf16_scalar);
+#if defined(CMP_ARCHITECTURE_X86)
+        if (impl::is_sse4_supported()) {
+            run(text_name, "SSE4.1", text, &impl::find_invalid_utf16_sse4);
+        }
+        if (impl::is_avx2_supported()) {
+            run(text_name, "AVX2", text, &impl::find_invalid_utf16_avx2);
+        }
+#endif // CMP_ARCHITECTURE_X86
+    }
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    std::u8string ascii_utf8;
+    std::u8string mixed_utf8;
+    std::u16string ascii_utf16;
+    std::u16string mixed_utf16;
+    for (std::size_t i{0}; i < cmp::repetition_count; ++i) {
+        ascii_utf8 += u8"2023-06-01T12:00:00Z INFO request served, ";
+        ascii_utf8 += i % 16 == 0 ? u8"résumé\n" : u8"status 200\n";
+        mixed_utf8 += u8"日本語のテキスト, Ελληνικά, русский 😀\n";
+        ascii_utf16 += u"2023-06-01T12:00:00Z INFO request served, ";
+        ascii_utf16 += i % 16 == 0 ? u"résumé\n" : u"status 200\n";
+        mixed_utf16 += u"日本語のテキスト, Ελληνικά, русский 😀\n";
+    }
+
+    std::cout << std::left << std::setw(16) << "text"
+              << std::setw(16) << "kernel"
+              << std::right
+              << std::setw(10) << "GB/s"
+              << std::setw(14) << "valid units"
+              << std::endl;
+
+    cmp::run_all("ASCII UTF-8", ascii_utf8);
+    cmp::run_all("mixed UTF-8", mixed_utf8);
+    cmp::run_all("ASCII UTF-16", ascii_utf16);
+    cmp::run_all("mixed UTF-16", mixed_utf16);
+
+    return 0;
+} // function -----------------------------------------------------------------
@@ -0,0 +1,116 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include <cmp/io/file.hpp>
+
+#include "syscall_counter.hpp"
+
+/*
+    This benchmark writes records made of a small header followed by a
+    payload, the way a record writer would, once with two calls to write
+    per record and once with a single call to write_gather, and reports
+    the system calls made per record and the time taken.
+*/
+
+namespace cmp {
+
+namespace {
+
+const std::filesystem::path benchmark_file_path{"benchmark_write_gather.bin"};
+constexpr std::size_t record_count{200000};
+constexpr std::size_t header_size{16};
+
+template <
+    typename Function
+>
+void
+run (
+    const char* label,
+    std::size_t payload_size,
+    Function function
+) {
+    std::vector<std::byte> header(header_size, std::byte{'h'});
+    std::vector<std::byte> payload(payload_size, std::byte{'p'});
+
+    std::chrono::duration<double, std::milli> elapsed;
+    syscall_counts counts;
+    {
+        file f{benchmark_file_path, write_only, if_not_there::create};
+
+        reset_syscall_counts();
+        auto start{std::chrono::steady_clock::now()};
+        for (std::size_t i{0}; i < record_count; ++i) {
+            function(f, header, payload);
+        }
+        f.flush();
+        auto end{std::chrono::steady_clock::now()};
+        counts = get_syscall_counts();
+        elapsed = end - start;
+    }
+    std::filesystem::remove(benchmark_file_path);
+
+    std::cout << std::left << std::setw(16) << label
+              << std::right << std::setw(10) << payload_size
+              << std::fixed << std::setprecision(3)
+              << std::setw(16)
+              << static_cast<double>(counts.writes) / record_count
+              << std::setw(12) << std::setprecision(1) << elapsed.count()
+              << std::endl;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+int
+main ()
+{
+    if (!cmp::is_syscall_counting_available()) {
+        std::cout << "System calls can't be counted on this platform."
+                  << std::endl;
+    }
+
+    std::cout << std::left << std::setw(16) << "method"
+              << std::right
+              << std::setw(10) << "payload"
+              << std::setw(16) << "writes/record"
+              << std::setw(12) << "ms"
+              << std::endl;
+
+    for (std::size_t payload_size : {100, 1000, 5000, 20000}) {
+        cmp::run(
+            "write + write",
+            payload_size,
+            [] (
+                cmp::file& f,
+                const std::vector<std::byte>& header,
+                const std::vector<std::byte>& payload
+            ) {
+                f.write(header.data(), header.size());
+                f.write(payload.data(), payload.size());
+            }
+        );
+
+        cmp::run(
+            "write_gather",
+            payload_size,
+            [] (
+                cmp::file& f,
+                const std::vector<std::byte>& header,
+                const std::vector<std::byte>& payload
+            ) {
+                std::span<const std::byte> pieces[] = {header, payload};
+                f.write_gather(pieces);
+            }
+        );
+    }
+
+    return 0;
+} // function -----------------------------------------------------------------
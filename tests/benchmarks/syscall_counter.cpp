@@ -0,0 +1,149 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#include "syscall_counter.hpp"
+
+#if defined(__linux__)
+#   include <dlfcn.h>
+#   include <sys/types.h>
+#endif
+
+namespace cmp {
+
+namespace {
+
+syscall_counts counts{0, 0, 0, 0};
+
+} // namespace ----------------------------------------------------------------
+
+bool
+is_syscall_counting_available ()
+noexcept
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+} // function -----------------------------------------------------------------
+
+void
+reset_syscall_counts ()
+noexcept
+{
+    counts = {0, 0, 0, 0};
+} // function -----------------------------------------------------------------
+
+syscall_counts
+get_syscall_counts ()
+noexcept
+{
+    return counts;
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+#if defined(__linux__)
+
+/*
+    The functions below interpose the C library wrappers of the system
+    calls made by the I/O package. Each one bumps its counter and then
+    forwards to the next definition of the symbol, which is the one in
+    the C library. The declarations deliberately avoid the C library
+    headers so that their exception specifications don't get in the way.
+*/
+
+namespace {
+
+template <
+    typename Function
+>
+Function
+find_next (
+    const char* name
+)
+noexcept
+{
+    return reinterpret_cast<Function>(::dlsym(RTLD_NEXT, name));
+} // function -----------------------------------------------------------------
+
+} // namespace ----------------------------------------------------------------
+
+extern "C" {
+
+ssize_t
+read (
+    int file_descriptor,
+    void* data,
+    size_t byte_count
+) {
+    using function_type = ssize_t (*) (int, void*, size_t);
+    static function_type next{find_next<function_type>("read")};
+    ++cmp::counts.reads;
+    return next(file_descriptor, data, byte_count);
+} // function -----------------------------------------------------------------
+
+ssize_t
+write (
+    int file_descriptor,
+    const void* data,
+    size_t byte_count
+) {
+    using function_type = ssize_t (*) (int, const void*, size_t);
+    static function_type next{find_next<function_type>("write")};
+    ++cmp::counts.writes;
+    return next(file_descriptor, data, byte_count);
+} // function -----------------------------------------------------------------
+
+/*
+    Vectored writes are counted as writes, since they replace them.
+*/
+ssize_t
+writev (
+    int file_descriptor,
+    const void* vectors,
+    int vector_count
+) {
+    using function_type = ssize_t (*) (int, const void*, int);
+    static function_type next{find_next<function_type>("writev")};
+    ++cmp::counts.writes;
+    return next(file_descriptor, vectors, vector_count);
+} // function -----------------------------------------------------------------
+
+off_t
+lseek (
+    int file_descriptor,
+    off_t offset,
+    int whence
+) {
+    using function_type = off_t (*) (int, off_t, int);
+    static function_type next{find_next<function_type>("lseek")};
+    ++cmp::counts.seeks;
+    return next(file_descriptor, offset, whence);
+} // function -----------------------------------------------------------------
+
+int
+stat (
+    const char* path,
+    void* status
+) {
+    using function_type = int (*) (const char*, void*);
+    static function_type next{find_next<function_type>("stat")};
+    ++cmp::counts.stats;
+    return next(path, status);
+} // function -----------------------------------------------------------------
+
+int
+fstat (
+    int file_descriptor,
+    void* status
+) {
+    using function_type = int (*) (int, void*);
+    static function_type next{find_next<function_type>("fstat")};
+    ++cmp::counts.stats;
+    return next(file_descriptor, status);
+} // function -----------------------------------------------------------------
+
+} // extern "C" ---------------------------------------------------------------
+
+#endif // __linux__
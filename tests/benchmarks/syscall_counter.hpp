@@ -0,0 +1,62 @@
+// Copyright (C) 2023 Daniel T. McGinnis
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef CMP_BENCHMARKS_SYSCALL_COUNTER_HPP_INCLUDED
+#define CMP_BENCHMARKS_SYSCALL_COUNTER_HPP_INCLUDED
+
+#include <cstdint>
+
+namespace cmp {
+
+/**
+    Description:
+        The number of times each of the system calls that the I/O
+        package makes was called since the counters were last reset.
+*/
+struct syscall_counts {
+    std::uint64_t reads;
+    std::uint64_t writes;
+    std::uint64_t seeks;
+    std::uint64_t stats;
+
+    /**
+        Description:
+            Returns the sum of all the counters.
+    */
+    std::uint64_t
+    get_total ()
+    const noexcept
+    {
+        return reads + writes + seeks + stats;
+    } // function -------------------------------------------------------------
+}; // struct ------------------------------------------------------------------
+
+/**
+    Description:
+        Returns true if system calls can be counted on this platform.
+        Counting works by interposing the C library wrappers of the
+        system calls, which is only done on Linux.
+*/
+bool
+is_syscall_counting_available ()
+noexcept;
+
+/**
+    Description:
+        Sets all the system call counters to zero.
+*/
+void
+reset_syscall_counts ()
+noexcept;
+
+/**
+    Description:
+        Returns the current values of the system call counters.
+*/
+syscall_counts
+get_syscall_counts ()
+noexcept;
+
+} // namespace ----------------------------------------------------------------
+
+#endif // CMP_BENCHMARKS_SYSCALL_COUNTER_HPP_INCLUDED